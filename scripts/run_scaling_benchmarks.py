@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Automated scaling-benchmark suite.
+
+Runs the HydroBlast3D (uniform-grid Sedov) and RadhydroShell (AMR shell)
+problems at parameterized grid sizes and MPI rank counts, extracts the
+microseconds-per-zone-update figure of merit that evolve() prints, collects
+the structured per-phase timings (via the phase_timing_file runtime option),
+and writes everything to one machine-readable JSON file.
+
+This replaces the by-hand PBS campaigns recorded in perfdata/ and
+scripts/*.pbs: a single invocation (or `make scaling-benchmarks` in the
+build directory) reproduces a scaling study and the result file can be
+diffed/plotted to catch Mupdates/s regressions.
+
+Example:
+    ./scripts/run_scaling_benchmarks.py --bin-dir build/src \\
+        --sizes 128,256 --ranks 1,4 --max-steps 20
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+# problem name -> (executable path relative to --bin-dir,
+#                  input file relative to tests/)
+PROBLEMS = {
+    "blast": ("HydroBlast3D/test_hydro3d_blast", "blast_unigrid_256.in"),
+    "shell-amr": ("RadhydroShell/test_radhydro3d_shell", "radhydro_shell_amr.in"),
+}
+
+FOM_RE = re.compile(
+    r"Performance figure-of-merit: ([\d.eE+-]+) .s/zone-update "
+    r"\[([\d.eE+-]+) Mupdates/s\]"
+)
+LEVEL_RE = re.compile(r"Zone-updates on level (\d+): (\d+)")
+
+
+def run_case(args, problem, size, ranks):
+    """Run one (problem, size, ranks) case and return its result record."""
+    exe_rel, input_rel = PROBLEMS[problem]
+    exe = os.path.join(args.bin_dir, exe_rel)
+    input_file = os.path.join(args.source_dir, "tests", input_rel)
+    if not os.path.exists(exe):
+        print(f"SKIP {problem}: executable not found: {exe}", file=sys.stderr)
+        return None
+
+    phase_file = tempfile.mktemp(suffix=".json", prefix="quokka_phases_")
+    cmd = [exe, input_file,
+           f"amr.n_cell={size} {size} {size}",
+           f"max_timesteps={args.max_steps}",
+           f"phase_timing_file={phase_file}"]
+    if ranks > 1 or args.always_mpiexec:
+        cmd = [args.mpiexec, "-n", str(ranks)] + cmd
+
+    print(f"RUN  {problem} n_cell={size} ranks={ranks}: {' '.join(cmd)}")
+    t_start = time.time()
+    proc = subprocess.run(cmd, capture_output=True, text=True,
+                          cwd=args.source_dir, check=False)
+    elapsed = time.time() - t_start
+    if proc.returncode != 0:
+        print(f"FAIL {problem} n_cell={size} ranks={ranks} "
+              f"(exit code {proc.returncode}); last output:", file=sys.stderr)
+        print("\n".join(proc.stdout.splitlines()[-20:]), file=sys.stderr)
+        print(proc.stderr, file=sys.stderr)
+        return None
+
+    fom = FOM_RE.search(proc.stdout)
+    if fom is None:
+        print(f"FAIL {problem} n_cell={size} ranks={ranks}: "
+              "no figure-of-merit in output", file=sys.stderr)
+        return None
+
+    phases = []
+    if os.path.exists(phase_file):
+        with open(phase_file, encoding="utf-8") as f:
+            phases = json.load(f)
+        os.remove(phase_file)
+
+    record = {
+        "problem": problem,
+        "n_cell": size,
+        "ranks": ranks,
+        "max_timesteps": args.max_steps,
+        "microseconds_per_update": float(fom.group(1)),
+        "mupdates_per_second": float(fom.group(2)),
+        "zone_updates_per_level": {
+            int(m.group(1)): int(m.group(2))
+            for m in LEVEL_RE.finditer(proc.stdout)
+        },
+        "wall_seconds": elapsed,
+        "phases": phases,
+    }
+    print(f"OK   {problem} n_cell={size} ranks={ranks}: "
+          f"{record['microseconds_per_update']:.4g} us/zone-update "
+          f"[{record['mupdates_per_second']:.4g} Mupdates/s]")
+    return record
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--bin-dir", default="build/src",
+                        help="directory containing the built problem "
+                             "executables (default: build/src)")
+    parser.add_argument("--source-dir",
+                        default=os.path.dirname(
+                            os.path.dirname(os.path.abspath(__file__))),
+                        help="repository root (default: inferred from this "
+                             "script's location)")
+    parser.add_argument("--problems", default="blast,shell-amr",
+                        help="comma-separated subset of: "
+                             + ",".join(PROBLEMS))
+    parser.add_argument("--sizes", default="128,256",
+                        help="comma-separated coarse-grid sizes (cells per "
+                             "side)")
+    parser.add_argument("--ranks", default="1",
+                        help="comma-separated MPI rank counts")
+    parser.add_argument("--max-steps", type=int, default=20,
+                        help="coarse timesteps per run (default: 20)")
+    parser.add_argument("--mpiexec", default="mpiexec",
+                        help="MPI launcher (default: mpiexec)")
+    parser.add_argument("--always-mpiexec", action="store_true",
+                        help="launch single-rank runs through the MPI "
+                             "launcher too")
+    parser.add_argument("--output", default="scaling_results.json",
+                        help="result file (default: scaling_results.json)")
+    args = parser.parse_args()
+
+    results = []
+    for problem in args.problems.split(","):
+        if problem not in PROBLEMS:
+            parser.error(f"unknown problem '{problem}'")
+        for size in (int(s) for s in args.sizes.split(",")):
+            for ranks in (int(r) for r in args.ranks.split(",")):
+                record = run_case(args, problem, size, ranks)
+                if record is not None:
+                    results.append(record)
+
+    with open(args.output, "w", encoding="utf-8") as f:
+        json.dump(results, f, indent=2)
+    print(f"Wrote {len(results)} result(s) to {args.output}")
+    return 0 if results else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
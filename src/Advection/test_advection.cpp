@@ -90,7 +90,7 @@ void AdvectionSimulation<SawtoothProblem>::computeReferenceSolution(
     xs.at(i) = prob_lo[0] + (i + amrex::Real(0.5)) * dx[0];
   }
 
-  if (amrex::ParallelDescriptor::IOProcessor()) {
+  if (quokka::BeginAsyncRender()) {
     // extract values
     std::vector<double> d(nx);
     std::vector<double> d_exact(nx);
@@ -111,6 +111,7 @@ void AdvectionSimulation<SawtoothProblem>::computeReferenceSolution(
 	matplotlibcpp::plot(xs, d, d_final_args);
 	matplotlibcpp::legend();
 	matplotlibcpp::save(std::string("./advection_sawtooth.pdf"));
+    quokka::EndAsyncRender();
   }
 #endif
 }
@@ -98,16 +98,19 @@ void AdvectionSimulation<SemiellipseProblem>::computeReferenceSolution(
     }
 
 #ifdef HAVE_PYTHON
-    // Plot results
-    std::map<std::string, std::string> d_initial_args;
-    std::map<std::string, std::string> d_final_args;
-    d_initial_args["label"] = "density (exact solution)";
-    d_final_args["label"] = "density";
-
-    matplotlibcpp::plot(xs, d_exact, d_initial_args);
-    matplotlibcpp::plot(xs, d, d_final_args);
-    matplotlibcpp::legend();
-    matplotlibcpp::save(std::string("./advection_semiellipse.pdf"));
+    if (quokka::BeginAsyncRender()) {
+      // Plot results
+      std::map<std::string, std::string> d_initial_args;
+      std::map<std::string, std::string> d_final_args;
+      d_initial_args["label"] = "density (exact solution)";
+      d_final_args["label"] = "density";
+
+      matplotlibcpp::plot(xs, d_exact, d_initial_args);
+      matplotlibcpp::plot(xs, d, d_final_args);
+      matplotlibcpp::legend();
+      matplotlibcpp::save(std::string("./advection_semiellipse.pdf"));
+      quokka::EndAsyncRender();
+    }
 #endif
   }
 }
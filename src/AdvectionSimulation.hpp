@@ -40,7 +40,6 @@ template <typename problem_t> class AdvectionSimulation : public AMRSimulation<p
       public:
 	using AMRSimulation<problem_t>::state_old_;
 	using AMRSimulation<problem_t>::state_new_;
-	using AMRSimulation<problem_t>::max_signal_speed_;
 
 	using AMRSimulation<problem_t>::cflNumber_;
 	using AMRSimulation<problem_t>::dt_;
@@ -78,7 +77,7 @@ template <typename problem_t> class AdvectionSimulation : public AMRSimulation<p
 		componentNames_ = {"density"};
 	}
 
-	void computeMaxSignalLocal(int level) override;
+	auto computeMaxSignalLocal(int level) -> amrex::Real override;
 	void setInitialConditionsAtLevel(int level) override;
 	void advanceSingleTimestepAtLevel(int lev, amrex::Real time, amrex::Real dt_lev,
 					  int /*iteration*/, int /*ncycle*/) override;
@@ -93,7 +92,7 @@ template <typename problem_t> class AdvectionSimulation : public AMRSimulation<p
 	// compute derived variables
 	void ComputeDerivedVar(int lev, std::string const &dname, amrex::MultiFab &mf, int ncomp) const override;
 
-	void FixupState(int lev) override;
+	void FixupState(int lev, bool newStateOnly, amrex::BoxArray const *syncRegion) override;
 
 	// tag cells for refinement
 	void ErrorEst(int lev, amrex::TagBoxArray &tags, amrex::Real time, int ngrow) override;
@@ -107,10 +106,30 @@ template <typename problem_t> class AdvectionSimulation : public AMRSimulation<p
 			  amrex::Array4<amrex::Real> const &x1Flux, const amrex::Box &indexRange,
 			  int nvars);
 
+	void advanceSemiLagrangianAtLevel(int lev, amrex::Real time, amrex::Real dt_lev);
+
+	auto computeSemiLagrangianFluxes(amrex::Array4<const amrex::Real> const &consVar,
+					 const amrex::Box &indexRange, int nvars, amrex::Real dt,
+					 amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &dx,
+					 int dir)
+	    -> std::array<amrex::FArrayBox, AMREX_SPACEDIM>;
+
+	template <FluxDir DIR>
+	void semiLagrangianFluxFunction(amrex::Array4<const amrex::Real> const &consState,
+					amrex::Array4<amrex::Real> const &x1Flux,
+					const amrex::Box &indexRange, int nvars, amrex::Real dt,
+					amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &dx);
+
 	double advectionVx_ = 1.0; // default
 	double advectionVy_ = 0.0; // default
 	double advectionVz_ = 0.0; // default
 
+	// if nonzero, advance with the semi-Lagrangian (characteristic-tracing)
+	// update, which is conservative and stable for CFL numbers >> 1 (used for
+	// tracer-transport configs where the timestep count dominates wall time).
+	// requires nghost_ >= (CFL number) + 3.
+	int semiLagrangian_ = 0;
+
 	amrex::Real errorNorm_ = NAN;
 
 	static constexpr int reconstructOrder_ =
@@ -119,16 +138,11 @@ template <typename problem_t> class AdvectionSimulation : public AMRSimulation<p
 };
 
 template <typename problem_t>
-void AdvectionSimulation<problem_t>::computeMaxSignalLocal(int const level)
+auto AdvectionSimulation<problem_t>::computeMaxSignalLocal(int const /*level*/) -> amrex::Real
 {
-	// loop over local grids, compute CFL timestep
-	for (amrex::MFIter iter(state_new_[level]); iter.isValid(); ++iter) {
-		const amrex::Box &indexRange = iter.validbox();
-		auto const &stateOld = state_old_[level].const_array(iter);
-		auto const &maxSignal = max_signal_speed_[level].array(iter);
-		LinearAdvectionSystem<problem_t>::ComputeMaxSignalSpeed(
-		    stateOld, maxSignal, advectionVx_, advectionVy_, advectionVz_, indexRange);
-	}
+	// the advection velocity is spatially uniform, so no per-cell reduction is needed
+	return LinearAdvectionSystem<problem_t>::ComputeMaxSignalSpeed(advectionVx_, advectionVy_,
+								       advectionVz_);
 }
 
 template <typename problem_t>
@@ -156,7 +170,7 @@ void AdvectionSimulation<problem_t>::ErrorEst(int lev, amrex::TagBoxArray &tags,
 }
 
 template <typename problem_t>
-void AdvectionSimulation<problem_t>::FixupState(int lev)
+void AdvectionSimulation<problem_t>::FixupState(int lev, bool /*newStateOnly*/, amrex::BoxArray const * /*syncRegion*/)
 {
 	// fix negative states
 }
@@ -181,17 +195,16 @@ void AdvectionSimulation<problem_t>::computeAfterEvolve(amrex::Vector<amrex::Rea
 	computeReferenceSolution(state_ref_level0, geom[0].CellSizeArray(),
 							 geom[0].ProbLoArray(), geom[0].ProbHiArray());
 
-	// compute error norm
-	amrex::MultiFab residual(boxArray(0), DistributionMap(0), ncomp, nghost);
-	amrex::MultiFab::Copy(residual, state_ref_level0, 0, 0, ncomp, nghost);
-	amrex::MultiFab::Saxpy(residual, -1., state_new_[0], 0, 0, ncomp, nghost);
+	// compute the error norms in a single fused device pass (no residual
+	// MultiFab, no per-component norm1 reductions)
+	quokka::ErrorNorms const norms = computeErrorNorms(state_ref_level0);
 
 	amrex::Real sol_norm = 0.;
 	amrex::Real err_norm = 0.;
 	// compute rms of each component
 	for (int n = 0; n < ncomp; ++n) {
-		sol_norm += std::pow(state_ref_level0.norm1(n), 2);
-		err_norm += std::pow(residual.norm1(n), 2);
+		sol_norm += std::pow(norms.sol_L1[n], 2);
+		err_norm += std::pow(norms.L1[n], 2);
 	}
 	sol_norm = std::sqrt(sol_norm);
 	err_norm = std::sqrt(err_norm);
@@ -216,6 +229,12 @@ void AdvectionSimulation<problem_t>::advanceSingleTimestepAtLevel(int lev, amrex
 	AMREX_ASSERT(!state_old_[lev].contains_nan(0, state_old_[lev].nComp()));
 	AMREX_ASSERT(!state_old_[lev].contains_nan()); // check ghost cells
 
+	if (semiLagrangian_ != 0) {
+		// large-CFL characteristic-tracing update (replaces the RK2 stages)
+		advanceSemiLagrangianAtLevel(lev, time, dt_lev);
+		return;
+	}
+
 	// get geometry (used only for cell sizes)
 	auto const &geomLevel = geom[lev];
 
@@ -275,6 +294,10 @@ void AdvectionSimulation<problem_t>::advanceSingleTimestepAtLevel(int lev, amrex
 	}
 
 	// advance all grids on local processor (Stage 1 of integrator)
+	// (whole boxes per OpenMP thread in CPU builds)
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
 	for (amrex::MFIter iter(state_new_[lev]); iter.isValid(); ++iter) {
 		const amrex::Box &indexRange = iter.validbox();
 		auto const &stateOld = state_old_[lev].const_array(iter);
@@ -309,6 +332,10 @@ void AdvectionSimulation<problem_t>::advanceSingleTimestepAtLevel(int lev, amrex
 		fillBoundaryConditions(state_new_[lev], state_new_[lev], lev, time + dt_lev);
 
 		// advance all grids on local processor (Stage 2 of integrator)
+		// (whole boxes per OpenMP thread in CPU builds)
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
 		for (amrex::MFIter iter(state_new_[lev]); iter.isValid(); ++iter) {
 			const amrex::Box &indexRange = iter.validbox();
 			auto const &stateInOld = state_old_[lev].const_array(iter);
@@ -415,36 +442,238 @@ void AdvectionSimulation<problem_t>::fluxFunction(amrex::Array4<const amrex::Rea
 		dim = 2;
 	}
 
-	// extend box to include ghost zones
-	amrex::Box const &ghostRange = amrex::grow(indexRange, nghost_);
-	amrex::Box const &reconstructRange = amrex::grow(indexRange, 1);
-	amrex::Box const &x1ReconstructRange = amrex::surroundingNodes(reconstructRange, dim);
-	amrex::FArrayBox primVar(ghostRange, nvars,
-				 amrex::The_Async_Arena()); // cell-centered
-	amrex::FArrayBox x1LeftState(x1ReconstructRange, nvars, amrex::The_Async_Arena());
-	amrex::FArrayBox x1RightState(x1ReconstructRange, nvars, amrex::The_Async_Arena());
-
-	// cell-centered kernel
-	LinearAdvectionSystem<problem_t>::ConservedToPrimitive(consState, primVar.array(),
-							       ghostRange, nvars);
-
-	if constexpr (reconstructOrder_ == 3) {
-		// mixed interface/cell-centered kernel
-		LinearAdvectionSystem<problem_t>::template ReconstructStatesPPM<DIR>(
-		    primVar.array(), x1LeftState.array(), x1RightState.array(), reconstructRange,
-		    x1ReconstructRange, nvars);
-	} else if constexpr (reconstructOrder_ == 1) {
-		// interface-centered kernel
-		LinearAdvectionSystem<problem_t>::template ReconstructStatesConstant<DIR>(
-		    primVar.array(), x1LeftState.array(), x1RightState.array(), x1ReconstructRange,
-		    nvars);
+	// interface-centered kernel (fused reconstruction + upwind flux; since the
+	// upwind flux only ever uses one side of each interface, this needs no
+	// primitive-variable or interface-state staging arrays, making the
+	// advection benchmarks pure memory-bandwidth roofline tests)
+	amrex::Box const &x1FluxRange = amrex::surroundingNodes(indexRange, dim);
+
+	LinearAdvectionSystem<problem_t>::template ComputeFluxesFused<DIR>(
+	    x1Flux, consState, advectionVel, x1FluxRange, nvars, reconstructOrder_);
+}
+
+template <typename problem_t>
+void AdvectionSimulation<problem_t>::advanceSemiLagrangianAtLevel(int lev, amrex::Real time,
+								  amrex::Real dt_lev)
+{
+	// Semi-Lagrangian (characteristic-tracing) update, stable and conservative
+	// for CFL numbers >> 1. Each directional sweep applies a flux-form update
+	// whose time-averaged flux is integrated along the characteristics
+	// (LinearAdvectionSystem::ComputeFluxesSemiLagrangian). With a constant
+	// advection velocity the per-direction solution operators commute, so
+	// sweeping the directions sequentially is time-exact: there is no
+	// splitting error and no Runge-Kutta stages are needed. (An *unsplit*
+	// flux difference would be unstable here -- at CFL > 1 the corner-coupling
+	// terms are not small corrections.)
+
+	// get geometry (used only for cell sizes)
+	auto const &geomLevel = geom[lev];
+
+#ifdef USE_YAFLUXREGISTER
+	// get flux registers
+	amrex::YAFluxRegister *fr_as_crse = nullptr;
+	amrex::YAFluxRegister *fr_as_fine = nullptr;
+
+	if (do_reflux) {
+		if (lev < finestLevel()) {
+			fr_as_crse = flux_reg_[lev + 1].get();
+			fr_as_crse->reset();
+		}
+		if (lev > 0) {
+			fr_as_fine = flux_reg_[lev].get();
+		}
+	}
+#else
+	amrex::FluxRegister *fine = nullptr;
+	amrex::FluxRegister *current = nullptr;
+
+	if (do_reflux && lev < finest_level) {
+		fine = flux_reg_[lev + 1].get();
+		fine->setVal(0.0);
+	}
+
+	if (do_reflux && lev > 0) {
+		current = flux_reg_[lev].get();
+	}
+
+	// create temporary MultiFab to store the fluxes from each grid on this level
+	std::array<amrex::MultiFab, AMREX_SPACEDIM> fluxes;
+
+	if (do_reflux) {
+		for (int j = 0; j < AMREX_SPACEDIM; j++) {
+			amrex::BoxArray ba = state_new_[lev].boxArray();
+			ba.surroundingNodes(j);
+			fluxes[j].define(ba, dmap[lev], ncomp_, 0);
+			fluxes[j].setVal(0.);
+		}
+	}
+#endif // USE_YAFLUXREGISTER
+
+	// Intermediate sweeps ping-pong between state_new_ and a scratch register,
+	// chosen so the final sweep lands in state_new_. state_old_ must be
+	// preserved (it time-interpolates ghost fills for subcycled finer levels),
+	// and updating a register in place would race with neighboring boxes whose
+	// flux stencils read this box's valid cells as ghost cells.
+	amrex::MultiFab stateInter;
+	if constexpr (AMREX_SPACEDIM > 1) {
+		stateInter.define(boxArray(lev), DistributionMap(lev), ncomp_, nghost_);
+	}
+
+	for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+		const int sweepsLeft = AMREX_SPACEDIM - 1 - dir;
+		amrex::MultiFab &stateNextMF =
+		    (sweepsLeft % 2 == 0) ? state_new_[lev] : stateInter;
+		amrex::MultiFab &stateCurMF =
+		    (dir == 0) ? state_old_[lev]
+			       : ((sweepsLeft % 2 == 0) ? stateInter : state_new_[lev]);
+
+		// update ghost zones [w/ this sweep's input state]
+		fillBoundaryConditions(stateCurMF, stateCurMF, lev,
+				       (dir == 0) ? time : time + dt_lev);
+
+		// advance all grids on local processor
+		// (whole boxes per OpenMP thread in CPU builds)
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+		for (amrex::MFIter iter(stateNextMF); iter.isValid(); ++iter) {
+			const amrex::Box &indexRange = iter.validbox();
+			auto const &stateCur = stateCurMF.const_array(iter);
+			auto const &stateNext = stateNextMF.array(iter);
+			auto fluxArrays = computeSemiLagrangianFluxes(
+			    stateCur, indexRange, ncomp_, dt_lev, geomLevel.CellSizeArray(), dir);
+
+			amrex::IArrayBox redoFlag(indexRange, 1, amrex::The_Async_Arena());
+
+			// conservative 1D update (the flux components along the other
+			// directions are zero for this sweep)
+			LinearAdvectionSystem<problem_t>::PredictStep(
+			    stateCur, stateNext,
+			    {AMREX_D_DECL(fluxArrays[0].const_array(), fluxArrays[1].const_array(),
+					  fluxArrays[2].const_array())},
+			    dt_lev, geomLevel.CellSizeArray(), indexRange, ncomp_,
+			    redoFlag.array());
+
+			if (do_reflux) {
+#ifdef USE_YAFLUXREGISTER
+				// increment flux registers (the fluxes are already
+				// time-averaged over the whole step, so no stage weighting)
+				incrementFluxRegisters(iter, fr_as_crse, fr_as_fine, fluxArrays,
+						       lev, dt_lev);
+#else
+				for (int i = 0; i < AMREX_SPACEDIM; i++) {
+					fluxes[i][iter].plus<amrex::RunOn::Gpu>(fluxArrays[i]);
+				}
+#endif // USE_YAFLUXREGISTER
+			}
+		}
+	}
+
+#ifndef USE_YAFLUXREGISTER
+	if (do_reflux) {
+		// rescale by face area
+		auto dx = geomLevel.CellSizeArray();
+		amrex::Real const cell_vol = AMREX_D_TERM(dx[0], *dx[1], *dx[2]);
+
+		for (int i = 0; i < AMREX_SPACEDIM; i++) {
+			amrex::Real const face_area = cell_vol / dx[i];
+			amrex::Real const rescaleFactor = dt_lev * face_area;
+			fluxes[i].mult(rescaleFactor);
+		}
+
+		if (current != nullptr) {
+			for (int i = 0; i < AMREX_SPACEDIM; i++) {
+				current->FineAdd(fluxes[i], i, 0, 0, ncomp_, 1.);
+			}
+		}
+
+		if (fine != nullptr) {
+			for (int i = 0; i < AMREX_SPACEDIM; i++) {
+				fine->CrseInit(fluxes[i], i, 0, 0, ncomp_, -1.);
+			}
+		}
+	}
+#endif
+}
+
+template <typename problem_t>
+auto AdvectionSimulation<problem_t>::computeSemiLagrangianFluxes(
+    amrex::Array4<const amrex::Real> const &consVar, const amrex::Box &indexRange, const int nvars,
+    const amrex::Real dt, amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &dx, const int dir)
+    -> std::array<amrex::FArrayBox, AMREX_SPACEDIM>
+{
+	amrex::Box const &x1FluxRange = amrex::surroundingNodes(indexRange, 0);
+	amrex::FArrayBox x1Flux(x1FluxRange, nvars,
+				amrex::The_Async_Arena()); // node-centered in x
+#if (AMREX_SPACEDIM >= 2)
+	amrex::Box const &x2FluxRange = amrex::surroundingNodes(indexRange, 1);
+	amrex::FArrayBox x2Flux(x2FluxRange, nvars,
+				amrex::The_Async_Arena()); // node-centered in y
+#endif
+#if (AMREX_SPACEDIM == 3)
+	amrex::Box const &x3FluxRange = amrex::surroundingNodes(indexRange, 2);
+	amrex::FArrayBox x3Flux(x3FluxRange, nvars,
+				amrex::The_Async_Arena()); // node-centered in z
+#endif
+
+	// only the active sweep direction carries flux; the other components are
+	// zeroed so the flux-form update and the reflux plumbing stay
+	// direction-agnostic
+	AMREX_D_TERM(x1Flux.setVal<amrex::RunOn::Device>(0.);
+		     , x2Flux.setVal<amrex::RunOn::Device>(0.);
+		     , x3Flux.setVal<amrex::RunOn::Device>(0.);)
+
+	if (dir == 0) {
+		semiLagrangianFluxFunction<FluxDir::X1>(consVar, x1Flux.array(), indexRange, nvars,
+							dt, dx);
+	}
+#if (AMREX_SPACEDIM >= 2)
+	else if (dir == 1) {
+		semiLagrangianFluxFunction<FluxDir::X2>(consVar, x2Flux.array(), indexRange, nvars,
+							dt, dx);
+	}
+#endif
+#if (AMREX_SPACEDIM == 3)
+	else if (dir == 2) {
+		semiLagrangianFluxFunction<FluxDir::X3>(consVar, x3Flux.array(), indexRange, nvars,
+							dt, dx);
+	}
+#endif
+
+	return {AMREX_D_DECL(std::move(x1Flux), std::move(x2Flux), std::move(x3Flux))};
+}
+
+template <typename problem_t>
+template <FluxDir DIR>
+void AdvectionSimulation<problem_t>::semiLagrangianFluxFunction(
+    amrex::Array4<const amrex::Real> const &consState, amrex::Array4<amrex::Real> const &x1Flux,
+    const amrex::Box &indexRange, const int nvars, const amrex::Real dt,
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &dx)
+{
+	amrex::Real advectionVel = NAN;
+	int dim = 0;
+	if constexpr (DIR == FluxDir::X1) {
+		advectionVel = advectionVx_;
+		// [0 == x1 direction]
+		dim = 0;
+	} else if constexpr (DIR == FluxDir::X2) {
+		advectionVel = advectionVy_;
+		// [1 == x2 direction]
+		dim = 1;
+	} else if constexpr (DIR == FluxDir::X3) {
+		advectionVel = advectionVz_;
+		// [2 == x3 direction]
+		dim = 2;
 	}
 
-	// interface-centered kernel
+	// interface-centered kernel (since the advection velocity is constant,
+	// the per-direction characteristic sweeps commute exactly, so no
+	// directional splitting error is incurred at large CFL)
 	amrex::Box const &x1FluxRange = amrex::surroundingNodes(indexRange, dim);
 
-	LinearAdvectionSystem<problem_t>::template ComputeFluxes<DIR>(
-	    x1Flux, x1LeftState.array(), x1RightState.array(), advectionVel, x1FluxRange, nvars);
+	LinearAdvectionSystem<problem_t>::template ComputeFluxesSemiLagrangian<DIR>(
+	    x1Flux, consState, advectionVel, dt, dx[dim], x1FluxRange, nvars, nghost_,
+	    reconstructOrder_);
 }
 
 #endif // ADVECTION_SIMULATION_HPP_
\ No newline at end of file
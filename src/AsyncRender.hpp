@@ -0,0 +1,69 @@
+#ifndef ASYNCRENDER_HPP_ // NOLINT
+#define ASYNCRENDER_HPP_
+//==============================================================================
+// TwoMomentRad - a radiation transport library for patch-based AMR codes
+// Copyright 2020 Benjamin Wibking.
+// Released under the MIT license. See LICENSE file included in the GitHub repo.
+//==============================================================================
+/// \file AsyncRender.hpp
+/// \brief Runs matplotlib plotting blocks in a forked child process, so the
+/// MPI job can exit as soon as the physics is done instead of waiting for the
+/// Python interpreter.
+
+#include <csignal>
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#include "AMReX_ParallelDescriptor.H"
+
+namespace quokka
+{
+namespace detail
+{
+inline auto asyncRenderChild() -> bool &
+{
+	static bool isChild = false;
+	return isChild;
+}
+} // namespace detail
+
+/// BeginAsyncRender()/EndAsyncRender() bracket a matplotlib plotting block.
+/// Begin returns true if the caller should run the block: normally in a
+/// forked child process on the IO rank, which inherits the already-gathered
+/// fextract arrays by copy-on-write; or synchronously on the IO rank if
+/// fork() is unavailable or failed. The plotting block must not touch MPI or
+/// the GPU, and must finish with EndAsyncRender(), which terminates the child
+/// via _exit() so the parent's atexit handlers (MPI_Finalize, GPU teardown)
+/// are not run a second time.
+inline auto BeginAsyncRender() -> bool
+{
+	if (!amrex::ParallelDescriptor::IOProcessor()) {
+		return false;
+	}
+#if defined(__unix__) || defined(__APPLE__)
+	std::signal(SIGCHLD, SIG_IGN); // auto-reap finished children
+	std::fflush(nullptr);	       // don't duplicate buffered output into the child
+	pid_t const pid = ::fork();
+	if (pid > 0) {
+		return false; // parent: continue immediately
+	}
+	if (pid == 0) {
+		detail::asyncRenderChild() = true;
+	}
+	// pid < 0: fork() failed; fall through and render synchronously
+#endif
+	return true;
+}
+
+inline void EndAsyncRender()
+{
+	if (detail::asyncRenderChild()) {
+		::_exit(0); // child: skip atexit handlers (MPI/GPU teardown)
+	}
+}
+} // namespace quokka
+
+#endif // ASYNCRENDER_HPP_
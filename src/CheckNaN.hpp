@@ -8,31 +8,108 @@
 /// \file CheckNaN.hpp
 /// \brief Implements functions to check NaN values in arrays on the GPU.
 
+#include <cmath>
+#include <limits>
+
 #include "AMReX_Array4.H"
 #include "AMReX_FArrayBox.H"
+#include "AMReX_GpuDevice.H"
+#include "AMReX_GpuPrint.H"
 #include "AMReX_GpuQualifiers.H"
+#include "AMReX_Reduce.H"
 
 namespace quokka
 {
+// component permutations under the x/y diagonal reflection, used by
+// FindFirstAsymmetry below. scalar fields map onto themselves; for vector
+// fields the x- and y-components swap (e.g. x1Momentum <-> x2Momentum).
+struct IdentityCompMap {
+	AMREX_GPU_HOST_DEVICE auto operator()(int n) const -> int { return n; }
+};
+struct SwapCompMap {
+	int a_;
+	int b_;
+	AMREX_GPU_HOST_DEVICE auto operator()(int n) const -> int
+	{
+		return (n == a_) ? b_ : ((n == b_) ? a_ : n);
+	}
+};
+
+// mirror-compare 'upper' against 'lower' reflected across the x/y diagonal in
+// a single device reduction (rather than a host-side element loop, which is
+// ~10x slower at real problem sizes). returns the encoded linear index of the
+// first asymmetric (cell, component) pair, or -1 if the arrays agree exactly
+// over 'indexRange'. pass the same array twice to check self-symmetry.
+template <typename F>
+auto FindFirstAsymmetry(amrex::Array4<const amrex::Real> const &upper,
+			amrex::Array4<const amrex::Real> const &lower,
+			amrex::Box const &indexRange, const int ncomp, F const &compMap)
+    -> amrex::Long
+{
+	amrex::ReduceOps<amrex::ReduceOpMin> reduce_op;
+	amrex::ReduceData<amrex::Long> reduce_data(reduce_op);
+	using ReduceTuple = typename decltype(reduce_data)::Type;
+
+	auto const lo = amrex::lbound(indexRange);
+	auto const len = amrex::length(indexRange);
+	amrex::Long const ncells = static_cast<amrex::Long>(len.x) * len.y * len.z;
+
+	reduce_op.eval(indexRange, ncomp, reduce_data,
+		       [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) -> ReduceTuple {
+			       if (upper(i, j, k, n) != lower(j, i, k, compMap(n))) {
+				       return {n * ncells +
+					       ((k - lo.z) * static_cast<amrex::Long>(len.y) +
+						(j - lo.y)) * len.x +
+					       (i - lo.x)};
+			       }
+			       return {std::numeric_limits<amrex::Long>::max()};
+		       });
+
+	amrex::Long const first = amrex::get<0>(reduce_data.value(reduce_op));
+	return (first == std::numeric_limits<amrex::Long>::max()) ? -1 : first;
+}
+
+// decode an index returned by FindFirstAsymmetry and print its location
+inline void ReportAsymmetry(char const *label, amrex::Long idx, amrex::Box const &indexRange)
+{
+	auto const lo = amrex::lbound(indexRange);
+	auto const len = amrex::length(indexRange);
+	amrex::Long const ncells = static_cast<amrex::Long>(len.x) * len.y * len.z;
+	int const n = static_cast<int>(idx / ncells);
+	amrex::Long cell = idx % ncells;
+	int const k = static_cast<int>(cell / (static_cast<amrex::Long>(len.x) * len.y)) + lo.z;
+	cell %= static_cast<amrex::Long>(len.x) * len.y;
+	int const j = static_cast<int>(cell / len.x) + lo.y;
+	int const i = static_cast<int>(cell % len.x) + lo.x;
+	amrex::Print() << "x/y asymmetry in " << label << " at (i, j, k, comp) = (" << i << ", "
+		       << j << ", " << k << ", " << n << ")\n";
+}
+
 template <typename T>
-AMREX_GPU_HOST_DEVICE auto CheckSymmetryArray(amrex::Array4<const amrex::Real> const & /*arr*/,
-					      amrex::Box const & /*indexRange*/,
-					      const int /*ncomp*/,
-					      amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> /*dx*/)
-    -> bool
+auto CheckSymmetryArray(amrex::Array4<const amrex::Real> const &arr,
+			amrex::Box const &indexRange, const int ncomp,
+			amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> /*dx*/) -> bool
 {
-	return true; // problem-specific implementation for test problems
+	amrex::Long const idx =
+	    FindFirstAsymmetry(arr, arr, indexRange, ncomp, IdentityCompMap{});
+	if (idx >= 0) {
+		ReportAsymmetry("array", idx, indexRange);
+	}
+	return (idx < 0);
 }
 
 template <typename T>
-AMREX_GPU_HOST_DEVICE auto CheckSymmetryFluxes(amrex::Array4<const amrex::Real> const & /*arr1*/,
-					       amrex::Array4<const amrex::Real> const & /*arr2*/,
-					       amrex::Box const & /*indexRange*/,
-					       const int /*ncomp*/,
-					       amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> /*dx*/)
-    -> bool
+auto CheckSymmetryFluxes(amrex::Array4<const amrex::Real> const &arr1,
+			 amrex::Array4<const amrex::Real> const &arr2,
+			 amrex::Box const &indexRange, const int ncomp,
+			 amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> /*dx*/) -> bool
 {
-	return true; // problem-specific implementation for test problems
+	amrex::Long const idx =
+	    FindFirstAsymmetry(arr1, arr2, indexRange, ncomp, IdentityCompMap{});
+	if (idx >= 0) {
+		ReportAsymmetry("fluxes", idx, indexRange);
+	}
+	return (idx < 0);
 }
 
 template <typename T>
@@ -43,6 +120,23 @@ CheckNaN(amrex::FArrayBox const &arr, amrex::Box const & /*symmetryRange*/,
 {
 	AMREX_ASSERT(!arr.template contains_nan<amrex::RunOn::Gpu>(nanRange, 0, ncomp));
 }
+
+// print the location of every NaN in 'range' via device printf (used by the
+// sampled runtime validation in AMRSimulation when a check fires)
+inline void ReportNaN(amrex::FArrayBox const &arr, amrex::Box const &range,
+		      const int ncomp)
+{
+	auto const &a = arr.const_array();
+	amrex::ParallelFor(range, ncomp,
+			   [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+				   if (std::isnan(a(i, j, k, n))) {
+					   AMREX_DEVICE_PRINTF(
+					       "NaN at (i, j, k, comp) = (%d, %d, %d, %d)\n",
+					       i, j, k, n);
+				   }
+			   });
+	amrex::Gpu::streamSynchronize();
+}
 } // namespace quokka
 
 #endif // CHECKNAN_HPP_
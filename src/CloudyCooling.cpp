@@ -22,9 +22,12 @@ void readCloudyData(cloudy_tables &cloudyTables) {
   std::string grackle_hdf5_file;
 
   pp.query("grackle_data_file", grackle_hdf5_file);
+  amrex::Real const start_time = amrex::second();
   initialize_cloudy_data(cloudy_primordial, "Primordial", grackle_hdf5_file,
                          my_units);
   initialize_cloudy_data(cloudy_metals, "Metals", grackle_hdf5_file, my_units);
+  amrex::Print() << "Read Cloudy tables in " << (amrex::second() - start_time)
+                 << " seconds.\n";
 
   cloudyTables.log_nH = std::make_unique<amrex::TableData<double, 1>>(
       copy_1d_table(cloudy_primordial.grid_parameters[0]));
@@ -53,6 +56,8 @@ auto cloudy_tables::const_tables() const -> cloudyGpuConstTables {
                               primHeating->const_table(),
                               metalCooling->const_table(),
                               metalHeating->const_table(),
-                              mean_mol_weight->const_table()};
+                              mean_mol_weight->const_table(),
+                              makeUniformAxis(log_nH->const_table()),
+                              makeUniformAxis(log_Tgas->const_table())};
   return tables;
 }
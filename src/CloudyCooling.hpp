@@ -49,6 +49,12 @@ struct cloudyGpuConstTables {
   amrex::Table2D<const Real> const metalCool;
   amrex::Table2D<const Real> const metalHeat;
   amrex::Table2D<const Real> const meanMolWeight;
+
+  // precomputed uniform-grid axes (the Grackle tables are uniformly
+  // log-spaced), so the hot-loop lookups index with a single multiply-add
+  // instead of touching the axis arrays
+  UniformAxis const nH_axis;
+  UniformAxis const Tgas_axis;
 };
 
 class cloudy_tables {
@@ -74,17 +80,17 @@ cloudy_cooling_function(Real const rho, Real const T,
   const Real log_nH = std::log10(nH);
   const Real log_T = std::log10(T);
 
-  const double logPrimCool = interpolate2d(log_nH, log_T, tables.log_nH,
-                                           tables.log_Tgas, tables.primCool);
-
-  const double logPrimHeat = interpolate2d(log_nH, log_T, tables.log_nH,
-                                           tables.log_Tgas, tables.primHeat);
-
-  const double logMetalCool = interpolate2d(log_nH, log_T, tables.log_nH,
-                                            tables.log_Tgas, tables.metalCool);
+  // all five tables share the same (log_nH, log_T) axes, so interpolate them
+  // with a single index search and weight computation
+  const quokka::valarray<double, 5> rates = interpolate2d_multi<5>(
+      log_nH, log_T, tables.nH_axis, tables.Tgas_axis,
+      {tables.primCool, tables.primHeat, tables.metalCool, tables.metalHeat,
+       tables.meanMolWeight});
 
-  const double logMetalHeat = interpolate2d(log_nH, log_T, tables.log_nH,
-                                            tables.log_Tgas, tables.metalHeat);
+  const double logPrimCool = rates[0];
+  const double logPrimHeat = rates[1];
+  const double logMetalCool = rates[2];
+  const double logMetalHeat = rates[3];
 
   const double netLambda_prim =
       std::pow(10., logPrimHeat) - std::pow(10., logPrimCool);
@@ -95,9 +101,8 @@ cloudy_cooling_function(Real const rho, Real const T,
   // multiply by the square of H mass density (**NOT number density**)
   double Edot = (rhoH * rhoH) * netLambda;
 
-  // compute dimensionless mean mol. weight mu from mu(T) table
-  const double mu = interpolate2d(log_nH, log_T, tables.log_nH, tables.log_Tgas,
-                                  tables.meanMolWeight);
+  // dimensionless mean mol. weight mu from the mu(T) table
+  const double mu = rates[4];
 
   // compute electron density
   // N.B. it is absolutely critical to include the metal contribution here!
@@ -136,8 +141,9 @@ ComputeEgasFromTgas(double rho, double Tgas, double gamma,
   const Real nH = rhoH / hydrogen_mass_cgs_;
 
   // compute mu from mu(T) table
-  const Real mu = interpolate2d(std::log10(nH), std::log10(Tgas), tables.log_nH,
-                                tables.log_Tgas, tables.meanMolWeight);
+  const Real mu = interpolate2d(std::log10(nH), std::log10(Tgas),
+                                tables.nH_axis, tables.Tgas_axis,
+                                tables.meanMolWeight);
 
   // compute thermal gas energy
   const Real Egas = (rho / (hydrogen_mass_cgs_ * mu)) *
@@ -147,8 +153,13 @@ ComputeEgasFromTgas(double rho, double Tgas, double gamma,
 
 AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
 ComputeTgasFromEgas(double rho, double Egas, double gamma,
-                    cloudyGpuConstTables const &tables) -> Real {
-  // convert Egas (internal gas energy) to temperature
+                    cloudyGpuConstTables const &tables, double T_guess = NAN)
+    -> Real {
+  // convert Egas (internal gas energy) to temperature.
+  // if T_guess is given (e.g. the solution from the previous RHS evaluation
+  // of the cooling ODE), the root find is warm-started with a tight bracket
+  // around it, falling back to the wide physics-based bracket if the root
+  // moved outside it.
 
   // check whether temperature is out-of-bounds
   const Real Tmin_table = 10.;
@@ -182,7 +193,7 @@ ComputeTgasFromEgas(double rho, double Egas, double gamma,
   auto f = [log_nH, C, tables](const Real &T) noexcept {
     // compute new mu from mu(log10 T) table
     Real log_T = clamp(std::log10(T), 1., 9.);
-    Real mu = interpolate2d(log_nH, log_T, tables.log_nH, tables.log_Tgas,
+    Real mu = interpolate2d(log_nH, log_T, tables.nH_axis, tables.Tgas_axis,
                             tables.meanMolWeight);
     Real fun = C * mu - T;
     return fun;
@@ -191,8 +202,20 @@ ComputeTgasFromEgas(double rho, double Egas, double gamma,
   // compute temperature bounds using physics
   const Real mu_min = 0.60; // assuming fully ionized (mu ~ 0.6)
   const Real mu_max = 2.33; // assuming neutral fully molecular (mu ~ 2.33)
-  const Real T_min = std::clamp(C * mu_min, Tmin_table, Tmax_table);
-  const Real T_max = std::clamp(C * mu_max, Tmin_table, Tmax_table);
+  Real T_min = std::clamp(C * mu_min, Tmin_table, Tmax_table);
+  Real T_max = std::clamp(C * mu_max, Tmin_table, Tmax_table);
+
+  // if we have a previous solution, try a tight bracket around it first.
+  // the two extra function evaluations are much cheaper than the ~20
+  // iterations TOMS748 needs to narrow the wide bracket from scratch.
+  if (!std::isnan(T_guess)) {
+    const Real T_lo = std::clamp(T_guess / 1.5, T_min, T_max);
+    const Real T_hi = std::clamp(T_guess * 1.5, T_min, T_max);
+    if ((T_lo < T_hi) && (f(T_lo) * f(T_hi) <= 0.)) {
+      T_min = T_lo;
+      T_max = T_hi;
+    }
+  }
 
   // do root-finding
   quokka::math::eps_tolerance<Real> tol(reltol);
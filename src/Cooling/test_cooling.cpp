@@ -13,6 +13,9 @@
 #include "AMReX_BLProfiler.H"
 #include "AMReX_BLassert.H"
 #include "AMReX_FabArray.H"
+#include "AMReX_GpuAtomic.H"
+#include "AMReX_GpuBuffer.H"
+#include "AMReX_GpuContainers.H"
 #include "AMReX_GpuDevice.H"
 #include "AMReX_MultiFab.H"
 #include "AMReX_ParallelContext.H"
@@ -215,6 +218,7 @@ AMRSimulation<CoolingTest>::setCustomBoundaryConditions(
 struct ODEUserData {
   amrex::Real rho;
   cloudyGpuConstTables tables;
+  amrex::Real T_prev; // previous temperature solution (warm start), or NAN
 };
 
 AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
@@ -225,16 +229,53 @@ user_rhs(Real /*t*/, quokka::valarray<Real, 1> &y_data,
   Real rho = udata->rho;
   cloudyGpuConstTables &tables = udata->tables;
 
-  // compute temperature (implicit solve, depends on composition)
+  // compute temperature (implicit solve, depends on composition), using the
+  // previous solution in this cell to warm-start the root find
   Real Eint = y_data[0];
-  Real T =
-      ComputeTgasFromEgas(rho, Eint, HydroSystem<CoolingTest>::gamma_, tables);
+  Real T = ComputeTgasFromEgas(rho, Eint, HydroSystem<CoolingTest>::gamma_,
+                               tables, udata->T_prev);
+  if (!std::isnan(T)) {
+    udata->T_prev = T;
+  }
 
   // compute cooling function
   y_rhs[0] = cloudy_cooling_function(rho, T, tables);
   return 0;
 }
 
+// integrate the cooling ODE for a single cell, updating the gas energy in
+// place (shared by the per-bin integration kernels below)
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE void
+coolCell(int i, int j, int k, amrex::Array4<Real> const &state, Real const dt,
+         Real const rtol, Real const reltol_floor,
+         cloudyGpuConstTables const &tables) {
+  const Real rho = state(i, j, k, HydroSystem<CoolingTest>::density_index);
+  const Real x1Mom = state(i, j, k, HydroSystem<CoolingTest>::x1Momentum_index);
+  const Real x2Mom = state(i, j, k, HydroSystem<CoolingTest>::x2Momentum_index);
+  const Real x3Mom = state(i, j, k, HydroSystem<CoolingTest>::x3Momentum_index);
+  const Real Egas = state(i, j, k, HydroSystem<CoolingTest>::energy_index);
+
+  Real Eint = RadSystem<CoolingTest>::ComputeEintFromEgas(rho, x1Mom, x2Mom,
+                                                          x3Mom, Egas);
+
+  ODEUserData user_data{rho, tables, NAN};
+  quokka::valarray<Real, 1> y = {Eint};
+  quokka::valarray<Real, 1> abstol = {
+      reltol_floor *
+      ComputeEgasFromTgas(rho, T_floor, HydroSystem<CoolingTest>::gamma_,
+                          tables)};
+
+  // do integration with RK2 (Heun's method)
+  int steps_taken = 0;
+  rk_adaptive_integrate(user_rhs, 0, y, dt, &user_data, rtol, abstol,
+                        steps_taken);
+
+  const Real Egas_new = RadSystem<CoolingTest>::ComputeEgasFromEint(
+      rho, x1Mom, x2Mom, x3Mom, y[0]);
+
+  state(i, j, k, HydroSystem<CoolingTest>::energy_index) = Egas_new;
+}
+
 void computeCooling(amrex::MultiFab &mf, const Real dt_in,
                     cloudy_tables &cloudyTables) {
   BL_PROFILE("RadhydroSimulation::computeCooling()")
@@ -243,12 +284,29 @@ void computeCooling(amrex::MultiFab &mf, const Real dt_in,
   const Real reltol_floor = 0.01;
   const Real rtol = 1.0e-4; // not recommended to change this
 
+  // cells with dt below this multiple of the local cooling time take only a
+  // handful of adaptive steps; integrating them separately from the stiff
+  // cells keeps the adaptive step counts (and hence GPU warp occupancy)
+  // roughly uniform within each kernel
+  const Real stiffnessThreshold = 4.0;
+
   auto tables = cloudyTables.const_tables();
 
   // loop over all cells in MultiFab mf
   for (amrex::MFIter iter(mf); iter.isValid(); ++iter) {
     const amrex::Box &indexRange = iter.validbox();
     auto const &state = mf.array(iter);
+    const auto ncells = static_cast<int>(indexRange.numPts());
+
+    // bin cells by estimated stiffness (dt / tcool). adaptive step counts
+    // vary by orders of magnitude across cells, so a single kernel over the
+    // box leaves most lanes of a warp idle while its stiffest lane finishes.
+    amrex::Gpu::DeviceVector<int> mildCells(ncells);
+    amrex::Gpu::DeviceVector<int> stiffCells(ncells);
+    amrex::Gpu::Buffer<int> binCounts({0, 0});
+    int *const p_mild = mildCells.data();
+    int *const p_stiff = stiffCells.data();
+    int *const p_counts = binCounts.data();
 
     amrex::ParallelFor(indexRange, [=] AMREX_GPU_DEVICE(int i, int j,
                                                         int k) noexcept {
@@ -260,26 +318,38 @@ void computeCooling(amrex::MultiFab &mf, const Real dt_in,
       const Real x3Mom =
           state(i, j, k, HydroSystem<CoolingTest>::x3Momentum_index);
       const Real Egas = state(i, j, k, HydroSystem<CoolingTest>::energy_index);
+      const Real Eint = RadSystem<CoolingTest>::ComputeEintFromEgas(
+          rho, x1Mom, x2Mom, x3Mom, Egas);
+
+      const Real T = ComputeTgasFromEgas(
+          rho, Eint, HydroSystem<CoolingTest>::gamma_, tables);
+      const Real Edot = cloudy_cooling_function(rho, T, tables);
+      const Real tcool = std::abs(Eint / Edot); // +inf where Edot == 0
+
+      const bool isStiff = (dt > stiffnessThreshold * tcool);
+      const int slot =
+          amrex::Gpu::Atomic::Add(&p_counts[isStiff ? 1 : 0], 1);
+      const auto idx = static_cast<int>(
+          indexRange.index(amrex::IntVect{AMREX_D_DECL(i, j, k)}));
+      (isStiff ? p_stiff : p_mild)[slot] = idx;
+    });
 
-      Real Eint = RadSystem<CoolingTest>::ComputeEintFromEgas(rho, x1Mom, x2Mom,
-                                                              x3Mom, Egas);
-
-      ODEUserData user_data{rho, tables};
-      quokka::valarray<Real, 1> y = {Eint};
-      quokka::valarray<Real, 1> abstol = {
-          reltol_floor * ComputeEgasFromTgas(rho, T_floor,
-                                             HydroSystem<CoolingTest>::gamma_,
-                                             tables)};
-
-      // do integration with RK2 (Heun's method)
-      int steps_taken = 0;
-      rk_adaptive_integrate(user_rhs, 0, y, dt, &user_data, rtol, abstol, steps_taken);
-
-      const Real Egas_new = RadSystem<CoolingTest>::ComputeEgasFromEint(
-          rho, x1Mom, x2Mom, x3Mom, y[0]);
+    // synchronizes the device, so the bin lists are complete below
+    int const *const h_counts = binCounts.copyToHost();
+
+    for (int bin = 0; bin < 2; ++bin) {
+      const int *cellList = (bin == 0) ? p_mild : p_stiff;
+      amrex::ParallelFor(
+          h_counts[bin], [=] AMREX_GPU_DEVICE(int n) noexcept {
+            const amrex::Dim3 cell =
+                indexRange.atOffset(cellList[n]).dim3();
+            coolCell(cell.x, cell.y, cell.z, state, dt, rtol, reltol_floor,
+                     tables);
+          });
+    }
 
-      state(i, j, k, HydroSystem<CoolingTest>::energy_index) = Egas_new;
-    });
+    // the bin lists must outlive the integration kernels
+    amrex::Gpu::streamSynchronize();
   }
 }
 
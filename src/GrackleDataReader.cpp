@@ -18,24 +18,22 @@
 / software.
 ************************************************************************/
 
+#include <map>
+
 #include "GrackleDataReader.hpp"
 #include "AMReX_Arena.H"
 #include "AMReX_BLassert.H"
+#include "AMReX_ParallelDescriptor.H"
 #include "AMReX_Print.H"
 #include "AMReX_TableData.H"
 
 static const bool grackle_verbose = true;
 
-void initialize_cloudy_data(cloudy_data &my_cloudy, char const *group_name,
-                            std::string &grackle_data_file,
-                            code_units &my_units) {
-  // Initialize vectors
-  my_cloudy.grid_parameters.resize(CLOUDY_MAX_DIMENSION);
-  my_cloudy.grid_dimension.resize(CLOUDY_MAX_DIMENSION);
-  for (int64_t q = 0; q < CLOUDY_MAX_DIMENSION; q++) {
-    my_cloudy.grid_dimension[q] = 0;
-  }
-
+// read the cooling tables from the HDF5 file into host memory.
+// only called on the I/O rank; everyone else receives a broadcast.
+static void read_cloudy_data(cloudy_data &my_cloudy, char const *group_name,
+                             std::string &grackle_data_file,
+                             code_units &my_units) {
   if (grackle_verbose) {
     amrex::Print() << fmt::format("Initializing Cloudy cooling: {}.\n",
                                   group_name);
@@ -245,6 +243,81 @@ void initialize_cloudy_data(cloudy_data &my_cloudy, char const *group_name,
       "CLOUDY_MAX_DIMENSION");
 }
 
+void initialize_cloudy_data(cloudy_data &my_cloudy, char const *group_name,
+                            std::string &grackle_data_file,
+                            code_units &my_units) {
+  // memoize the loaded tables: the test harnesses construct simulation
+  // objects repeatedly within one process, and re-reading (and
+  // re-broadcasting) an identical table is wasted startup time. the cached
+  // copy shares the underlying heap arrays, which live for the whole process.
+  static std::map<std::string, cloudy_data> cloudy_data_cache;
+  const std::string cache_key =
+      grackle_data_file + "//CoolingRates/" + group_name;
+  auto cached = cloudy_data_cache.find(cache_key);
+  if (cached != cloudy_data_cache.end()) {
+    my_cloudy = cached->second;
+    return;
+  }
+
+  // Initialize vectors
+  my_cloudy.grid_parameters.resize(CLOUDY_MAX_DIMENSION);
+  my_cloudy.grid_dimension.resize(CLOUDY_MAX_DIMENSION);
+  for (int64_t q = 0; q < CLOUDY_MAX_DIMENSION; q++) {
+    my_cloudy.grid_dimension[q] = 0;
+  }
+
+  // only the I/O rank touches the filesystem; opening the same HDF5 file
+  // from every rank simultaneously stampedes the metadata server at scale
+  const int ioRank = amrex::ParallelDescriptor::IOProcessorNumber();
+  if (amrex::ParallelDescriptor::IOProcessor()) {
+    read_cloudy_data(my_cloudy, group_name, grackle_data_file, my_units);
+  }
+
+  // broadcast the table metadata, then the flattened arrays
+  amrex::ParallelDescriptor::Bcast(&my_cloudy.grid_rank, 1, ioRank);
+  amrex::ParallelDescriptor::Bcast(my_cloudy.grid_dimension.data(),
+                                   CLOUDY_MAX_DIMENSION, ioRank);
+  amrex::ParallelDescriptor::Bcast(&my_cloudy.data_size, 1, ioRank);
+
+  const amrex::GpuArray<int, 3> lo{0, 0, 0};
+  const amrex::GpuArray<int, 3> hi{
+      static_cast<int>(my_cloudy.grid_dimension[2]),
+      static_cast<int>(my_cloudy.grid_dimension[1]),
+      static_cast<int>(my_cloudy.grid_dimension[0])};
+
+  if (!amrex::ParallelDescriptor::IOProcessor()) {
+    // allocate receive buffers matching the layout created by the reader
+    for (int64_t q = 0; q < my_cloudy.grid_rank; q++) {
+      my_cloudy.grid_parameters[q] = amrex::Table1D<double>(
+          new double[my_cloudy.grid_dimension[q]], 0,
+          static_cast<int>(my_cloudy.grid_dimension[q]));
+    }
+    my_cloudy.cooling_data =
+        amrex::Table3D<double>(new double[my_cloudy.data_size], lo, hi);
+    my_cloudy.heating_data =
+        amrex::Table3D<double>(new double[my_cloudy.data_size], lo, hi);
+    if (std::string(group_name) == "Primordial") {
+      my_cloudy.mmw_data =
+          amrex::Table3D<double>(new double[my_cloudy.data_size], lo, hi);
+    }
+  }
+
+  for (int64_t q = 0; q < my_cloudy.grid_rank; q++) {
+    amrex::ParallelDescriptor::Bcast(my_cloudy.grid_parameters[q].p,
+                                     my_cloudy.grid_dimension[q], ioRank);
+  }
+  amrex::ParallelDescriptor::Bcast(my_cloudy.cooling_data.p,
+                                   my_cloudy.data_size, ioRank);
+  amrex::ParallelDescriptor::Bcast(my_cloudy.heating_data.p,
+                                   my_cloudy.data_size, ioRank);
+  if (std::string(group_name) == "Primordial") {
+    amrex::ParallelDescriptor::Bcast(my_cloudy.mmw_data.p, my_cloudy.data_size,
+                                     ioRank);
+  }
+
+  cloudy_data_cache[cache_key] = my_cloudy;
+}
+
 auto extract_2d_table(amrex::Table3D<double> const &table3D, int redshift_index)
     -> amrex::TableData<double, 2> {
   // table3d dimensions (F-ordering) are: temperature, redshift, density
@@ -34,6 +34,11 @@ template <> struct EOS_Traits<SedovProblem> {
   static constexpr bool reconstruct_eint = false;
 };
 
+template <> struct Physics_Traits<SedovProblem> {
+  // pure hydro: strip the radiation components from the state layout
+  static constexpr bool is_radiation_enabled = false;
+};
+
 template <>
 void RadhydroSimulation<SedovProblem>::setInitialConditionsAtLevel(int lev) {
   // initialize a Sedov test problem using parameters due to
@@ -182,21 +187,12 @@ void RadhydroSimulation<SedovProblem>::computeAfterEvolve(
       geom[0].CellSizeArray();
   amrex::Real const vol = AMREX_D_TERM(dx0[0], *dx0[1], *dx0[2]);
 
-  amrex::Real const Egas0 =
-      initSumCons[RadSystem<SedovProblem>::gasEnergy_index];
-  amrex::Real const Erad0 =
-      initSumCons[RadSystem<SedovProblem>::radEnergy_index];
-  amrex::Real const Etot0 = Egas0 + (RadSystem<SedovProblem>::c_light_ /
-                                     RadSystem<SedovProblem>::c_hat_) *
-                                        Erad0;
-
-  amrex::Real const Egas =
-      state_new_[0].sum(RadSystem<SedovProblem>::gasEnergy_index) * vol;
-  amrex::Real const Erad =
-      state_new_[0].sum(RadSystem<SedovProblem>::radEnergy_index) * vol;
-  amrex::Real const Etot = Egas + (RadSystem<SedovProblem>::c_light_ /
-                                   RadSystem<SedovProblem>::c_hat_) *
-                                      Erad;
+  // (the radiation components are stripped from this problem's state
+  // layout, so the total energy is just the gas energy)
+  amrex::Real const Etot0 =
+      initSumCons[HydroSystem<SedovProblem>::energy_index];
+  amrex::Real const Etot =
+      state_new_[0].sum(HydroSystem<SedovProblem>::energy_index) * vol;
 
   // compute kinetic energy
   amrex::MultiFab Ekin_mf(boxArray(0), DistributionMap(0), 1, 0);
@@ -216,7 +212,7 @@ void RadhydroSimulation<SedovProblem>::computeAfterEvolve(
   }
   amrex::Real const Ekin = Ekin_mf.sum(0);
 
-  amrex::Real const frac_Ekin = Ekin / Egas;
+  amrex::Real const frac_Ekin = Ekin / Etot;
   amrex::Real const frac_Ekin_exact = 0.218729;
 
   amrex::Real const abs_err = (Etot - Etot0);
@@ -224,8 +220,8 @@ void RadhydroSimulation<SedovProblem>::computeAfterEvolve(
 
   amrex::Real const rel_err_Ekin = frac_Ekin - frac_Ekin_exact;
 
-  amrex::Print() << "\nInitial gas+radiation energy = " << Etot0 << std::endl;
-  amrex::Print() << "Final gas+radiation energy = " << Etot << std::endl;
+  amrex::Print() << "\nInitial gas energy = " << Etot0 << std::endl;
+  amrex::Print() << "Final gas energy = " << Etot << std::endl;
   amrex::Print() << "\tabsolute conservation error = " << abs_err << std::endl;
   amrex::Print() << "\trelative conservation error = " << rel_err << std::endl;
   amrex::Print() << "\tkinetic energy = " << Ekin << std::endl;
@@ -286,8 +282,12 @@ auto problem_main() -> int {
   sim.is_hydro_enabled_ = true;
   sim.is_radiation_enabled_ = false;
   sim.reconstructionOrder_ = 3; // 2=PLM, 3=PPM
+  sim.integratorOrder_ = 3;     // RK3-SSP
   sim.stopTime_ = 1.0;          // seconds
-  sim.cflNumber_ = 0.3;         // *must* be less than 1/3 in 3D!
+  // the SSP coefficient of RK3-SSP is 1, so it has the same monotonicity
+  // bound as forward Euler; where limited PPM degenerates to donor cell,
+  // linear stability at the Nyquist mode in 3D requires CFL <~ 0.42
+  sim.cflNumber_ = 0.4;
   sim.maxTimesteps_ = 20000;
   sim.plotfileInterval_ = -1;
 
@@ -122,7 +122,7 @@ void RadhydroSimulation<ContactProblem>::computeReferenceSolution(
   auto [pos_exact, val_exact] = fextract(ref, geom[0], 0, 0.5);
   auto const nx = position.size();
 
-  if (amrex::ParallelDescriptor::IOProcessor()) {
+  if (quokka::BeginAsyncRender()) {
     std::vector<double> x(nx);
     std::vector<double> d_final(nx);
     std::vector<double> vx_final(nx);
@@ -177,6 +177,7 @@ void RadhydroSimulation<ContactProblem>::computeReferenceSolution(
     matplotlibcpp::legend();
     matplotlibcpp::title(fmt::format("t = {:.4f}", tNew_[0]));
     matplotlibcpp::save("./hydro_contact.pdf");
+    quokka::EndAsyncRender();
   }
 #endif
 }
@@ -0,0 +1,22 @@
+#ifndef TEST_HYDRO_HIGHMACH_HPP_ // NOLINT
+#define TEST_HYDRO_HIGHMACH_HPP_
+//==============================================================================
+// TwoMomentRad - a radiation transport library for patch-based AMR codes
+// Copyright 2020 Benjamin Wibking.
+// Released under the MIT license. See LICENSE file included in the GitHub repo.
+//==============================================================================
+/// \file test_hydro_highmach.hpp
+/// \brief Defines a test problem for high-Mach-number advection with the
+/// dual-energy formalism.
+///
+
+// external headers
+#include <fmt/format.h>
+
+// internal headers
+
+#include "hydro_system.hpp"
+
+// function definitions
+
+#endif // TEST_HYDRO_HIGHMACH_HPP_
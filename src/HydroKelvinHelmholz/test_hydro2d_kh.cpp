@@ -93,32 +93,10 @@ void RadhydroSimulation<KelvinHelmholzProblem>::ErrorEst(
   const amrex::Real eta_threshold = 0.2; // gradient refinement threshold
   const amrex::Real rho_min = 0.1;       // minimum density for refinement
 
-  for (amrex::MFIter mfi(state_new_[lev]); mfi.isValid(); ++mfi) {
-    const amrex::Box &box = mfi.validbox();
-    const auto state = state_new_[lev].const_array(mfi);
-    const auto tag = tags.array(mfi);
-
-    amrex::ParallelFor(box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-      const int n = HydroSystem<KelvinHelmholzProblem>::density_index;
-      amrex::Real const rho = state(i, j, k, n);
-      amrex::Real const rho_xplus = state(i + 1, j, k, n);
-      amrex::Real const rho_xminus = state(i - 1, j, k, n);
-      amrex::Real const rho_yplus = state(i, j + 1, k, n);
-      amrex::Real const rho_yminus = state(i, j - 1, k, n);
-
-      amrex::Real const del_x =
-          std::max(std::abs(rho_xplus - rho), std::abs(rho - rho_xminus));
-      amrex::Real const del_y =
-          std::max(std::abs(rho_yplus - rho), std::abs(rho - rho_yminus));
-
-      amrex::Real const gradient_indicator =
-          std::max(del_x, del_y) / std::max(rho, rho_min);
-
-      if (gradient_indicator > eta_threshold) {
-        tag(i, j, k) = amrex::TagBox::SET;
-      }
-    });
-  }
+  tagCellsByCriteria(
+      lev, tags,
+      quokka::RefineGradient{HydroSystem<KelvinHelmholzProblem>::density_index,
+                             eta_threshold, rho_min});
 }
 
 auto problem_main() -> int {
@@ -45,6 +45,12 @@ template <> struct EOS_Traits<QuirkProblem> {
   static constexpr bool reconstruct_eint = false;
 };
 
+template <> struct Reconstruction_Traits<QuirkProblem> {
+  static constexpr bool branchless = false;
+  static constexpr bool ppm_pencil = false;
+  static constexpr int max_order = 2; // PLM only: 2 ghost cells instead of 4
+};
+
 constexpr Real dl = 3.692;
 constexpr Real ul = -0.625;
 constexpr Real pl = 26.85;
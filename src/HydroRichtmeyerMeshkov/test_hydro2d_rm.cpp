@@ -15,6 +15,7 @@
 #include "AMReX_Print.H"
 
 #include "test_hydro2d_rm.hpp"
+#include "CheckNaN.hpp"
 #include "RadhydroSimulation.hpp"
 #include "hydro_system.hpp"
 
@@ -30,73 +31,29 @@ template <> struct EOS_Traits<RichtmeyerMeshkovProblem> {
 template <> void RadhydroSimulation<RichtmeyerMeshkovProblem>::computeAfterTimestep()
 {
 #ifdef DEBUG_SYMMETRY
-	// this code does not actually work with Nranks > 1 ...
-
-	// copy all FABs to a local FAB across the entire domain
-	amrex::BoxArray localBoxes(domain_);
+	// copy all FABs to a single FAB spanning the entire domain
+	// (the diagonal reflection pairs cells that may live on different grids)
+	amrex::BoxArray localBoxes(geom[0].Domain());
 	amrex::DistributionMapping localDistribution(localBoxes, 1);
 	amrex::MultiFab state_mf(localBoxes, localDistribution, ncomp_, 0);
-	state_mf.ParallelCopy(state_new_);
-
-	if (amrex::ParallelDescriptor::IOProcessor()) {
-		auto const &state = state_mf.array(0);
-		auto const prob_lo = simGeometry_.ProbLoArray();
-		auto dx = dx_;
-
-		amrex::Long asymmetry = 0;
-		auto nx = nx_;
-		auto ny = ny_;
-		auto nz = nz_;
-		auto ncomp = ncomp_;
-		for (int i = 0; i < nx; ++i) {
-			for (int j = 0; j < ny; ++j) {
-				for (int k = 0; k < nz; ++k) {
-					amrex::Real const x =
-					    prob_lo[0] + (i + amrex::Real(0.5)) * dx[0];
-					amrex::Real const y =
-					    prob_lo[1] + (j + amrex::Real(0.5)) * dx[1];
-					for (int n = 0; n < ncomp; ++n) {
-						const amrex::Real comp_upper = state(i, j, k, n);
-
-						// reflect across x/y diagonal
-						int n_lower = n;
-						if (n == HydroSystem<RichtmeyerMeshkovProblem>::
-							     x1Momentum_index) {
-							n_lower =
-							    HydroSystem<RichtmeyerMeshkovProblem>::
-								x2Momentum_index;
-						} else if (n ==
-							   HydroSystem<RichtmeyerMeshkovProblem>::
-							       x2Momentum_index) {
-							n_lower =
-							    HydroSystem<RichtmeyerMeshkovProblem>::
-								x1Momentum_index;
-						}
-
-						amrex::Real comp_lower = state(j, i, k, n_lower);
-
-						const amrex::Real average =
-						    std::fabs(comp_upper + comp_lower);
-						const amrex::Real residual =
-						    std::abs(comp_upper - comp_lower) / average;
-
-						if (comp_upper != comp_lower) {
-							amrex::Print()
-							    << i << ", " << j << ", " << k << ", "
-							    << n << ", " << comp_upper << ", "
-							    << comp_lower << " " << residual
-							    << "\n";
-							amrex::Print() << "x = " << x << "\n";
-							amrex::Print() << "y = " << y << "\n";
-							asymmetry++;
-							AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
-							    false, "x/y not symmetric!");
-						}
-					}
-				}
-			}
+	state_mf.ParallelCopy(state_new_[0]);
+
+	// mirror-compare cells across the x/y diagonal in a single device
+	// reduction on the owning rank, so the check can stay enabled during
+	// real-size runs (a host-side element loop here is ~10x slower)
+	quokka::SwapCompMap const compMap{
+	    HydroSystem<RichtmeyerMeshkovProblem>::x1Momentum_index,
+	    HydroSystem<RichtmeyerMeshkovProblem>::x2Momentum_index};
+
+	for (amrex::MFIter iter(state_mf); iter.isValid(); ++iter) {
+		const amrex::Box &indexRange = iter.validbox();
+		auto const &state = state_mf.const_array(iter);
+		amrex::Long const idx =
+		    quokka::FindFirstAsymmetry(state, state, indexRange, ncomp_, compMap);
+		if (idx >= 0) {
+			quokka::ReportAsymmetry("state", idx, indexRange);
 		}
-		AMREX_ALWAYS_ASSERT_WITH_MESSAGE(asymmetry == 0, "x/y not symmetric!");
+		AMREX_ALWAYS_ASSERT_WITH_MESSAGE(idx < 0, "x/y not symmetric!");
 	}
 #endif
 }
@@ -15,6 +15,7 @@
 #include "test_hydro_sms.hpp"
 #ifdef HAVE_PYTHON
 #include "matplotlibcpp.h"
+#include "AsyncRender.hpp"
 #endif
 
 struct ShocktubeProblem {};
@@ -209,27 +210,30 @@ void RadhydroSimulation<ShocktubeProblem>::computeReferenceSolution(
     }
 
 #ifdef HAVE_PYTHON
-    // Plot results
-    matplotlibcpp::clf();
-    int s = 2; // stride
-    std::map<std::string, std::string> d_args;
-    std::unordered_map<std::string, std::string> dexact_args;
-    d_args["label"] = "simulation";
-    d_args["color"] = "C0";
-    dexact_args["label"] = "exact solution";
-    dexact_args["marker"] = "o";
-    dexact_args["color"] = "C0";
-    // dexact_args["edgecolors"] = "k";
-    matplotlibcpp::plot(xs, d, d_args);
-    matplotlibcpp::scatter(strided_vector_from(xs, s),
-                           strided_vector_from(density_exact, s), 3.0,
-                           dexact_args);
-    matplotlibcpp::legend();
-    matplotlibcpp::xlabel("length x");
-    matplotlibcpp::ylabel("density");
-    matplotlibcpp::tight_layout();
-    // matplotlibcpp::title(fmt::format("t = {:.4f}", tNew_[0]));
-    matplotlibcpp::save(fmt::format("./hydro_sms_{:.4f}.pdf", tNew_[0]));
+    if (quokka::BeginAsyncRender()) {
+      // Plot results
+      matplotlibcpp::clf();
+      int s = 2; // stride
+      std::map<std::string, std::string> d_args;
+      std::unordered_map<std::string, std::string> dexact_args;
+      d_args["label"] = "simulation";
+      d_args["color"] = "C0";
+      dexact_args["label"] = "exact solution";
+      dexact_args["marker"] = "o";
+      dexact_args["color"] = "C0";
+      // dexact_args["edgecolors"] = "k";
+      matplotlibcpp::plot(xs, d, d_args);
+      matplotlibcpp::scatter(strided_vector_from(xs, s),
+                             strided_vector_from(density_exact, s), 3.0,
+                             dexact_args);
+      matplotlibcpp::legend();
+      matplotlibcpp::xlabel("length x");
+      matplotlibcpp::ylabel("density");
+      matplotlibcpp::tight_layout();
+      // matplotlibcpp::title(fmt::format("t = {:.4f}", tNew_[0]));
+      matplotlibcpp::save(fmt::format("./hydro_sms_{:.4f}.pdf", tNew_[0]));
+      quokka::EndAsyncRender();
+    }
 #endif
   }
 }
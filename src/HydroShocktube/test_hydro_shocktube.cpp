@@ -20,6 +20,7 @@
 #include "test_hydro_shocktube.hpp"
 #ifdef HAVE_PYTHON
 #include "matplotlibcpp.h"
+#include "AsyncRender.hpp"
 #endif
 
 struct ShocktubeProblem {};
@@ -228,7 +229,7 @@ void RadhydroSimulation<ShocktubeProblem>::computeReferenceSolution(
   auto [position, values] = fextract(state_new_[0], geom[0], 0, 0.5);
   auto [pos_exact, val_exact] = fextract(ref, geom[0], 0, 0.5);
 
-  if (amrex::ParallelDescriptor::IOProcessor()) {
+  if (quokka::BeginAsyncRender()) {
     std::vector<double> d(nx);
     std::vector<double> vx(nx);
     std::vector<double> P(nx);
@@ -302,6 +303,7 @@ void RadhydroSimulation<ShocktubeProblem>::computeReferenceSolution(
     matplotlibcpp::xlabel("length x");
     matplotlibcpp::tight_layout();
     matplotlibcpp::save(fmt::format("./hydro_shocktube_{:.4f}.pdf", tNew_[0]));
+    quokka::EndAsyncRender();
   }
 #endif
 }
@@ -16,6 +16,7 @@
 #include "test_hydro_shuosher.hpp"
 #ifdef HAVE_PYTHON
 #include "matplotlibcpp.h"
+#include "AsyncRender.hpp"
 #endif
 
 struct ShocktubeProblem {};
@@ -219,7 +220,7 @@ void RadhydroSimulation<ShocktubeProblem>::computeReferenceSolution(
   auto [position, values] = fextract(state_new_[0], geom[0], 0, 0.5);
   auto [pos_exact, val_exact] = fextract(ref, geom[0], 0, 0.5);
 
-  if (amrex::ParallelDescriptor::IOProcessor()) {
+  if (quokka::BeginAsyncRender()) {
     // extract values
     std::vector<double> d(nx);
     std::vector<double> vx(nx);
@@ -262,6 +263,7 @@ void RadhydroSimulation<ShocktubeProblem>::computeReferenceSolution(
     matplotlibcpp::xlabel("length x");
     matplotlibcpp::tight_layout();
     matplotlibcpp::save(fmt::format("./hydro_shuosher.pdf", tNew_[0]));
+    quokka::EndAsyncRender();
   }
 #endif
 }
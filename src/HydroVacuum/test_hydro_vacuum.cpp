@@ -19,6 +19,7 @@
 #include "test_hydro_vacuum.hpp"
 #ifdef HAVE_PYTHON
 #include "matplotlibcpp.h"
+#include "AsyncRender.hpp"
 #endif
 
 struct ShocktubeProblem {};
@@ -220,7 +221,7 @@ void RadhydroSimulation<ShocktubeProblem>::computeReferenceSolution(
   auto [position, values] = fextract(state_new_[0], geom[0], 0, 0.5);
   auto [pos_exact, val_exact] = fextract(ref, geom[0], 0, 0.5);
 
-  if (amrex::ParallelDescriptor::IOProcessor()) {
+  if (quokka::BeginAsyncRender()) {
     // extract values
     std::vector<double> d(nx);
     std::vector<double> vx(nx);
@@ -286,6 +287,7 @@ void RadhydroSimulation<ShocktubeProblem>::computeReferenceSolution(
     // matplotlibcpp::title(fmt::format("t = {:.4f}", tNew_[0]));
     matplotlibcpp::save(
         fmt::format("./hydro_vacuum_eint_{:.4f}.pdf", tNew_[0]));
+    quokka::EndAsyncRender();
   }
 #endif
 }
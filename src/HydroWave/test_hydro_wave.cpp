@@ -137,7 +137,7 @@ auto problem_main() -> int {
 
 #ifdef HAVE_PYTHON
   // plot results
-  if (amrex::ParallelDescriptor::IOProcessor()) {
+  if (quokka::BeginAsyncRender()) {
     // extract values
     std::vector<double> d(nx);
     std::vector<double> vx(nx);
@@ -222,6 +222,7 @@ auto problem_main() -> int {
     matplotlibcpp::legend();
     matplotlibcpp::title(fmt::format("t = {:.4f}", t));
     matplotlibcpp::save(fmt::format("./velocity_{:.4f}.pdf", t));
+    quokka::EndAsyncRender();
   }
 #endif
 
@@ -0,0 +1,58 @@
+#ifndef INTERPOLATE1D_HPP_ // NOLINT
+#define INTERPOLATE1D_HPP_
+//==============================================================================
+// TwoMomentRad - a radiation transport library for patch-based AMR codes
+// Copyright 2020 Benjamin Wibking.
+// Released under the MIT license. See LICENSE file included in the GitHub repo.
+//==============================================================================
+/// \file Interpolate1D.hpp
+/// \brief Defines a device-callable 1D linear table interpolation.
+///
+/// This is the GPU-callable counterpart of interpolate_value() in
+/// interpolate.c, so problem generators can interpolate tabulated initial
+/// conditions from inside device kernels (see
+/// AMRSimulation::setInitialConditionsOnDevice). The table pointers must
+/// point to device-accessible memory (e.g. amrex::Gpu::DeviceVector).
+
+#include <cmath>
+
+#include "AMReX_BLassert.H"
+#include "AMReX_Extension.H"
+#include "AMReX_GpuQualifiers.H"
+
+/// return the linearly-interpolated value of a tabulated function at x.
+/// arr_x must be sorted in ascending order; values of x outside the table
+/// range return NaN (matching interpolate_value() in interpolate.c).
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
+interpolate1d(double x, double const *arr_x, double const *arr_y, int arr_len)
+    -> double {
+  // handle keys outside of the table range first
+  if (x < arr_x[0] || x > arr_x[arr_len - 1]) {
+    return NAN;
+  }
+
+  // find j such that arr_x[j] <= x < arr_x[j + 1] by bisection
+  int jlo = 0;
+  int jhi = arr_len - 1;
+  while (jhi - jlo > 1) {
+    const int jmid = jlo + ((jhi - jlo) >> 1);
+    if (x >= arr_x[jmid]) {
+      jlo = jmid;
+    } else {
+      jhi = jmid;
+    }
+  }
+
+  double y = NAN;
+  if (x == arr_x[jlo]) { // avoid roundoff error (also handles jlo == len - 1)
+    y = arr_y[jlo];
+  } else {
+    const double slope =
+        (arr_y[jlo + 1] - arr_y[jlo]) / (arr_x[jlo + 1] - arr_x[jlo]);
+    y = slope * (x - arr_x[jlo]) + arr_y[jlo];
+  }
+  AMREX_ASSERT(!std::isnan(y));
+  return y;
+}
+
+#endif // INTERPOLATE1D_HPP_
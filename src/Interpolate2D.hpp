@@ -10,14 +10,69 @@
 /// interpolation.
 ///
 
+#include "AMReX_Array.H"
 #include "AMReX_BLassert.H"
 #include "AMReX_TableData.H"
 
+#include "valarray.hpp"
+
+// indices and weights of a bilinear table interpolation, so that several
+// tables sharing the same (x, y) axes can be interpolated from one index
+// search and weight computation
+struct BilinearWeights {
+  int ix;
+  int iy;
+  int iix;
+  int iiy;
+  double w11;
+  double w12;
+  double w21;
+  double w22;
+};
+
+// a uniformly-spaced table axis. precomputing the origin and inverse spacing
+// lets the interpolation index be computed with a single multiply-add,
+// without re-deriving the spacing (and loading the axis array) per lookup.
+struct UniformAxis {
+  double x0;     // coordinate of the first table point
+  double inv_dx; // inverse spacing
+  int begin;     // index of the first table point
+  int n;         // number of table points
+};
+
+// host-side helper to build a UniformAxis from a (uniformly-spaced) table axis
+inline auto makeUniformAxis(amrex::Table1D<const double> const &xv)
+    -> UniformAxis {
+  const int n = xv.end - xv.begin;
+  AMREX_ALWAYS_ASSERT(n >= 2);
+  const double x0 = xv(xv.begin);
+  const double dx = (xv(xv.end - 1) - x0) / static_cast<double>(n - 1);
+  return UniformAxis{x0, 1.0 / dx, xv.begin, n};
+}
+
+// uniform-grid fast path: no axis-array loads, no index search
 AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
-interpolate2d(double x, double y, amrex::Table1D<const double> const &xv,
-              amrex::Table1D<const double> const &yv,
-              amrex::Table2D<const double> const &table) -> double {
-  // return the bilinearly-interpolated value in table
+interpolate2d_weights(double x, double y, UniformAxis const &xax,
+                      UniformAxis const &yax) -> BilinearWeights {
+  const double tx = std::clamp((x - xax.x0) * xax.inv_dx, 0.0,
+                               static_cast<double>(xax.n - 1));
+  const double ty = std::clamp((y - yax.x0) * yax.inv_dx, 0.0,
+                               static_cast<double>(yax.n - 1));
+  const int ix = std::min(static_cast<int>(tx), xax.n - 2);
+  const int iy = std::min(static_cast<int>(ty), yax.n - 2);
+  const double fx = tx - ix;
+  const double fy = ty - iy;
+  return BilinearWeights{xax.begin + ix,     yax.begin + iy,
+                         xax.begin + ix + 1, yax.begin + iy + 1,
+                         (1. - fx) * (1. - fy), (1. - fx) * fy,
+                         fx * (1. - fy),        fx * fy};
+}
+
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
+interpolate2d_weights(double x, double y,
+                      amrex::Table1D<const double> const &xv,
+                      amrex::Table1D<const double> const &yv)
+    -> BilinearWeights {
   // NOTE: table must be uniformly spaced in xv and yv
   double xi = xv(xv.begin);
   double xf = xv(xv.end - 1);
@@ -71,15 +126,81 @@ interpolate2d(double x, double y, amrex::Table1D<const double> const &xv,
     w11 = 1.0;
   }
 
-  double A = table(ix, iy);
-  double B = table(ix, iiy);
-  double C = table(iix, iy);
-  double D = table(iix, iiy);
+  return BilinearWeights{ix, iy, iix, iiy, w11, w12, w21, w22};
+}
+
+// load a table element through the GPU read-only data cache. the tables are
+// never written from device code, but the compiler cannot prove that through
+// the generic pointer inside Table2D, so it will not emit read-only loads on
+// its own. scattered (nH, T) lookups from a warp then at least share cache
+// lines through the texture path instead of thrashing L1.
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
+readOnlyLoad(const double *ptr) -> double {
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return __ldg(ptr);
+#else
+  return *ptr;
+#endif
+}
+
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
+applyBilinearWeights(BilinearWeights const &w,
+                     amrex::Table2D<const double> const &table) -> double {
+  double A = readOnlyLoad(&table(w.ix, w.iy));
+  double B = readOnlyLoad(&table(w.ix, w.iiy));
+  double C = readOnlyLoad(&table(w.iix, w.iy));
+  double D = readOnlyLoad(&table(w.iix, w.iiy));
 
-  double value = w11 * A + w12 * B + w21 * C + w22 * D;
+  double value = w.w11 * A + w.w12 * B + w.w21 * C + w.w22 * D;
   AMREX_ASSERT(!std::isnan(value));
 
   return value;
 }
 
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
+interpolate2d(double x, double y, amrex::Table1D<const double> const &xv,
+              amrex::Table1D<const double> const &yv,
+              amrex::Table2D<const double> const &table) -> double {
+  // return the bilinearly-interpolated value in table
+  return applyBilinearWeights(interpolate2d_weights(x, y, xv, yv), table);
+}
+
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
+interpolate2d(double x, double y, UniformAxis const &xax,
+              UniformAxis const &yax,
+              amrex::Table2D<const double> const &table) -> double {
+  // uniform-grid fast path
+  return applyBilinearWeights(interpolate2d_weights(x, y, xax, yax), table);
+}
+
+// interpolate several tables sharing the same (x, y) axes at once; the index
+// search and weight computation are done once instead of once per table
+template <int N>
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto interpolate2d_multi(
+    double x, double y, amrex::Table1D<const double> const &xv,
+    amrex::Table1D<const double> const &yv,
+    amrex::GpuArray<amrex::Table2D<const double>, N> const &tables)
+    -> quokka::valarray<double, N> {
+  const BilinearWeights w = interpolate2d_weights(x, y, xv, yv);
+  quokka::valarray<double, N> values{};
+  for (int n = 0; n < N; ++n) {
+    values[n] = applyBilinearWeights(w, tables[n]);
+  }
+  return values;
+}
+
+template <int N>
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto interpolate2d_multi(
+    double x, double y, UniformAxis const &xax, UniformAxis const &yax,
+    amrex::GpuArray<amrex::Table2D<const double>, N> const &tables)
+    -> quokka::valarray<double, N> {
+  // uniform-grid fast path
+  const BilinearWeights w = interpolate2d_weights(x, y, xax, yax);
+  quokka::valarray<double, N> values{};
+  for (int n = 0; n < N; ++n) {
+    values[n] = applyBilinearWeights(w, tables[n]);
+  }
+  return values;
+}
+
 #endif // INTERPOLATE2D_HPP_
@@ -61,18 +61,28 @@ template <typename F, int N>
 AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
 rk23_single_step(F &&rhs, Real t0, quokka::valarray<Real, N> const &y, Real dt,
                  quokka::valarray<Real, N> &ynew,
-                 quokka::valarray<Real, N> &yerr, void *user_data) -> int {
+                 quokka::valarray<Real, N> &yerr,
+                 quokka::valarray<Real, N> &fsal, bool have_fsal,
+                 quokka::valarray<Real, N> &fsal_last, void *user_data) -> int {
   // Compute one step of the RK Bogaki-Shampine (2)3 method
   // https://sundials.readthedocs.io/en/latest/arkode/Butcher_link.html#bogacki-shampine-4-2-3
+  //
+  // 'fsal' holds the (unscaled) RHS evaluated at (t0, y); if 'have_fsal' is
+  // set it is reused as stage 1 instead of re-evaluating (it remains valid
+  // for retries of this step, since y is unchanged). On success, 'fsal_last'
+  // holds the last-stage RHS at (t0 + dt, ynew), which is the stage-1 RHS of
+  // the next step (the first-same-as-last property).
 
   // stage 1
-  quokka::valarray<Real, N> k1{};
   quokka::valarray<Real, N> y_arg = y;
-  int ierr = rhs(t0, y_arg, k1, user_data);
-  if (ierr != 0) {
-    return ierr;
+  if (!have_fsal) {
+    int ierr_fsal = rhs(t0, y_arg, fsal, user_data);
+    if (ierr_fsal != 0) {
+      return ierr_fsal;
+    }
   }
-  k1 *= dt;
+  quokka::valarray<Real, N> k1 = dt * fsal;
+  int ierr = 0;
 
   // stage 2
   quokka::valarray<Real, N> k2{};
@@ -92,14 +102,13 @@ rk23_single_step(F &&rhs, Real t0, quokka::valarray<Real, N> const &y, Real dt,
   }
   k3 *= dt;
 
-  // stage 4
-  quokka::valarray<Real, N> k4{};
+  // stage 4 (the RHS at the solution point; becomes stage 1 of the next step)
   y_arg = y + (2. / 9.) * k1 + (1. / 3.) * k2 + (4. / 9.) * k3;
-  ierr = rhs(t0 + dt, y_arg, k4, user_data);
+  ierr = rhs(t0 + dt, y_arg, fsal_last, user_data);
   if (ierr != 0) {
     return ierr;
   }
-  k4 *= dt;
+  quokka::valarray<Real, N> k4 = dt * fsal_last;
 
   ynew = y_arg; // use FSAL (first same as last) property
 
@@ -147,7 +156,11 @@ rk_adaptive_integrate(F &&rhs, Real t0, quokka::valarray<Real, N> &y0, Real t1,
 
   // adaptive timestep controller
   const int maxRetries = 7;
-  const int p = 2; // integration order of (high-order) method
+  const int p = 3; // integration order of (high-order) method
+  // PI controller coefficients
+  // https://sundials.readthedocs.io/en/latest/arkode/Mathematics_link.html#pi-controller
+  const Real kP = 0.8;
+  const Real kI = 0.31;
   const Real eta_max = 20.;
   const Real eta_max_errfail_prevstep = 1.0;
   const Real eta_max_errfail_again = 0.3;
@@ -162,6 +175,16 @@ rk_adaptive_integrate(F &&rhs, Real t0, quokka::valarray<Real, N> &y0, Real t1,
   quokka::valarray<Real, N> yerr{};
   quokka::valarray<Real, N> ynew{};
 
+  // the RHS at (time, y); seeded from the initial-timestep evaluation above
+  // and thereafter carried over from the last stage of each accepted step
+  // (first-same-as-last), so each step costs three RHS evaluations, not four
+  quokka::valarray<Real, N> fsal = ydot0;
+  quokka::valarray<Real, N> fsal_last{};
+  bool have_fsal = !std::isnan(dt_guess);
+
+  // error norm of the previous accepted step (for the PI controller)
+  Real epsilon_prev = 1.0;
+
   bool success = false;
   for (int i = 0; i < maxStepsODEIntegrate; ++i) {
     if ((time + dt) > t1) {
@@ -179,26 +202,35 @@ rk_adaptive_integrate(F &&rhs, Real t0, quokka::valarray<Real, N> &y0, Real t1,
       AMREX_ALWAYS_ASSERT(dt > (hmin * (t1 - t0)));
 
       // compute single step of chosen RK method
-      int ierr = rk12_single_step(rhs, time, y, dt, ynew, yerr, user_data);
+      int ierr = rk23_single_step(rhs, time, y, dt, ynew, yerr, fsal,
+                                  have_fsal, fsal_last, user_data);
 
       Real eta = NAN;
       Real epsilon = NAN;
-      
+
       if (ierr != 0) {
         // function evaluation failed, re-try with smaller timestep
+        // (the stage-1 RHS may not have been recorded, so re-evaluate it)
+        have_fsal = false;
         eta = eta_retry_failed_rhs;
       } else {
-        // function evaluation succeeded
+        // function evaluation succeeded; the stage-1 RHS in 'fsal' remains
+        // valid if this step attempt is rejected below
+        have_fsal = true;
+
         // compute error norm from embedded error estimate
         epsilon = error_norm(y, yerr, reltol, abstol);
 
-        // compute new timestep with 'I' controller
-        // https://sundials.readthedocs.io/en/latest/arkode/Mathematics_link.html#i-controller
-        eta = std::pow(epsilon, -1.0 / static_cast<Real>(p));
+        // compute new timestep with 'PI' controller
+        // https://sundials.readthedocs.io/en/latest/arkode/Mathematics_link.html#pi-controller
+        eta = std::pow(epsilon, -kP / static_cast<Real>(p)) *
+              std::pow(epsilon_prev, kI / static_cast<Real>(p));
 
         if (epsilon < 1.0) { // error passed
           y = ynew;
           time += dt; // increment time
+          fsal = fsal_last; // last-stage RHS is the next step's stage 1
+          epsilon_prev = epsilon;
           if (k == 0) {
             eta = std::min(eta, eta_max); // limit timestep increase
           } else {
@@ -0,0 +1,22 @@
+#ifndef TEST_SCALARS_HPP_ // NOLINT
+#define TEST_SCALARS_HPP_
+//==============================================================================
+// TwoMomentRad - a radiation transport library for patch-based AMR codes
+// Copyright 2020 Benjamin Wibking.
+// Released under the MIT license. See LICENSE file included in the GitHub repo.
+//==============================================================================
+/// \file test_scalars.hpp
+/// \brief Defines a test problem for passive scalar advection across a
+/// contact wave.
+///
+
+// external headers
+#include <fmt/format.h>
+
+// internal headers
+
+#include "hydro_system.hpp"
+
+// function definitions
+
+#endif // TEST_SCALARS_HPP_
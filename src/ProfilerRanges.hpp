@@ -0,0 +1,86 @@
+#ifndef PROFILERRANGES_HPP_ // NOLINT
+#define PROFILERRANGES_HPP_
+//==============================================================================
+// TwoMomentRad - a radiation transport library for patch-based AMR codes
+// Copyright 2020 Benjamin Wibking.
+// Released under the MIT license. See LICENSE file included in the GitHub repo.
+//==============================================================================
+/// \file ProfilerRanges.hpp
+/// \brief NVTX/ROCTX range annotations for vendor profilers.
+///
+/// AMReX's TinyProfiler already emits a plain range per BL_PROFILE region,
+/// but those names carry no AMR metadata, so correlating an Nsight/Omniperf
+/// timeline with a particular level or coarse step means counting kernels by
+/// hand. The QUOKKA_PROFILE_RANGE macro below opens a scoped range whose
+/// payload includes the level and step, e.g. "Hydro::advance [lev=2 step=41]".
+///
+/// The annotations are compiled out entirely unless the build enables them
+/// with -DQUOKKA_ANNOTATE=ON (which defines QUOKKA_ANNOTATE_RANGES and links
+/// the vendor range library), so release builds pay nothing.
+
+#ifdef QUOKKA_ANNOTATE_RANGES
+
+#include <cstdio>
+
+#if defined(AMREX_USE_CUDA)
+#include <nvToolsExt.h>
+#elif defined(AMREX_USE_HIP)
+#include <roctracer/roctx.h>
+#endif
+
+namespace quokka {
+
+/// RAII NVTX/ROCTX range: pushed on construction, popped on scope exit.
+/// Negative level/step values are omitted from the payload.
+class ProfileRange {
+public:
+  explicit ProfileRange(const char *name, int level = -1, int step = -1) {
+    char payload[128];
+    if (level >= 0 && step >= 0) {
+      std::snprintf(payload, sizeof(payload), "%s [lev=%d step=%d]", name,
+                    level, step);
+    } else if (level >= 0) {
+      std::snprintf(payload, sizeof(payload), "%s [lev=%d]", name, level);
+    } else if (step >= 0) {
+      std::snprintf(payload, sizeof(payload), "%s [step=%d]", name, step);
+    } else {
+      std::snprintf(payload, sizeof(payload), "%s", name);
+    }
+#if defined(AMREX_USE_CUDA)
+    nvtxRangePushA(payload);
+#elif defined(AMREX_USE_HIP)
+    roctxRangePush(payload);
+#else
+    (void)payload; // CPU builds: annotations are a no-op
+#endif
+  }
+
+  ~ProfileRange() {
+#if defined(AMREX_USE_CUDA)
+    nvtxRangePop();
+#elif defined(AMREX_USE_HIP)
+    roctxRangePop();
+#endif
+  }
+
+  ProfileRange(ProfileRange const &) = delete;
+  ProfileRange(ProfileRange &&) = delete;
+  auto operator=(ProfileRange const &) -> ProfileRange & = delete;
+  auto operator=(ProfileRange &&) -> ProfileRange & = delete;
+};
+
+} // namespace quokka
+
+// opens a range for the rest of the enclosing scope:
+//   QUOKKA_PROFILE_RANGE("Hydro::advance", lev);
+//   QUOKKA_PROFILE_RANGE("IO::plotfile");
+#define QUOKKA_PROFILE_RANGE(...)                                              \
+  quokka::ProfileRange const quokka_profile_range_scope_(__VA_ARGS__)
+
+#else // !QUOKKA_ANNOTATE_RANGES
+
+#define QUOKKA_PROFILE_RANGE(...) ((void)0)
+
+#endif // QUOKKA_ANNOTATE_RANGES
+
+#endif // PROFILERRANGES_HPP_
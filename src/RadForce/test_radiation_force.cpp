@@ -12,6 +12,8 @@
 #include "AMReX.H"
 #include "AMReX_BC_TYPES.H"
 #include "AMReX_BLassert.H"
+#include "AMReX_GpuContainers.H"
+#include "AMReX_GpuDevice.H"
 #include "AMReX_REAL.H"
 
 #include "RadhydroSimulation.hpp"
@@ -20,11 +22,10 @@
 #include "radiation_system.hpp"
 #include "test_radiation_force.hpp"
 #include "ArrayUtil.hpp"
-extern "C" {
-#include "interpolate.h"
-}
+#include "Interpolate1D.hpp"
 #ifdef HAVE_PYTHON
 #include "matplotlibcpp.h"
+#include "AsyncRender.hpp"
 #endif
 
 struct TubeProblem {};
@@ -102,46 +103,52 @@ void RadhydroSimulation<TubeProblem>::setInitialConditionsAtLevel(int lev) {
     Mach_arr.push_back(Mach);
   }
 
-  // set initial conditions
-  amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx = geom[lev].CellSizeArray();
-  amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> prob_lo =
-      geom[lev].ProbLoArray();
-
-  for (amrex::MFIter iter(state_old_[lev]); iter.isValid(); ++iter) {
-    const amrex::Box &indexRange = iter.validbox(); // excludes ghost zones
-    auto const &state = state_new_[lev].array(iter);
-
-    amrex::LoopConcurrentOnCpu(indexRange, [=](int i, int j, int k) noexcept {
-      amrex::Real const x = (prob_lo[0] + (i + amrex::Real(0.5)) * dx[0]) / Lx;
-      amrex::Real const D =
-          interpolate_value(x, x_arr.dataPtr(), rho_arr.dataPtr(),
-                            static_cast<int>(x_arr.size()));
-      AMREX_ALWAYS_ASSERT(D > 0.);
-
-      amrex::Real const Mach =
-          interpolate_value(x, x_arr.dataPtr(), Mach_arr.dataPtr(),
-                            static_cast<int>(x_arr.size()));
-      AMREX_ALWAYS_ASSERT(!std::isnan(Mach));
-
-      amrex::Real const rho = D * rho0;
-      amrex::Real const vel = Mach * a0;
-
-      state(i, j, k, RadSystem<TubeProblem>::radEnergy_index) =
-          Frad0 / c_light_cgs_;
-      state(i, j, k, RadSystem<TubeProblem>::x1RadFlux_index) = Frad0;
-      state(i, j, k, RadSystem<TubeProblem>::x2RadFlux_index) = 0;
-      state(i, j, k, RadSystem<TubeProblem>::x3RadFlux_index) = 0;
-
-      state(i, j, k, RadSystem<TubeProblem>::gasDensity_index) = rho;
-      state(i, j, k, RadSystem<TubeProblem>::x1GasMomentum_index) = rho * vel;
-      state(i, j, k, RadSystem<TubeProblem>::x2GasMomentum_index) = 0;
-      state(i, j, k, RadSystem<TubeProblem>::x3GasMomentum_index) = 0;
-      state(i, j, k, RadSystem<TubeProblem>::gasEnergy_index) = 0;
-    });
-  }
+  // copy the tables to device memory so initialization can run on the GPU
+  amrex::Gpu::DeviceVector<double> x_dev(x_arr.size());
+  amrex::Gpu::DeviceVector<double> rho_dev(rho_arr.size());
+  amrex::Gpu::DeviceVector<double> Mach_dev(Mach_arr.size());
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, x_arr.begin(), x_arr.end(),
+                        x_dev.begin());
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, rho_arr.begin(),
+                        rho_arr.end(), rho_dev.begin());
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, Mach_arr.begin(),
+                        Mach_arr.end(), Mach_dev.begin());
+  amrex::Gpu::streamSynchronize();
+
+  double const *x_ptr = x_dev.dataPtr();
+  double const *rho_ptr = rho_dev.dataPtr();
+  double const *Mach_ptr = Mach_dev.dataPtr();
+  const int x_size = static_cast<int>(x_dev.size());
 
-  // set flag
-  areInitialConditionsDefined_ = true;
+  // set initial conditions
+  setInitialConditionsOnDevice(
+      lev, [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                amrex::Array4<amrex::Real> const &state,
+                                amrex::GeometryData const &geomData) {
+        amrex::Real const x =
+            (geomData.ProbLo(0) + (i + amrex::Real(0.5)) * geomData.CellSize(0)) /
+            Lx;
+        amrex::Real const D = interpolate1d(x, x_ptr, rho_ptr, x_size);
+        AMREX_ALWAYS_ASSERT(D > 0.);
+
+        amrex::Real const Mach = interpolate1d(x, x_ptr, Mach_ptr, x_size);
+        AMREX_ALWAYS_ASSERT(!std::isnan(Mach));
+
+        amrex::Real const rho = D * rho0;
+        amrex::Real const vel = Mach * a0;
+
+        state(i, j, k, RadSystem<TubeProblem>::radEnergy_index) =
+            Frad0 / c_light_cgs_;
+        state(i, j, k, RadSystem<TubeProblem>::x1RadFlux_index) = Frad0;
+        state(i, j, k, RadSystem<TubeProblem>::x2RadFlux_index) = 0;
+        state(i, j, k, RadSystem<TubeProblem>::x3RadFlux_index) = 0;
+
+        state(i, j, k, RadSystem<TubeProblem>::gasDensity_index) = rho;
+        state(i, j, k, RadSystem<TubeProblem>::x1GasMomentum_index) = rho * vel;
+        state(i, j, k, RadSystem<TubeProblem>::x2GasMomentum_index) = 0;
+        state(i, j, k, RadSystem<TubeProblem>::x3GasMomentum_index) = 0;
+        state(i, j, k, RadSystem<TubeProblem>::gasEnergy_index) = 0;
+      });
 }
 
 template <>
@@ -289,39 +296,42 @@ auto problem_main() -> int {
   amrex::Print() << "Relative L1 norm = " << rel_err_norm << std::endl;
 
 #ifdef HAVE_PYTHON
-  // Plot density
-  std::map<std::string, std::string> rho_args;
-  std::unordered_map<std::string, std::string> rhoexact_args;
-  rho_args["label"] = "simulation";
-  rhoexact_args["label"] = "exact solution";
-  matplotlibcpp::plot(xs, rho_arr, rho_args);
-  matplotlibcpp::scatter(xs, rho_exact_arr, 1.0, rhoexact_args);
-  matplotlibcpp::legend();
-  matplotlibcpp::title(fmt::format("t = {:.4g} s", sim.tNew_[0]));
-  matplotlibcpp::xlabel("x (cm)");
-  matplotlibcpp::ylabel("density");
-  matplotlibcpp::tight_layout();
-  matplotlibcpp::save("./radiation_force_tube.pdf");
-
-  // plot velocity
-  int s = 4; // stride
-  std::map<std::string, std::string> vx_args;
-  std::unordered_map<std::string, std::string> vxexact_args;
-  vxexact_args["label"] = "exact solution";
-  vx_args["label"] = "simulation";
-  vx_args["color"] = "C3";
-  vxexact_args["color"] = "C3";
-  vxexact_args["marker"] = "o";
-  //vxexact_args["edgecolors"] = "k";
-  matplotlibcpp::clf();
-  matplotlibcpp::plot(xs, vx_arr, vx_args);
-  matplotlibcpp::scatter(strided_vector_from(xs, s), strided_vector_from(vx_exact_arr, s), 10.0, vxexact_args);
-  matplotlibcpp::legend();
-  //matplotlibcpp::title(fmt::format("t = {:.4g} s", sim.tNew_[0]));
-  matplotlibcpp::xlabel("length x (cm)");
-  matplotlibcpp::ylabel("Mach number");
-  matplotlibcpp::tight_layout();
-  matplotlibcpp::save("./radiation_force_tube_vel.pdf");
+  if (quokka::BeginAsyncRender()) {
+    // Plot density
+    std::map<std::string, std::string> rho_args;
+    std::unordered_map<std::string, std::string> rhoexact_args;
+    rho_args["label"] = "simulation";
+    rhoexact_args["label"] = "exact solution";
+    matplotlibcpp::plot(xs, rho_arr, rho_args);
+    matplotlibcpp::scatter(xs, rho_exact_arr, 1.0, rhoexact_args);
+    matplotlibcpp::legend();
+    matplotlibcpp::title(fmt::format("t = {:.4g} s", sim.tNew_[0]));
+    matplotlibcpp::xlabel("x (cm)");
+    matplotlibcpp::ylabel("density");
+    matplotlibcpp::tight_layout();
+    matplotlibcpp::save("./radiation_force_tube.pdf");
+
+    // plot velocity
+    int s = 4; // stride
+    std::map<std::string, std::string> vx_args;
+    std::unordered_map<std::string, std::string> vxexact_args;
+    vxexact_args["label"] = "exact solution";
+    vx_args["label"] = "simulation";
+    vx_args["color"] = "C3";
+    vxexact_args["color"] = "C3";
+    vxexact_args["marker"] = "o";
+    //vxexact_args["edgecolors"] = "k";
+    matplotlibcpp::clf();
+    matplotlibcpp::plot(xs, vx_arr, vx_args);
+    matplotlibcpp::scatter(strided_vector_from(xs, s), strided_vector_from(vx_exact_arr, s), 10.0, vxexact_args);
+    matplotlibcpp::legend();
+    //matplotlibcpp::title(fmt::format("t = {:.4g} s", sim.tNew_[0]));
+    matplotlibcpp::xlabel("length x (cm)");
+    matplotlibcpp::ylabel("Mach number");
+    matplotlibcpp::tight_layout();
+    matplotlibcpp::save("./radiation_force_tube_vel.pdf");
+    quokka::EndAsyncRender();
+  }
 #endif // HAVE_PYTHON
 
   // Cleanup and exit
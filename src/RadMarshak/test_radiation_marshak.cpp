@@ -309,45 +309,48 @@ auto problem_main() -> int
 
 #ifdef HAVE_PYTHON
 
-		// plot results
-
-		// radiation temperature
-		std::map<std::string, std::string> Trad_args;
-		Trad_args["label"] = "radiation temperature";
-		matplotlibcpp::plot(xs, Trad, Trad_args);
-
-		std::map<std::string, std::string> Trad_exact_args;
-		Trad_exact_args["label"] = "radiation temperature (exact)";
-		matplotlibcpp::plot(xs_exact, Trad_exact, Trad_exact_args);
-
-		matplotlibcpp::xlabel("length x (dimensionless)");
-		matplotlibcpp::ylabel("temperature (dimensionless)");
-		matplotlibcpp::xlim(0.4, 100.); // dimensionless
-		matplotlibcpp::ylim(0.0, 1.0);	// dimensionless
-		matplotlibcpp::xscale("log");
-		matplotlibcpp::legend();
-		matplotlibcpp::title(fmt::format("time t = {:.4g}", sim.tNew_[0]));
-		matplotlibcpp::save("./marshak_wave_temperature.pdf");
-
-		// material temperature
-		matplotlibcpp::clf();
-
-		std::map<std::string, std::string> Tgas_args;
-		Tgas_args["label"] = "gas temperature";
-		matplotlibcpp::plot(xs, Tgas, Tgas_args);
-
-		std::map<std::string, std::string> Tgas_exact_args;
-		Tgas_exact_args["label"] = "gas temperature (exact)";
-		matplotlibcpp::plot(xs_exact, Tmat_exact, Tgas_exact_args);
-
-		matplotlibcpp::xlabel("length x (dimensionless)");
-		matplotlibcpp::ylabel("temperature (dimensionless)");
-		matplotlibcpp::xlim(0.4, 100.); // dimensionless
-		matplotlibcpp::ylim(0.0, 1.0);	// dimensionless
-		matplotlibcpp::xscale("log");
-		matplotlibcpp::legend();
-		matplotlibcpp::title(fmt::format("time t = {:.4g}", sim.tNew_[0]));
-		matplotlibcpp::save("./marshak_wave_gastemperature.pdf");
+		if (quokka::BeginAsyncRender()) {
+			// plot results
+
+			// radiation temperature
+			std::map<std::string, std::string> Trad_args;
+			Trad_args["label"] = "radiation temperature";
+			matplotlibcpp::plot(xs, Trad, Trad_args);
+
+			std::map<std::string, std::string> Trad_exact_args;
+			Trad_exact_args["label"] = "radiation temperature (exact)";
+			matplotlibcpp::plot(xs_exact, Trad_exact, Trad_exact_args);
+
+			matplotlibcpp::xlabel("length x (dimensionless)");
+			matplotlibcpp::ylabel("temperature (dimensionless)");
+			matplotlibcpp::xlim(0.4, 100.); // dimensionless
+			matplotlibcpp::ylim(0.0, 1.0);	// dimensionless
+			matplotlibcpp::xscale("log");
+			matplotlibcpp::legend();
+			matplotlibcpp::title(fmt::format("time t = {:.4g}", sim.tNew_[0]));
+			matplotlibcpp::save("./marshak_wave_temperature.pdf");
+
+			// material temperature
+			matplotlibcpp::clf();
+
+			std::map<std::string, std::string> Tgas_args;
+			Tgas_args["label"] = "gas temperature";
+			matplotlibcpp::plot(xs, Tgas, Tgas_args);
+
+			std::map<std::string, std::string> Tgas_exact_args;
+			Tgas_exact_args["label"] = "gas temperature (exact)";
+			matplotlibcpp::plot(xs_exact, Tmat_exact, Tgas_exact_args);
+
+			matplotlibcpp::xlabel("length x (dimensionless)");
+			matplotlibcpp::ylabel("temperature (dimensionless)");
+			matplotlibcpp::xlim(0.4, 100.); // dimensionless
+			matplotlibcpp::ylim(0.0, 1.0);	// dimensionless
+			matplotlibcpp::xscale("log");
+			matplotlibcpp::legend();
+			matplotlibcpp::title(fmt::format("time t = {:.4g}", sim.tNew_[0]));
+			matplotlibcpp::save("./marshak_wave_gastemperature.pdf");
+			quokka::EndAsyncRender();
+		}
 #endif
 
 	}
@@ -326,24 +326,27 @@ auto problem_main() -> int {
   amrex::Print() << "Relative L1 error norm = " << rel_error << std::endl;
 
 #ifdef HAVE_PYTHON
-  // plot results
-  matplotlibcpp::clf();
-  std::map<std::string, std::string> Tgas_args;
-  std::map<std::string, std::string> Tgas_exact_args;
-  Tgas_args["label"] = "gas temperature";
-  Tgas_args["marker"] = ".";
-  Tgas_exact_args["label"] = "gas temperature (exact)";
-  Tgas_exact_args["marker"] = "x";
-  matplotlibcpp::plot(xs, Tgas_keV, Tgas_args);
-  matplotlibcpp::plot(xs_exact, Tmat_exact, Tgas_exact_args);
-
-  matplotlibcpp::ylim(0.0, 1.0);  // keV
-  matplotlibcpp::xlim(0.0, 0.55); // cm
-  matplotlibcpp::xlabel("length x (cm)");
-  matplotlibcpp::ylabel("temperature (keV)");
-  matplotlibcpp::legend();
-  matplotlibcpp::title(fmt::format("time t = {:.4g}", sim.tNew_[0]));
-  matplotlibcpp::save("./marshak_wave_asymptotic_gastemperature.pdf");
+  if (quokka::BeginAsyncRender()) {
+    // plot results
+    matplotlibcpp::clf();
+    std::map<std::string, std::string> Tgas_args;
+    std::map<std::string, std::string> Tgas_exact_args;
+    Tgas_args["label"] = "gas temperature";
+    Tgas_args["marker"] = ".";
+    Tgas_exact_args["label"] = "gas temperature (exact)";
+    Tgas_exact_args["marker"] = "x";
+    matplotlibcpp::plot(xs, Tgas_keV, Tgas_args);
+    matplotlibcpp::plot(xs_exact, Tmat_exact, Tgas_exact_args);
+
+    matplotlibcpp::ylim(0.0, 1.0);  // keV
+    matplotlibcpp::xlim(0.0, 0.55); // cm
+    matplotlibcpp::xlabel("length x (cm)");
+    matplotlibcpp::ylabel("temperature (keV)");
+    matplotlibcpp::legend();
+    matplotlibcpp::title(fmt::format("time t = {:.4g}", sim.tNew_[0]));
+    matplotlibcpp::save("./marshak_wave_asymptotic_gastemperature.pdf");
+    quokka::EndAsyncRender();
+  }
 #endif // HAVE_PYTHON
 
   // Cleanup and exit
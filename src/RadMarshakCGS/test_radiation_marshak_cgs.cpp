@@ -17,6 +17,7 @@
 #include "test_radiation_marshak_cgs.hpp"
 #ifdef HAVE_PYTHON
 #include "matplotlibcpp.h"
+#include "AsyncRender.hpp"
 #endif
 
 struct SuOlsonProblemCgs {
@@ -41,6 +42,7 @@ template <> struct RadSystem_Traits<SuOlsonProblemCgs> {
 	static constexpr double gamma = 5. / 3.;
 	static constexpr double Erad_floor = 0.;
 	static constexpr bool compute_v_over_c_terms = true;
+	static constexpr bool temperature_independent_opacity = true;
 };
 
 template <>
@@ -319,42 +321,45 @@ auto problem_main() -> int
 		}
 
 #ifdef HAVE_PYTHON
-		// plot results
-
-		// radiation temperature
-		std::map<std::string, std::string> Trad_args;
-		Trad_args["label"] = "radiation temperature";
-		Trad_args["color"] = "C1";
-		matplotlibcpp::plot(xs, Trad, Trad_args);
-
-		std::unordered_map<std::string, std::string> Trad_exact_args;
-		Trad_exact_args["marker"] = "o";
-		Trad_exact_args["color"] = "C1";
-		//Trad_exact_args["edgecolors"] = "k";
-		matplotlibcpp::scatter(xs_exact, Trad_exact, 5.0, Trad_exact_args);
-
-		// gas temperature
-		std::map<std::string, std::string> Tgas_args;
-		Tgas_args["label"] = "gas temperature";
-		Tgas_args["color"] = "C2";
-		matplotlibcpp::plot(xs, Tgas, Tgas_args);
-
-		std::unordered_map<std::string, std::string> Tgas_exact_args;
-		Tgas_exact_args["marker"] = "o";
-		Tgas_exact_args["color"] = "C2";
-		//Tgas_exact_args["edgecolors"] = "k";
-		matplotlibcpp::scatter(xs_exact, Tmat_exact, 5.0, Tgas_exact_args);
-
-		matplotlibcpp::xlabel("length x (cm)");
-		matplotlibcpp::ylabel("temperature (Kelvins)");
-		matplotlibcpp::xlim(0.4 / chi, 100. / chi);	  // cm
-		matplotlibcpp::ylim(0.1 * T_initial, T_hohlraum); // K
-		matplotlibcpp::xscale("log");
-		//matplotlibcpp::yscale("log");
-		matplotlibcpp::legend();
-		matplotlibcpp::tight_layout();
-		//matplotlibcpp::title(fmt::format("time t = {:.4g}", sim.tNew_[0]));
-		matplotlibcpp::save("./marshak_wave_cgs_gastemperature.pdf");
+		if (quokka::BeginAsyncRender()) {
+			// plot results
+
+			// radiation temperature
+			std::map<std::string, std::string> Trad_args;
+			Trad_args["label"] = "radiation temperature";
+			Trad_args["color"] = "C1";
+			matplotlibcpp::plot(xs, Trad, Trad_args);
+
+			std::unordered_map<std::string, std::string> Trad_exact_args;
+			Trad_exact_args["marker"] = "o";
+			Trad_exact_args["color"] = "C1";
+			//Trad_exact_args["edgecolors"] = "k";
+			matplotlibcpp::scatter(xs_exact, Trad_exact, 5.0, Trad_exact_args);
+
+			// gas temperature
+			std::map<std::string, std::string> Tgas_args;
+			Tgas_args["label"] = "gas temperature";
+			Tgas_args["color"] = "C2";
+			matplotlibcpp::plot(xs, Tgas, Tgas_args);
+
+			std::unordered_map<std::string, std::string> Tgas_exact_args;
+			Tgas_exact_args["marker"] = "o";
+			Tgas_exact_args["color"] = "C2";
+			//Tgas_exact_args["edgecolors"] = "k";
+			matplotlibcpp::scatter(xs_exact, Tmat_exact, 5.0, Tgas_exact_args);
+
+			matplotlibcpp::xlabel("length x (cm)");
+			matplotlibcpp::ylabel("temperature (Kelvins)");
+			matplotlibcpp::xlim(0.4 / chi, 100. / chi);	  // cm
+			matplotlibcpp::ylim(0.1 * T_initial, T_hohlraum); // K
+			matplotlibcpp::xscale("log");
+			//matplotlibcpp::yscale("log");
+			matplotlibcpp::legend();
+			matplotlibcpp::tight_layout();
+			//matplotlibcpp::title(fmt::format("time t = {:.4g}", sim.tNew_[0]));
+			matplotlibcpp::save("./marshak_wave_cgs_gastemperature.pdf");
+			quokka::EndAsyncRender();
+		}
 #endif
 
 	}
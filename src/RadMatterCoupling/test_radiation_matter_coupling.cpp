@@ -33,6 +33,7 @@ template <> struct RadSystem_Traits<CouplingProblem> {
   static constexpr double gamma = 5. / 3.;
   static constexpr double Erad_floor = 0.;
 	static constexpr bool compute_v_over_c_terms = true;
+  static constexpr bool temperature_independent_opacity = true;
 };
 
 template <>
@@ -224,48 +225,51 @@ auto problem_main() -> int {
 
 #ifdef HAVE_PYTHON
 
-    // Plot results
-    std::vector<double> &Tgas = sim.Tgas_vec_;
-    std::vector<double> &Trad = sim.Trad_vec_;
-    std::vector<double> &t = sim.t_vec_;
-
-    matplotlibcpp::clf();
-    matplotlibcpp::yscale("log");
-    matplotlibcpp::xscale("log");
-    matplotlibcpp::ylim(0.1 * std::min(Tgas.front(), Trad.front()),
-                        10.0 * std::max(Trad.back(), Tgas.back()));
-
-    std::map<std::string, std::string> Trad_args;
-    Trad_args["label"] = "radiation temperature (numerical)";
-    matplotlibcpp::plot(t, Trad, Trad_args);
-
-    std::map<std::string, std::string> Tgas_args;
-    Tgas_args["label"] = "gas temperature (numerical)";
-    matplotlibcpp::plot(t, Tgas, Tgas_args);
-
-    std::map<std::string, std::string> exactsol_args;
-    exactsol_args["label"] = "gas temperature (exact)";
-    exactsol_args["linestyle"] = "--";
-    exactsol_args["color"] = "black";
-    matplotlibcpp::plot(t, Tgas_exact_interp, exactsol_args);
-
-    matplotlibcpp::legend();
-    matplotlibcpp::xlabel("time t (s)");
-    matplotlibcpp::ylabel("temperature T (K)");
-    // matplotlibcpp::title(
-    //    fmt::format("dt = {:.4g}\nt = {:.4g}", constant_dt, sim.tNew_));
-    matplotlibcpp::save(fmt::format("./radcoupling.pdf"));
-
-    matplotlibcpp::clf();
-
-    std::vector<double> frac_err(t.size());
-    for (int i = 0; i < t.size(); ++i) {
-      frac_err.at(i) = Tgas_exact_interp.at(i) / Tgas.at(i) - 1.0;
+    if (quokka::BeginAsyncRender()) {
+      // Plot results
+      std::vector<double> &Tgas = sim.Tgas_vec_;
+      std::vector<double> &Trad = sim.Trad_vec_;
+      std::vector<double> &t = sim.t_vec_;
+
+      matplotlibcpp::clf();
+      matplotlibcpp::yscale("log");
+      matplotlibcpp::xscale("log");
+      matplotlibcpp::ylim(0.1 * std::min(Tgas.front(), Trad.front()),
+                          10.0 * std::max(Trad.back(), Tgas.back()));
+
+      std::map<std::string, std::string> Trad_args;
+      Trad_args["label"] = "radiation temperature (numerical)";
+      matplotlibcpp::plot(t, Trad, Trad_args);
+
+      std::map<std::string, std::string> Tgas_args;
+      Tgas_args["label"] = "gas temperature (numerical)";
+      matplotlibcpp::plot(t, Tgas, Tgas_args);
+
+      std::map<std::string, std::string> exactsol_args;
+      exactsol_args["label"] = "gas temperature (exact)";
+      exactsol_args["linestyle"] = "--";
+      exactsol_args["color"] = "black";
+      matplotlibcpp::plot(t, Tgas_exact_interp, exactsol_args);
+
+      matplotlibcpp::legend();
+      matplotlibcpp::xlabel("time t (s)");
+      matplotlibcpp::ylabel("temperature T (K)");
+      // matplotlibcpp::title(
+      //    fmt::format("dt = {:.4g}\nt = {:.4g}", constant_dt, sim.tNew_));
+      matplotlibcpp::save(fmt::format("./radcoupling.pdf"));
+
+      matplotlibcpp::clf();
+
+      std::vector<double> frac_err(t.size());
+      for (int i = 0; i < t.size(); ++i) {
+        frac_err.at(i) = Tgas_exact_interp.at(i) / Tgas.at(i) - 1.0;
+      }
+      matplotlibcpp::plot(t, frac_err);
+      matplotlibcpp::xlabel("time t (s)");
+      matplotlibcpp::ylabel("fractional error in material temperature");
+      matplotlibcpp::save(fmt::format("./radcoupling_fractional_error.pdf"));
+      quokka::EndAsyncRender();
     }
-    matplotlibcpp::plot(t, frac_err);
-    matplotlibcpp::xlabel("time t (s)");
-    matplotlibcpp::ylabel("fractional error in material temperature");
-    matplotlibcpp::save(fmt::format("./radcoupling_fractional_error.pdf"));
 #endif
   }
 
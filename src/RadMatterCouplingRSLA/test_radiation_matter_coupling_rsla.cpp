@@ -13,6 +13,7 @@
 #include "radiation_system.hpp"
 #ifdef HAVE_PYTHON
 #include "matplotlibcpp.h"
+#include "AsyncRender.hpp"
 #endif
 
 struct CouplingProblem {
@@ -35,6 +36,8 @@ template <> struct RadSystem_Traits<CouplingProblem> {
   static constexpr double gamma = 5. / 3.;
   static constexpr double Erad_floor = 0.;
 	static constexpr bool compute_v_over_c_terms = true;
+  static constexpr bool temperature_independent_opacity = true;
+  static constexpr bool fast_closure = true; // closure error ~5e-5 is fine here
 };
 
 template <>
@@ -238,49 +241,52 @@ auto problem_main() -> int {
     }
 
 #ifdef HAVE_PYTHON
-    std::vector<double> &Trad = sim.Trad_vec_;
-
-    // Plot results
-    matplotlibcpp::clf();
-    matplotlibcpp::yscale("log");
-    matplotlibcpp::xscale("log");
-    matplotlibcpp::ylim(0.5 * std::min(Tgas.front(), Trad.front()),
-                        4.0 * std::max(Trad.back(), Tgas.back()));
-
-    std::map<std::string, std::string> rsla_args;
-    rsla_args["label"] = "simulated gas temperature (RSLA)";
-    rsla_args["linestyle"] = "-";
-    rsla_args["color"] = "C2";
-    matplotlibcpp::plot(t, Tgas, rsla_args);
-
-    //std::map<std::string, std::string> exactsolrsla_args;
-    //exactsolrsla_args["label"] = "gas temperature (exact, RSLA)";
-    //exactsolrsla_args["linestyle"] = "--";
-    //exactsolrsla_args["color"] = "C2";
-    //matplotlibcpp::plot(t, Tgas_rsla_exact, exactsolrsla_args);
-
-    std::map<std::string, std::string> exactsol_args;
-    exactsol_args["label"] = "exact gas temperature (no RSLA)";
-    exactsol_args["linestyle"] = "--";
-    exactsol_args["color"] = "C2";
-    matplotlibcpp::plot(t, Tgas_exact, exactsol_args);
-
-    matplotlibcpp::legend();
-    matplotlibcpp::xlabel("time t (seconds)");
-    matplotlibcpp::ylabel("temperature T (Kelvins)");
-    matplotlibcpp::tight_layout();
-    matplotlibcpp::save(fmt::format("./radcoupling_rsla.pdf"));
-
-    matplotlibcpp::clf();
-
-    std::vector<double> frac_err(t.size());
-    for (int i = 0; i < t.size(); ++i) {
-      frac_err.at(i) = Tgas_rsla_exact.at(i) / Tgas.at(i) - 1.0;
+    if (quokka::BeginAsyncRender()) {
+      std::vector<double> &Trad = sim.Trad_vec_;
+
+      // Plot results
+      matplotlibcpp::clf();
+      matplotlibcpp::yscale("log");
+      matplotlibcpp::xscale("log");
+      matplotlibcpp::ylim(0.5 * std::min(Tgas.front(), Trad.front()),
+                          4.0 * std::max(Trad.back(), Tgas.back()));
+
+      std::map<std::string, std::string> rsla_args;
+      rsla_args["label"] = "simulated gas temperature (RSLA)";
+      rsla_args["linestyle"] = "-";
+      rsla_args["color"] = "C2";
+      matplotlibcpp::plot(t, Tgas, rsla_args);
+
+      //std::map<std::string, std::string> exactsolrsla_args;
+      //exactsolrsla_args["label"] = "gas temperature (exact, RSLA)";
+      //exactsolrsla_args["linestyle"] = "--";
+      //exactsolrsla_args["color"] = "C2";
+      //matplotlibcpp::plot(t, Tgas_rsla_exact, exactsolrsla_args);
+
+      std::map<std::string, std::string> exactsol_args;
+      exactsol_args["label"] = "exact gas temperature (no RSLA)";
+      exactsol_args["linestyle"] = "--";
+      exactsol_args["color"] = "C2";
+      matplotlibcpp::plot(t, Tgas_exact, exactsol_args);
+
+      matplotlibcpp::legend();
+      matplotlibcpp::xlabel("time t (seconds)");
+      matplotlibcpp::ylabel("temperature T (Kelvins)");
+      matplotlibcpp::tight_layout();
+      matplotlibcpp::save(fmt::format("./radcoupling_rsla.pdf"));
+
+      matplotlibcpp::clf();
+
+      std::vector<double> frac_err(t.size());
+      for (int i = 0; i < t.size(); ++i) {
+        frac_err.at(i) = Tgas_rsla_exact.at(i) / Tgas.at(i) - 1.0;
+      }
+      matplotlibcpp::plot(t, frac_err);
+      matplotlibcpp::xlabel("time t (s)");
+      matplotlibcpp::ylabel("fractional error in material temperature");
+      matplotlibcpp::save(fmt::format("./radcoupling_rsla_fractional_error.pdf"));
+      quokka::EndAsyncRender();
     }
-    matplotlibcpp::plot(t, frac_err);
-    matplotlibcpp::xlabel("time t (s)");
-    matplotlibcpp::ylabel("fractional error in material temperature");
-    matplotlibcpp::save(fmt::format("./radcoupling_rsla_fractional_error.pdf"));
 #endif
 
   }
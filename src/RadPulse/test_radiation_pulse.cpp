@@ -207,33 +207,36 @@ auto problem_main() -> int {
   amrex::Print() << "Relative L1 error norm = " << rel_error << std::endl;
 
 #ifdef HAVE_PYTHON
-  // plot temperature
-  matplotlibcpp::clf();
-
-  std::map<std::string, std::string> Trad_args;
-  std::map<std::string, std::string> Tgas_args;
-  std::map<std::string, std::string> Tinit_args;
-  std::map<std::string, std::string> Trad_exact_args;
-  Trad_args["label"] = "radiation temperature";
-  Trad_args["linestyle"] = "-.";
-  Tgas_args["label"] = "gas temperature";
-  Tgas_args["linestyle"] = "--";
-  // Tinit_args["label"] = "initial temperature";
-  // Tinit_args["color"] = "grey";
-  Trad_exact_args["label"] = "radiation temperature (exact)";
-  Trad_exact_args["linestyle"] = ":";
-
-  // matplotlibcpp::plot(xs, T_initial, Tinit_args);
-  matplotlibcpp::plot(xs, Trad, Trad_args);
-  matplotlibcpp::plot(xs, Tgas, Tgas_args);
-  matplotlibcpp::plot(xs, Trad_exact, Trad_exact_args);
-
-  matplotlibcpp::xlabel("length x (dimensionless)");
-  matplotlibcpp::ylabel("temperature (dimensionless)");
-  matplotlibcpp::legend();
-  matplotlibcpp::title(
-      fmt::format("time ct = {:.4g}", initial_time + sim.tNew_[0] * c));
-  matplotlibcpp::save("./radiation_pulse_temperature.pdf");
+  if (quokka::BeginAsyncRender()) {
+    // plot temperature
+    matplotlibcpp::clf();
+
+    std::map<std::string, std::string> Trad_args;
+    std::map<std::string, std::string> Tgas_args;
+    std::map<std::string, std::string> Tinit_args;
+    std::map<std::string, std::string> Trad_exact_args;
+    Trad_args["label"] = "radiation temperature";
+    Trad_args["linestyle"] = "-.";
+    Tgas_args["label"] = "gas temperature";
+    Tgas_args["linestyle"] = "--";
+    // Tinit_args["label"] = "initial temperature";
+    // Tinit_args["color"] = "grey";
+    Trad_exact_args["label"] = "radiation temperature (exact)";
+    Trad_exact_args["linestyle"] = ":";
+
+    // matplotlibcpp::plot(xs, T_initial, Tinit_args);
+    matplotlibcpp::plot(xs, Trad, Trad_args);
+    matplotlibcpp::plot(xs, Tgas, Tgas_args);
+    matplotlibcpp::plot(xs, Trad_exact, Trad_exact_args);
+
+    matplotlibcpp::xlabel("length x (dimensionless)");
+    matplotlibcpp::ylabel("temperature (dimensionless)");
+    matplotlibcpp::legend();
+    matplotlibcpp::title(
+        fmt::format("time ct = {:.4g}", initial_time + sim.tNew_[0] * c));
+    matplotlibcpp::save("./radiation_pulse_temperature.pdf");
+    quokka::EndAsyncRender();
+  }
 #endif
 
   // Cleanup and exit
@@ -61,42 +61,29 @@ AMREX_GPU_HOST_DEVICE auto RadSystem<ShadowProblem>::ComputeRosselandOpacity(con
 }
 
 template <>
-AMREX_GPU_DEVICE AMREX_FORCE_INLINE void AMRSimulation<ShadowProblem>::setCustomBoundaryConditions(
-    const amrex::IntVect &iv, amrex::Array4<amrex::Real> const &consVar, int /*dcomp*/,
+void AMRSimulation<ShadowProblem>::setCustomBoundaryConditionsFaceBatch(
+    const amrex::Box &boundaryRange, amrex::Array4<amrex::Real> const &consVar, int /*dcomp*/,
     int /*numcomp*/, amrex::GeometryData const &geom, const amrex::Real /*time*/,
-    const amrex::BCRec * /*bcr*/, int /*bcomp*/, int /*orig_comp*/)
+    amrex::Orientation face)
 {
-#if (AMREX_SPACEDIM == 2)
-	auto [i, j] = iv.toArray();
-	int k = 0;
-#endif
-#if (AMREX_SPACEDIM == 3)
-	auto [i, j, k] = iv.toArray();
-#endif
-
-	const amrex::Box &box = geom.Domain();
-	amrex::GpuArray<int, 3> lo = box.loVect3d();
-
-	if (i < lo[0]) {
-		// free-streaming boundary condition
-		const double Egas = consVar(lo[0], j, k, RadSystem<ShadowProblem>::gasEnergy_index);
-		const double rho = consVar(lo[0], j, k, RadSystem<ShadowProblem>::gasDensity_index);
-		const double px =
-		    consVar(lo[0], j, k, RadSystem<ShadowProblem>::x1GasMomentum_index);
-		const double py =
-		    consVar(lo[0], j, k, RadSystem<ShadowProblem>::x2GasMomentum_index);
-		const double pz =
-		    consVar(lo[0], j, k, RadSystem<ShadowProblem>::x3GasMomentum_index);
-
-		const double E_inc = a_rad * std::pow(T_hohlraum, 4);
-		const double Fx_bdry = c * E_inc; // free-streaming (F/cE == 1)
-		const double Fy_bdry = 0.;
-		const double Fz_bdry = 0.;
-
-		const amrex::Real Fnorm =
-		    std::sqrt(Fx_bdry * Fx_bdry + Fy_bdry * Fy_bdry + Fz_bdry * Fz_bdry);
-		AMREX_ASSERT((Fnorm / (c * E_inc)) <= 1.0); // flux-limiting condition
+	if (!(face.coordDir() == 0 && face.isLow())) {
+		return; // only the x1 lower boundary is user-defined
+	}
+
+	// free-streaming boundary condition: the incident state is constant in
+	// time, so it is computed once on the host rather than per ghost cell
+	const double E_inc = a_rad * std::pow(T_hohlraum, 4);
+	const double Fx_bdry = c * E_inc; // free-streaming (F/cE == 1)
+	const double Fy_bdry = 0.;
+	const double Fz_bdry = 0.;
+
+	const amrex::Real Fnorm = std::sqrt(Fx_bdry * Fx_bdry + Fy_bdry * Fy_bdry + Fz_bdry * Fz_bdry);
+	AMREX_ALWAYS_ASSERT((Fnorm / (c * E_inc)) <= 1.0); // flux-limiting condition
 
+	const int ilo = geom.Domain().loVect3d()[0];
+
+	// one coalesced kernel over the whole ghost-cell face of this box
+	amrex::ParallelFor(boundaryRange, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
 		// x1 left side boundary (streaming)
 		consVar(i, j, k, RadSystem<ShadowProblem>::radEnergy_index) = E_inc;
 		consVar(i, j, k, RadSystem<ShadowProblem>::x1RadFlux_index) = Fx_bdry;
@@ -104,12 +91,17 @@ AMREX_GPU_DEVICE AMREX_FORCE_INLINE void AMRSimulation<ShadowProblem>::setCustom
 		consVar(i, j, k, RadSystem<ShadowProblem>::x3RadFlux_index) = Fz_bdry;
 
 		// extrapolated/outflow boundary for gas variables
-		consVar(i, j, k, RadSystem<ShadowProblem>::gasEnergy_index) = Egas;
-		consVar(i, j, k, RadSystem<ShadowProblem>::gasDensity_index) = rho;
-		consVar(i, j, k, RadSystem<ShadowProblem>::x1GasMomentum_index) = px;
-		consVar(i, j, k, RadSystem<ShadowProblem>::x2GasMomentum_index) = py;
-		consVar(i, j, k, RadSystem<ShadowProblem>::x3GasMomentum_index) = pz;
-	}
+		consVar(i, j, k, RadSystem<ShadowProblem>::gasEnergy_index) =
+		    consVar(ilo, j, k, RadSystem<ShadowProblem>::gasEnergy_index);
+		consVar(i, j, k, RadSystem<ShadowProblem>::gasDensity_index) =
+		    consVar(ilo, j, k, RadSystem<ShadowProblem>::gasDensity_index);
+		consVar(i, j, k, RadSystem<ShadowProblem>::x1GasMomentum_index) =
+		    consVar(ilo, j, k, RadSystem<ShadowProblem>::x1GasMomentum_index);
+		consVar(i, j, k, RadSystem<ShadowProblem>::x2GasMomentum_index) =
+		    consVar(ilo, j, k, RadSystem<ShadowProblem>::x2GasMomentum_index);
+		consVar(i, j, k, RadSystem<ShadowProblem>::x3GasMomentum_index) =
+		    consVar(ilo, j, k, RadSystem<ShadowProblem>::x3GasMomentum_index);
+	});
 }
 
 template <> void RadhydroSimulation<ShadowProblem>::setInitialConditionsAtLevel(int lev)
@@ -260,6 +252,7 @@ auto problem_main() -> int
 
 	// Problem initialization
 	RadhydroSimulation<ShadowProblem> sim(boundaryConditions);
+	sim.customFaceBoundaryBatch_ = 1; // per-face inflow kernel (see above)
 	sim.stopTime_ = max_time;
 	sim.radiationCflNumber_ = CFL_number;
 	sim.maxTimesteps_ = max_timesteps;
@@ -193,21 +193,24 @@ auto problem_main() -> int {
   amrex::Print() << "Relative L1 norm = " << rel_err_norm << std::endl;
 
 #ifdef HAVE_PYTHON
-  // Plot results
-  matplotlibcpp::clf();
-  matplotlibcpp::ylim(0.0, 1.1);
-
-  std::map<std::string, std::string> erad_args;
-  std::map<std::string, std::string> erad_exact_args;
-  erad_args["label"] = "numerical solution";
-  erad_exact_args["label"] = "exact solution";
-  erad_exact_args["linestyle"] = "--";
-  matplotlibcpp::plot(xs, erad, erad_args);
-  matplotlibcpp::plot(xs, erad_exact, erad_exact_args);
-
-  matplotlibcpp::legend();
-  matplotlibcpp::title(fmt::format("t = {:.4f}", sim.tNew_[0]));
-  matplotlibcpp::save("./radiation_streaming.pdf");
+  if (quokka::BeginAsyncRender()) {
+    // Plot results
+    matplotlibcpp::clf();
+    matplotlibcpp::ylim(0.0, 1.1);
+
+    std::map<std::string, std::string> erad_args;
+    std::map<std::string, std::string> erad_exact_args;
+    erad_args["label"] = "numerical solution";
+    erad_exact_args["label"] = "exact solution";
+    erad_exact_args["linestyle"] = "--";
+    matplotlibcpp::plot(xs, erad, erad_args);
+    matplotlibcpp::plot(xs, erad_exact, erad_exact_args);
+
+    matplotlibcpp::legend();
+    matplotlibcpp::title(fmt::format("t = {:.4f}", sim.tNew_[0]));
+    matplotlibcpp::save("./radiation_streaming.pdf");
+    quokka::EndAsyncRender();
+  }
 #endif // HAVE_PYTHON 
 
   // Cleanup and exit
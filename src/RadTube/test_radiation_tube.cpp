@@ -11,17 +11,18 @@
 
 #include "AMReX.H"
 #include "AMReX_BC_TYPES.H"
+#include "AMReX_GpuContainers.H"
+#include "AMReX_GpuDevice.H"
 
 #include "test_radiation_tube.hpp"
 #include "RadhydroSimulation.hpp"
 #include "radiation_system.hpp"
 #include "fextract.hpp"
 #include "ArrayUtil.hpp"
-extern "C" {
-#include "interpolate.h"
-}
+#include "Interpolate1D.hpp"
 #ifdef HAVE_PYTHON
 #include "matplotlibcpp.h"
+#include "AsyncRender.hpp"
 #endif
 
 struct TubeProblem {};
@@ -46,6 +47,8 @@ template <> struct RadSystem_Traits<TubeProblem> {
   static constexpr double gamma = gamma_gas;
   static constexpr double Erad_floor = 0.;
   static constexpr bool compute_v_over_c_terms = true;
+  // no energy source is injected, so skip the per-substep source evaluation
+  static constexpr bool time_independent_rad_source = true;
 };
 
 template <>
@@ -92,43 +95,50 @@ void RadhydroSimulation<TubeProblem>::setInitialConditionsAtLevel(int lev) {
     Erad_arr.push_back(Erad);
   }
 
-  amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx = geom[lev].CellSizeArray();
-  amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> prob_lo =
-      geom[lev].ProbLoArray();
-
-  for (amrex::MFIter iter(state_old_[lev]); iter.isValid(); ++iter) {
-    const amrex::Box &indexRange = iter.validbox(); // excludes ghost zones
-    auto const &state = state_new_[lev].array(iter);
-
-    amrex::LoopConcurrentOnCpu(indexRange, [=](int i, int j, int k) noexcept {
-      amrex::Real const x = prob_lo[0] + (i + amrex::Real(0.5)) * dx[0];
-
-      amrex::Real const rho =
-          interpolate_value(x, x_arr.dataPtr(), rho_arr.dataPtr(),
-                            static_cast<int>(x_arr.size()));
-      amrex::Real const Pgas =
-          interpolate_value(x, x_arr.dataPtr(), Pgas_arr.dataPtr(),
-                            static_cast<int>(x_arr.size()));
-      amrex::Real const Erad =
-          interpolate_value(x, x_arr.dataPtr(), Erad_arr.dataPtr(),
-                            static_cast<int>(x_arr.size()));
-
-      state(i, j, k, RadSystem<TubeProblem>::radEnergy_index) = Erad;
-      state(i, j, k, RadSystem<TubeProblem>::x1RadFlux_index) = 0;
-      state(i, j, k, RadSystem<TubeProblem>::x2RadFlux_index) = 0;
-      state(i, j, k, RadSystem<TubeProblem>::x3RadFlux_index) = 0;
-
-      state(i, j, k, RadSystem<TubeProblem>::gasEnergy_index) =
-          Pgas / (gamma_gas - 1.0);
-      state(i, j, k, RadSystem<TubeProblem>::gasDensity_index) = rho;
-      state(i, j, k, RadSystem<TubeProblem>::x1GasMomentum_index) = 0.;
-      state(i, j, k, RadSystem<TubeProblem>::x2GasMomentum_index) = 0.;
-      state(i, j, k, RadSystem<TubeProblem>::x3GasMomentum_index) = 0.;
-    });
-  }
-
-  // set flag
-  areInitialConditionsDefined_ = true;
+  // copy the tables to device memory so initialization can run on the GPU
+  amrex::Gpu::DeviceVector<double> x_dev(x_arr.size());
+  amrex::Gpu::DeviceVector<double> rho_dev(rho_arr.size());
+  amrex::Gpu::DeviceVector<double> Pgas_dev(Pgas_arr.size());
+  amrex::Gpu::DeviceVector<double> Erad_dev(Erad_arr.size());
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, x_arr.begin(), x_arr.end(),
+                        x_dev.begin());
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, rho_arr.begin(),
+                        rho_arr.end(), rho_dev.begin());
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, Pgas_arr.begin(),
+                        Pgas_arr.end(), Pgas_dev.begin());
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, Erad_arr.begin(),
+                        Erad_arr.end(), Erad_dev.begin());
+  amrex::Gpu::streamSynchronize();
+
+  double const *x_ptr = x_dev.dataPtr();
+  double const *rho_ptr = rho_dev.dataPtr();
+  double const *Pgas_ptr = Pgas_dev.dataPtr();
+  double const *Erad_ptr = Erad_dev.dataPtr();
+  const int x_size = static_cast<int>(x_dev.size());
+
+  setInitialConditionsOnDevice(
+      lev, [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                amrex::Array4<amrex::Real> const &state,
+                                amrex::GeometryData const &geomData) {
+        amrex::Real const x =
+            geomData.ProbLo(0) + (i + amrex::Real(0.5)) * geomData.CellSize(0);
+
+        amrex::Real const rho = interpolate1d(x, x_ptr, rho_ptr, x_size);
+        amrex::Real const Pgas = interpolate1d(x, x_ptr, Pgas_ptr, x_size);
+        amrex::Real const Erad = interpolate1d(x, x_ptr, Erad_ptr, x_size);
+
+        state(i, j, k, RadSystem<TubeProblem>::radEnergy_index) = Erad;
+        state(i, j, k, RadSystem<TubeProblem>::x1RadFlux_index) = 0;
+        state(i, j, k, RadSystem<TubeProblem>::x2RadFlux_index) = 0;
+        state(i, j, k, RadSystem<TubeProblem>::x3RadFlux_index) = 0;
+
+        state(i, j, k, RadSystem<TubeProblem>::gasEnergy_index) =
+            Pgas / (gamma_gas - 1.0);
+        state(i, j, k, RadSystem<TubeProblem>::gasDensity_index) = rho;
+        state(i, j, k, RadSystem<TubeProblem>::x1GasMomentum_index) = 0.;
+        state(i, j, k, RadSystem<TubeProblem>::x2GasMomentum_index) = 0.;
+        state(i, j, k, RadSystem<TubeProblem>::x3GasMomentum_index) = 0.;
+      });
 }
 
 template <>
@@ -319,29 +329,32 @@ auto problem_main() -> int {
   amrex::Print() << "Relative L1 norm = " << rel_err_norm << std::endl;
 
 #ifdef HAVE_PYTHON
-  // Plot results
-  int s = 4; // stride
-  std::map<std::string, std::string> Trad_args;
-  std::map<std::string, std::string> Tgas_args;
-  std::unordered_map<std::string, std::string> Texact_args;
-  Trad_args["label"] = "radiation";
-  Trad_args["color"] = "C1";
-  Tgas_args["label"] = "gas";
-  Tgas_args["color"] = "C2";
-  Texact_args["label"] = "exact";
-  Texact_args["marker"] = "o";
-  Texact_args["color"] = "black";
-
-  matplotlibcpp::plot(xs, Trad_arr, Trad_args);
-  matplotlibcpp::plot(xs, Tgas_arr, Tgas_args);
-  matplotlibcpp::scatter(strided_vector_from(xs, s), strided_vector_from(Trad_exact_arr, s), 10.0, Texact_args);
-
-  matplotlibcpp::legend();
-  //matplotlibcpp::title(fmt::format("t = {:.4g} s", sim.tNew_[0]));
-  matplotlibcpp::xlabel("length x (cm)");
-  matplotlibcpp::ylabel("temperature (Kelvins)");
-  matplotlibcpp::tight_layout();
-  matplotlibcpp::save("./radiation_pressure_tube.pdf");
+  if (quokka::BeginAsyncRender()) {
+    // Plot results
+    int s = 4; // stride
+    std::map<std::string, std::string> Trad_args;
+    std::map<std::string, std::string> Tgas_args;
+    std::unordered_map<std::string, std::string> Texact_args;
+    Trad_args["label"] = "radiation";
+    Trad_args["color"] = "C1";
+    Tgas_args["label"] = "gas";
+    Tgas_args["color"] = "C2";
+    Texact_args["label"] = "exact";
+    Texact_args["marker"] = "o";
+    Texact_args["color"] = "black";
+
+    matplotlibcpp::plot(xs, Trad_arr, Trad_args);
+    matplotlibcpp::plot(xs, Tgas_arr, Tgas_args);
+    matplotlibcpp::scatter(strided_vector_from(xs, s), strided_vector_from(Trad_exact_arr, s), 10.0, Texact_args);
+
+    matplotlibcpp::legend();
+    //matplotlibcpp::title(fmt::format("t = {:.4g} s", sim.tNew_[0]));
+    matplotlibcpp::xlabel("length x (cm)");
+    matplotlibcpp::ylabel("temperature (Kelvins)");
+    matplotlibcpp::tight_layout();
+    matplotlibcpp::save("./radiation_pressure_tube.pdf");
+    quokka::EndAsyncRender();
+  }
 #endif // HAVE_PYTHON
 
   // Cleanup and exit
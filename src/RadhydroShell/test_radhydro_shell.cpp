@@ -18,6 +18,8 @@
 #include "AMReX_Extension.H"
 #include "AMReX_FArrayBox.H"
 #include "AMReX_FabArrayUtility.H"
+#include "AMReX_GpuContainers.H"
+#include "AMReX_GpuDevice.H"
 #include "AMReX_Loop.H"
 #include "AMReX_ParallelDescriptor.H"
 #include "AMReX_ParmParse.H"
@@ -25,9 +27,7 @@
 #include "AMReX_REAL.H"
 #include "AMReX_Vector.H"
 
-extern "C" {
-#include "interpolate.h"
-}
+#include "Interpolate1D.hpp"
 #include "RadhydroSimulation.hpp"
 #include "hydro_system.hpp"
 #include "radiation_system.hpp"
@@ -54,6 +54,9 @@ template <> struct RadSystem_Traits<ShellProblem> {
   static constexpr double gamma = gamma_gas;
   static constexpr double Erad_floor = 0.;
   static constexpr bool compute_v_over_c_terms = true;
+  // the point source is static, so it is evaluated once per grid change and
+  // reused across all radiation substeps
+  static constexpr bool time_independent_rad_source = true;
 };
 
 template <> struct EOS_Traits<ShellProblem> {
@@ -183,59 +186,69 @@ void RadhydroSimulation<ShellProblem>::setInitialConditionsAtLevel(int lev) {
     z0 = 0.;
   }
 
-  for (amrex::MFIter iter(state_new_[lev]); iter.isValid(); ++iter) {
-    const amrex::Box &indexRange = iter.validbox();
-    auto const &state = state_new_[lev].array(iter);
-
-    // this must run on host so it can access amrex::Vectors!!
-    amrex::LoopConcurrentOnCpu(indexRange, [=](int i, int j, int k) noexcept {
-      amrex::Real const x = prob_lo[0] + (i + amrex::Real(0.5)) * dx[0];
-      amrex::Real const y = prob_lo[1] + (j + amrex::Real(0.5)) * dx[1];
-      amrex::Real const z = prob_lo[2] + (k + amrex::Real(0.5)) * dx[2];
-      amrex::Real const r = std::sqrt(
-          std::pow(x - x0, 2) + std::pow(y - y0, 2) + std::pow(z - z0, 2));
-
-      double sigma_sh = H_shell / (2.0 * std::sqrt(2.0 * std::log(2.0)));
-      double rho_norm = M_shell / (4.0 * M_PI * r * r *
-                                   std::sqrt(2.0 * M_PI * sigma_sh * sigma_sh));
-      double rho_shell = rho_norm * std::exp(-std::pow(r - r_0, 2) /
-                                             (2.0 * sigma_sh * sigma_sh));
-      double rho = std::max(rho_shell, 1.0e-8 * rho_0);
-
-      // interpolate Frad from table
-      const double Frad =
-          interpolate_value(r, r_arr.dataPtr(), Frad_arr.dataPtr(),
-                            static_cast<int>(r_arr.size()));
-
-      // interpolate Erad from table
-      const double Erad =
-          interpolate_value(r, r_arr.dataPtr(), Erad_arr.dataPtr(),
-                            static_cast<int>(r_arr.size()));
-
-      const double Trad = std::pow(Erad / a_rad, 1. / 4.);
-      const double Tgas = Trad;
-      const double Eint = rho * c_v * Tgas;
-
-      AMREX_ASSERT(!std::isnan(rho));
-      AMREX_ASSERT(!std::isnan(Erad));
-      AMREX_ASSERT(!std::isnan(Frad));
-
-      state(i, j, k, HydroSystem<ShellProblem>::density_index) = rho;
-      state(i, j, k, HydroSystem<ShellProblem>::x1Momentum_index) = 0;
-      state(i, j, k, HydroSystem<ShellProblem>::x2Momentum_index) = 0;
-      state(i, j, k, HydroSystem<ShellProblem>::x3Momentum_index) = 0;
-      state(i, j, k, HydroSystem<ShellProblem>::energy_index) = Eint;
-
-      const double Frad_xyz = Frad / std::sqrt(3.0);
-      state(i, j, k, RadSystem<ShellProblem>::radEnergy_index) = Erad;
-      state(i, j, k, RadSystem<ShellProblem>::x1RadFlux_index) = Frad_xyz;
-      state(i, j, k, RadSystem<ShellProblem>::x2RadFlux_index) = Frad_xyz;
-      state(i, j, k, RadSystem<ShellProblem>::x3RadFlux_index) = Frad_xyz;
-    });
-  }
-
-  // set flag
-  areInitialConditionsDefined_ = true;
+  // copy the tables to device memory so initialization can run on the GPU
+  // (this used to run on the host with LoopConcurrentOnCpu so it could read
+  // the amrex::Vectors, which serialized cold start at large resolutions)
+  amrex::Gpu::DeviceVector<double> r_dev(r_arr.size());
+  amrex::Gpu::DeviceVector<double> Erad_dev(Erad_arr.size());
+  amrex::Gpu::DeviceVector<double> Frad_dev(Frad_arr.size());
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, r_arr.begin(), r_arr.end(),
+                        r_dev.begin());
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, Erad_arr.begin(),
+                        Erad_arr.end(), Erad_dev.begin());
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, Frad_arr.begin(),
+                        Frad_arr.end(), Frad_dev.begin());
+  amrex::Gpu::streamSynchronize();
+
+  double const *r_ptr = r_dev.dataPtr();
+  double const *Erad_ptr = Erad_dev.dataPtr();
+  double const *Frad_ptr = Frad_dev.dataPtr();
+  const int r_size = static_cast<int>(r_dev.size());
+
+  setInitialConditionsOnDevice(
+      lev, [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                amrex::Array4<amrex::Real> const &state,
+                                amrex::GeometryData const & /*geomData*/) {
+        amrex::Real const x = prob_lo[0] + (i + amrex::Real(0.5)) * dx[0];
+        amrex::Real const y = prob_lo[1] + (j + amrex::Real(0.5)) * dx[1];
+        amrex::Real const z = prob_lo[2] + (k + amrex::Real(0.5)) * dx[2];
+        amrex::Real const r = std::sqrt(
+            std::pow(x - x0, 2) + std::pow(y - y0, 2) + std::pow(z - z0, 2));
+
+        double sigma_sh = H_shell / (2.0 * std::sqrt(2.0 * std::log(2.0)));
+        double rho_norm =
+            M_shell / (4.0 * M_PI * r * r *
+                       std::sqrt(2.0 * M_PI * sigma_sh * sigma_sh));
+        double rho_shell = rho_norm * std::exp(-std::pow(r - r_0, 2) /
+                                               (2.0 * sigma_sh * sigma_sh));
+        double rho = std::max(rho_shell, 1.0e-8 * rho_0);
+
+        // interpolate Frad from table
+        const double Frad = interpolate1d(r, r_ptr, Frad_ptr, r_size);
+
+        // interpolate Erad from table
+        const double Erad = interpolate1d(r, r_ptr, Erad_ptr, r_size);
+
+        const double Trad = std::pow(Erad / a_rad, 1. / 4.);
+        const double Tgas = Trad;
+        const double Eint = rho * c_v * Tgas;
+
+        AMREX_ASSERT(!std::isnan(rho));
+        AMREX_ASSERT(!std::isnan(Erad));
+        AMREX_ASSERT(!std::isnan(Frad));
+
+        state(i, j, k, HydroSystem<ShellProblem>::density_index) = rho;
+        state(i, j, k, HydroSystem<ShellProblem>::x1Momentum_index) = 0;
+        state(i, j, k, HydroSystem<ShellProblem>::x2Momentum_index) = 0;
+        state(i, j, k, HydroSystem<ShellProblem>::x3Momentum_index) = 0;
+        state(i, j, k, HydroSystem<ShellProblem>::energy_index) = Eint;
+
+        const double Frad_xyz = Frad / std::sqrt(3.0);
+        state(i, j, k, RadSystem<ShellProblem>::radEnergy_index) = Erad;
+        state(i, j, k, RadSystem<ShellProblem>::x1RadFlux_index) = Frad_xyz;
+        state(i, j, k, RadSystem<ShellProblem>::x2RadFlux_index) = Frad_xyz;
+        state(i, j, k, RadSystem<ShellProblem>::x3RadFlux_index) = Frad_xyz;
+      });
 }
 
 AMREX_GPU_DEVICE AMREX_FORCE_INLINE auto
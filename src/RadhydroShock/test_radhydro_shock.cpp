@@ -356,57 +356,60 @@ auto problem_main() -> int {
     }
 
 #ifdef HAVE_PYTHON
-    // plot results
-
-    // temperature
-    std::map<std::string, std::string> Trad_args;
-    Trad_args["label"] = "Trad";
-    Trad_args["color"] = "black";
-    matplotlibcpp::plot(xs, Trad, Trad_args);
-
-    if (fstream.is_open()) {
-      std::map<std::string, std::string> Trad_exact_args;
-      Trad_exact_args["label"] = "Trad (diffusion ODE)";
-      Trad_exact_args["color"] = "black";
-      Trad_exact_args["linestyle"] = "dashed";
-      matplotlibcpp::plot(xs_exact, Trad_exact, Trad_exact_args);
-    }
+    if (quokka::BeginAsyncRender()) {
+      // plot results
+
+      // temperature
+      std::map<std::string, std::string> Trad_args;
+      Trad_args["label"] = "Trad";
+      Trad_args["color"] = "black";
+      matplotlibcpp::plot(xs, Trad, Trad_args);
+
+      if (fstream.is_open()) {
+        std::map<std::string, std::string> Trad_exact_args;
+        Trad_exact_args["label"] = "Trad (diffusion ODE)";
+        Trad_exact_args["color"] = "black";
+        Trad_exact_args["linestyle"] = "dashed";
+        matplotlibcpp::plot(xs_exact, Trad_exact, Trad_exact_args);
+      }
 
-    std::map<std::string, std::string> Tgas_args;
-    Tgas_args["label"] = "Tmat";
-    Tgas_args["color"] = "red";
-    matplotlibcpp::plot(xs, Tgas, Tgas_args);
-
-    if (fstream.is_open()) {
-      std::map<std::string, std::string> Tgas_exact_args;
-      Tgas_exact_args["label"] = "Tmat (diffusion ODE)";
-      Tgas_exact_args["color"] = "red";
-      Tgas_exact_args["linestyle"] = "dashed";
-      matplotlibcpp::plot(xs_exact, Tmat_exact, Tgas_exact_args);
-    }
+      std::map<std::string, std::string> Tgas_args;
+      Tgas_args["label"] = "Tmat";
+      Tgas_args["color"] = "red";
+      matplotlibcpp::plot(xs, Tgas, Tgas_args);
+
+      if (fstream.is_open()) {
+        std::map<std::string, std::string> Tgas_exact_args;
+        Tgas_exact_args["label"] = "Tmat (diffusion ODE)";
+        Tgas_exact_args["color"] = "red";
+        Tgas_exact_args["linestyle"] = "dashed";
+        matplotlibcpp::plot(xs_exact, Tmat_exact, Tgas_exact_args);
+      }
 
-    matplotlibcpp::xlabel("length x (dimensionless)");
-    matplotlibcpp::ylabel("temperature (dimensionless)");
-    matplotlibcpp::legend();
-    matplotlibcpp::title(fmt::format("time t = {:.4g}", sim.tNew_[0]));
-    matplotlibcpp::save("./radshock_temperature.pdf");
-
-    // gas density
-    std::map<std::string, std::string> gasdens_args;
-    std::map<std::string, std::string> gasvx_args;
-    gasdens_args["label"] = "gas density";
-    gasdens_args["color"] = "black";
-    gasvx_args["label"] = "gas velocity";
-    gasvx_args["color"] = "blue";
-    gasvx_args["linestyle"] = "dashed";
-
-    matplotlibcpp::clf();
-    matplotlibcpp::plot(xs, gasDensity, gasdens_args);
-    matplotlibcpp::plot(xs, gasVelocity, gasvx_args);
-    matplotlibcpp::xlabel("length x (dimensionless)");
-    matplotlibcpp::ylabel("mass density (dimensionless)");
-    matplotlibcpp::legend();
-    matplotlibcpp::save("./radshock_gasdensity.pdf");
+      matplotlibcpp::xlabel("length x (dimensionless)");
+      matplotlibcpp::ylabel("temperature (dimensionless)");
+      matplotlibcpp::legend();
+      matplotlibcpp::title(fmt::format("time t = {:.4g}", sim.tNew_[0]));
+      matplotlibcpp::save("./radshock_temperature.pdf");
+
+      // gas density
+      std::map<std::string, std::string> gasdens_args;
+      std::map<std::string, std::string> gasvx_args;
+      gasdens_args["label"] = "gas density";
+      gasdens_args["color"] = "black";
+      gasvx_args["label"] = "gas velocity";
+      gasvx_args["color"] = "blue";
+      gasvx_args["linestyle"] = "dashed";
+
+      matplotlibcpp::clf();
+      matplotlibcpp::plot(xs, gasDensity, gasdens_args);
+      matplotlibcpp::plot(xs, gasVelocity, gasvx_args);
+      matplotlibcpp::xlabel("length x (dimensionless)");
+      matplotlibcpp::ylabel("mass density (dimensionless)");
+      matplotlibcpp::legend();
+      matplotlibcpp::save("./radshock_gasdensity.pdf");
+      quokka::EndAsyncRender();
+    }
 #endif
 
   }
@@ -12,6 +12,7 @@
 // external headers
 #ifdef HAVE_PYTHON
 #include "matplotlibcpp.h"
+#include "AsyncRender.hpp"
 #endif
 #include <fmt/format.h>
 #include <fstream>
@@ -343,50 +343,53 @@ auto problem_main() -> int
 		}
 
 #ifdef HAVE_PYTHON
-		std::vector<double> xs_scaled(xs.size());
-		std::vector<double> xs_exact_scaled(xs_exact.size());
-		for(int i = 0; i < xs.size(); ++i) {
-			xs_scaled.at(i) = xs.at(i) / Lx;
-		}
-		for(int i = 0; i < xs_exact.size(); ++i) {
-			xs_exact_scaled.at(i) = xs_exact.at(i) / Lx;
-		}
-
-		// plot results
-		int s = 48; // stride
-		std::map<std::string, std::string> Trad_args;
-		Trad_args["label"] = "radiation";
-		Trad_args["color"] = "C1";
-		matplotlibcpp::plot(xs_scaled, Trad, Trad_args);
+		if (quokka::BeginAsyncRender()) {
+			std::vector<double> xs_scaled(xs.size());
+			std::vector<double> xs_exact_scaled(xs_exact.size());
+			for(int i = 0; i < xs.size(); ++i) {
+				xs_scaled.at(i) = xs.at(i) / Lx;
+			}
+			for(int i = 0; i < xs_exact.size(); ++i) {
+				xs_exact_scaled.at(i) = xs_exact.at(i) / Lx;
+			}
 
-		if (fstream.is_open()) {
-			std::unordered_map<std::string, std::string> Trad_exact_args;
-			//Trad_exact_args["label"] = "Trad (diffusion ODE)";
-			Trad_exact_args["color"] = "C1";
-			Trad_exact_args["marker"] = "o";
-			//Trad_exact_args["edgecolors"] = "k";
-			matplotlibcpp::scatter(strided_vector_from(xs_exact_scaled, s), strided_vector_from(Trad_exact, s), 10.0, Trad_exact_args);
-		}
+			// plot results
+			int s = 48; // stride
+			std::map<std::string, std::string> Trad_args;
+			Trad_args["label"] = "radiation";
+			Trad_args["color"] = "C1";
+			matplotlibcpp::plot(xs_scaled, Trad, Trad_args);
+
+			if (fstream.is_open()) {
+				std::unordered_map<std::string, std::string> Trad_exact_args;
+				//Trad_exact_args["label"] = "Trad (diffusion ODE)";
+				Trad_exact_args["color"] = "C1";
+				Trad_exact_args["marker"] = "o";
+				//Trad_exact_args["edgecolors"] = "k";
+				matplotlibcpp::scatter(strided_vector_from(xs_exact_scaled, s), strided_vector_from(Trad_exact, s), 10.0, Trad_exact_args);
+			}
 
-		std::map<std::string, std::string> Tgas_args;
-		Tgas_args["label"] = "gas";
-		Tgas_args["color"] = "C2";
-		matplotlibcpp::plot(xs_scaled, Tgas, Tgas_args);
+			std::map<std::string, std::string> Tgas_args;
+			Tgas_args["label"] = "gas";
+			Tgas_args["color"] = "C2";
+			matplotlibcpp::plot(xs_scaled, Tgas, Tgas_args);
+
+			if (fstream.is_open()) {
+				std::unordered_map<std::string, std::string> Tgas_exact_args;
+				//Tgas_exact_args["label"] = "Tmat (diffusion ODE)";
+				Tgas_exact_args["color"] = "C2";
+				Tgas_exact_args["marker"] = "o";
+				//Tgas_exact_args["edgecolors"] = "k";
+				matplotlibcpp::scatter(strided_vector_from(xs_exact_scaled, s), strided_vector_from(Tmat_exact, s), 10.0, Tgas_exact_args);
+			}
 
-		if (fstream.is_open()) {
-			std::unordered_map<std::string, std::string> Tgas_exact_args;
-			//Tgas_exact_args["label"] = "Tmat (diffusion ODE)";
-			Tgas_exact_args["color"] = "C2";
-			Tgas_exact_args["marker"] = "o";
-			//Tgas_exact_args["edgecolors"] = "k";
-			matplotlibcpp::scatter(strided_vector_from(xs_exact_scaled, s), strided_vector_from(Tmat_exact, s), 10.0, Tgas_exact_args);
+			matplotlibcpp::xlabel("length x (dimensionless)");
+			matplotlibcpp::ylabel("temperature (dimensionless)");
+			matplotlibcpp::legend();
+			matplotlibcpp::tight_layout();
+			matplotlibcpp::save("./radshock_cgs_temperature.pdf");
+			quokka::EndAsyncRender();
 		}
-
-		matplotlibcpp::xlabel("length x (dimensionless)");
-		matplotlibcpp::ylabel("temperature (dimensionless)");
-		matplotlibcpp::legend();
-		matplotlibcpp::tight_layout();
-		matplotlibcpp::save("./radshock_cgs_temperature.pdf");
 #endif
 	}
 
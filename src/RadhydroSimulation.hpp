@@ -9,6 +9,7 @@
 /// \brief Implements classes and functions to organise the overall setup,
 /// timestepping, solving, and I/O of a simulation for radiation moments.
 
+#include <algorithm>
 #include <array>
 #include <climits>
 #include <limits>
@@ -27,44 +28,70 @@
 #include "AMReX_Array4.H"
 #include "AMReX_BCRec.H"
 #include "AMReX_BLassert.H"
+#include "AMReX_BaseFab.H"
 #include "AMReX_Box.H"
 #include "AMReX_FArrayBox.H"
+#include "AMReX_FabArray.H"
 #include "AMReX_FabArrayUtility.H"
 #include "AMReX_FabFactory.H"
+#include "AMReX_Dim3.H"
 #include "AMReX_Geometry.H"
+#include "AMReX_GpuAtomic.H"
+#include "AMReX_GpuBuffer.H"
+#include "AMReX_GpuContainers.H"
 #include "AMReX_GpuQualifiers.H"
 #include "AMReX_IntVect.H"
 #include "AMReX_MultiFab.H"
 #include "AMReX_MultiFabUtil.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_iMultiFab.H"
 #include "AMReX_PhysBCFunct.H"
 #include "AMReX_Print.H"
 #include "AMReX_REAL.H"
+#include "AMReX_Reduce.H"
 #include "AMReX_Utility.H"
 #include "AMReX_YAFluxRegister.H"
 
 #include "CloudyCooling.hpp"
+#include "ProfilerRanges.hpp"
+#include "SweepTranspose.hpp"
 #include "hyperbolic_system.hpp"
 #include "hydro_system.hpp"
 #include "radiation_system.hpp"
 #include "simulation.hpp"
 
+// this struct is specialized by the user application code. like EOS_Traits,
+// it configures the enabled physics at compile time: pure-hydro problems may
+// set is_radiation_enabled = false, which strips the radiation components
+// from the state layout entirely -- the state MultiFabs, ghost exchanges,
+// fill patches, and plotfiles then carry only the hydro components instead
+// of the full radiation-hydro width. the default keeps the historical
+// layout, so problems that do not specialize this struct are unaffected.
+template <typename problem_t> struct Physics_Traits {
+	static constexpr bool is_radiation_enabled = true;
+};
+
 // Simulation class should be initialized only once per program (i.e., is a singleton)
 template <typename problem_t> class RadhydroSimulation : public AMRSimulation<problem_t>
 {
       public:
 	using AMRSimulation<problem_t>::state_old_;
 	using AMRSimulation<problem_t>::state_new_;
-	using AMRSimulation<problem_t>::max_signal_speed_;
 
 	using AMRSimulation<problem_t>::ncomp_;
 	using AMRSimulation<problem_t>::nghost_;
+	using AMRSimulation<problem_t>::nghostAuxStencil_;
+	using AMRSimulation<problem_t>::nghostAuxMask_;
+	using AMRSimulation<problem_t>::nghostAuxLocal_;
 	using AMRSimulation<problem_t>::areInitialConditionsDefined_;
 	using AMRSimulation<problem_t>::boundaryConditions_;
 	using AMRSimulation<problem_t>::componentNames_;
 	using AMRSimulation<problem_t>::fillBoundaryConditions;
+	using AMRSimulation<problem_t>::setInitialConditionsOnDevice;
 	using AMRSimulation<problem_t>::geom;
 	using AMRSimulation<problem_t>::flux_reg_;
 	using AMRSimulation<problem_t>::incrementFluxRegisters;
+	using AMRSimulation<problem_t>::accumulateFluxesForReflux;
 	using AMRSimulation<problem_t>::finest_level;
 	using AMRSimulation<problem_t>::finestLevel;
 	using AMRSimulation<problem_t>::do_reflux;
@@ -75,6 +102,11 @@ template <typename problem_t> class RadhydroSimulation : public AMRSimulation<pr
 	using AMRSimulation<problem_t>::cellUpdates_;
 	using AMRSimulation<problem_t>::CountCells;
 	using AMRSimulation<problem_t>::WriteCheckpointFile;
+	using AMRSimulation<problem_t>::startCostTimer;
+	using AMRSimulation<problem_t>::stopCostTimer;
+	using AMRSimulation<problem_t>::fillBoundaryConditionsBegin;
+	using AMRSimulation<problem_t>::fillBoundaryConditionsEnd;
+	using AMRSimulation<problem_t>::computeCommFreeBoxes;
 
 	std::vector<double> t_vec_;
 	std::vector<double> Trad_vec_;
@@ -82,50 +114,158 @@ template <typename problem_t> class RadhydroSimulation : public AMRSimulation<pr
 
 	cloudy_tables cloudyTables{};
 
-	static constexpr int nvarTotal_ = RadSystem<problem_t>::nvar_;
+	static constexpr bool radiationEnabled_ =
+	    Physics_Traits<problem_t>::is_radiation_enabled;
 	static constexpr int ncompHydro_ = HydroSystem<problem_t>::nvar_; // hydro
+	// when radiation is stripped at compile time, the state carries only the
+	// hydro components (see Physics_Traits)
+	static constexpr int nvarTotal_ =
+	    radiationEnabled_ ? RadSystem<problem_t>::nvar_ : ncompHydro_;
 	static constexpr int ncompHyperbolic_ = RadSystem<problem_t>::nvarHyperbolic_;
 	static constexpr int nstartHyperbolic_ = RadSystem<problem_t>::nstartHyperbolic_;
 
+	// the dual-energy auxiliary internal energy overlays the radiation energy
+	// component of the state layout (auxInternalEnergy_index ==
+	// RadSystem::radEnergy_index), so it is only usable when the radiation
+	// block is stripped at compile time -- enforce that here instead of
+	// trusting problems to never combine the two
+	static_assert(!(HydroSystem<problem_t>::dual_energy_ && radiationEnabled_),
+		      "the dual-energy formalism overlays the radiation components: it requires "
+		      "Physics_Traits<problem_t>::is_radiation_enabled == false");
+	// likewise, the passive-scalar block sits at the end of the hydro layout
+	// (scalar0_index starts at RadSystem::radEnergy_index)
+	static_assert(!(HydroSystem<problem_t>::nscalars_ > 0 && radiationEnabled_),
+		      "passive scalars overlay the radiation components: they require "
+		      "Physics_Traits<problem_t>::is_radiation_enabled == false");
+
 	amrex::Real radiationCflNumber_ = 0.3;
 	int maxSubsteps_ = 10; // maximum number of radiation subcycles per hydro step
 	bool is_hydro_enabled_ = false;
-	bool is_radiation_enabled_ = true;
+	bool is_radiation_enabled_ = radiationEnabled_;
 	bool computeReferenceSolution_ = false;
 	amrex::Real errorNorm_ = NAN;
 	amrex::Real densityFloor_ = 0.;
 	amrex::Real pressureFloor_ = 0.;
 	int fofcMaxIterations_ = 3; // maximum number of flux correction iterations -- only 1 is needed in almost all cases, but in rare cases a second iteration is needed
+	int overlapCommAndComputation_ = 1; // 1 == overlap ghost exchange with interior flux computation during the hydro update
+	int cacheFlatteningCoefficients_ = 1; // 1 == compute the shock-flattening coefficients once per step and reuse them in the RK2 corrector stage
+	int lowStorageIntegrator_ = 0; // 1 == do not allocate the full-level stage-2 scratch MultiFab; each box's stage FAB is allocated transiently instead (trades stream overlap for memory)
+	int speculativeUpdateThreshold_ = 0; // after this many consecutive clean RK-stage updates of a box, run the flag-free speculative update kernel for it (0 == always write per-cell redo flags)
+	int cacheMaxSignalSpeed_ = 1; // 1 == reduce each box's maximum signal speed in the conservative-update epilogue and reuse it in computeTimestep (hydro-only runs; the standalone sweep remains as a fallback)
+#ifdef AMREX_USE_GPU
+	int transposedSweeps_ = 0; // ignored in GPU builds: coalescing hides the pitch strides the transpose exists to remove
+#else
+	int transposedSweeps_ = 1; // 1 == physically transpose the primitive variables for the X2/X3 hydro sweeps so reconstruction and the Riemann solve run at unit stride (the Array4View index permutation leaves those sweeps strided by the row or plane pitch)
+#endif
+
+	// per-level reduced-speed-of-light schedule (runtime-tunable). level 'lev'
+	// runs with c_hat scaled by entry min(lev, size()-1) of this vector; the
+	// default schedule keeps the compile-time trait value on every level.
+	// fine levels already resolve short timescales, so they can run a smaller
+	// c_hat (fewer radiation substeps) without loss of accuracy.
+	amrex::Vector<amrex::Real> radiationChatFactors_ = {1.0};
 
-	int integratorOrder_ = 2; // 1 == forward Euler; 2 == RK2-SSP (default)
+	int integratorOrder_ = 2; // 1 == forward Euler; 2 == RK2-SSP (default); 3 == RK3-SSP (N.B.: the SSP coefficient of RK3 is 1, so it buys accuracy, not a larger CFL -- the 3D linear-stability limit with limited PPM is CFL ~0.4)
 	int reconstructionOrder_ = 3; // 1 == donor cell; 2 == PLM; 3 == PPM (default)
+	int floatReconstruction_ = 0; // 1 == store the PPM stencil inputs (primitive variables) as float32, halving the stencil-read memory traffic; the parabola arithmetic and the Riemann solve still run in double (fused PPM path only)
 	int radiationReconstructionOrder_ = 3; // 1 == donor cell; 2 == PLM; 3 == PPM (default)
+	int fuseRadiationFluxKernel_ = 1; // 1 == reconstruct interface states and evaluate the HLL flux in a single fused kernel (PPM only)
+	int skipQuiescentRadiation_ = 0; // 1 == skip the radiation sweep and implicit solve on boxes where every cell is radiatively quiescent
+	amrex::Real radiationQuiescenceTol_ = 1.0e-10; // relative tolerance for the per-cell quiescence test
 
 	amrex::Long radiationCellUpdates_ = 0; // total number of radiation cell-updates
+	amrex::Long radiationNewtonIters_ = 0; // total number of Newton iterations in the matter-coupling solve
+
+	// persistent scratch buffers for per-step temporaries (see defineScratchBuffers)
+	// [allocating these from the arena for every box every step causes
+	//  allocator churn and arena growth stalls on GPUs]
+	amrex::Vector<amrex::MultiFab> scratchPrimVar_;
+	amrex::Vector<amrex::FabArray<amrex::BaseFab<float>>> scratchPrimVarFloat_; // demoted copy of scratchPrimVar_ (see floatReconstruction_)
+	amrex::Vector<amrex::MultiFab> scratchFlatteningChi_; // one component per direction
+	amrex::Vector<amrex::MultiFab> scratchStateFinal_;
+	amrex::Vector<amrex::iMultiFab> scratchRedoFlag_;
+	amrex::Vector<amrex::Vector<amrex::Long>> hydroCleanStages_; // per local box: consecutive RK-stage updates without a redo (see speculativeUpdateThreshold_)
+	amrex::Vector<amrex::Vector<amrex::Real>> hydroSignalMax_; // per local box: maximum signal speed from the latest update epilogue (-1 == not yet computed; see cacheMaxSignalSpeed_)
+	amrex::Vector<amrex::MultiFab> scratchRadNewtonDelta_; // converged (Egas, Erad) increments from the previous substep
+	amrex::Vector<amrex::iMultiFab> scratchRadActivityMask_; // per-box radiation activity mask (1 ghost layer for dilation)
+	amrex::Vector<amrex::MultiFab> scratchRadEnergySource_; // cell-centered radiation energy source
+	amrex::Vector<int> radEnergySourceValid_; // per level: 1 == scratchRadEnergySource_ already filled (time-independent sources only; see subcycleRadiationAtLevel)
+	amrex::Vector<amrex::MultiFab> scratchRadAdvectionFluxes_; // identically zero (no advection source in this configuration)
+	amrex::Vector<amrex::MultiFab> scratchRadInterState_; // intermediate RK2 stage of the radiation subcycle (see subcycleRadiationAtLevel)
 
 	// member functions
 
 	explicit RadhydroSimulation(amrex::Vector<amrex::BCRec> &boundaryConditions)
-	    : AMRSimulation<problem_t>(boundaryConditions,
-				       RadSystem<problem_t>::nvar_, ncompHyperbolic_)
+	    : AMRSimulation<problem_t>(boundaryConditions, nvarTotal_, ncompHyperbolic_)
 	{
-		componentNames_ = {"gasDensity",    "x-GasMomentum", "y-GasMomentum",
-				   "z-GasMomentum", "gasEnergy",     "radEnergy",
-				   "x-RadFlux",	    "y-RadFlux",     "z-RadFlux"};
+		if constexpr (radiationEnabled_) {
+			componentNames_ = {"gasDensity",    "x-GasMomentum", "y-GasMomentum",
+					   "z-GasMomentum", "gasEnergy",     "radEnergy",
+					   "x-RadFlux",	    "y-RadFlux",     "z-RadFlux"};
+		} else {
+			// radiation components are stripped at compile time
+			componentNames_ = {"gasDensity",    "x-GasMomentum", "y-GasMomentum",
+					   "z-GasMomentum", "gasEnergy"};
+			componentNames_.resize(nvarTotal_); // isothermal EOS drops gasEnergy
+		}
+		if constexpr (HydroSystem<problem_t>::dual_energy_) {
+			// the auxiliary internal energy overlays the (necessarily
+			// unused) radiation energy component (or extends the stripped
+			// hydro layout by one component)
+			componentNames_.resize(
+			    std::max<std::size_t>(componentNames_.size(),
+						  HydroSystem<problem_t>::auxInternalEnergy_index + 1));
+			componentNames_[HydroSystem<problem_t>::auxInternalEnergy_index] =
+				"gasAuxInternalEnergy";
+		}
+		if constexpr (HydroSystem<problem_t>::nscalars_ > 0) {
+			// passive scalars sit at the end of the hydro layout
+			componentNames_.resize(std::max<std::size_t>(
+			    componentNames_.size(), HydroSystem<problem_t>::nvar_));
+			for (int s = 0; s < HydroSystem<problem_t>::nscalars_; ++s) {
+				componentNames_[HydroSystem<problem_t>::scalar0_index + s] =
+					"passiveScalar_" + std::to_string(s);
+			}
+		}
 	}
 
 	RadhydroSimulation(amrex::IntVect & /*gridDims*/, amrex::RealBox & /*boxSize*/,
 			   amrex::Vector<amrex::BCRec> &boundaryConditions)
-	    : AMRSimulation<problem_t>(boundaryConditions,
-				       RadSystem<problem_t>::nvar_, ncompHyperbolic_)
+	    : AMRSimulation<problem_t>(boundaryConditions, nvarTotal_, ncompHyperbolic_)
 	{
-		componentNames_ = {"gasDensity",    "x-GasMomentum", "y-GasMomentum",
-				   "z-GasMomentum", "gasEnergy",     "radEnergy",
-				   "x-RadFlux",	    "y-RadFlux",     "z-RadFlux"};
+		if constexpr (radiationEnabled_) {
+			componentNames_ = {"gasDensity",    "x-GasMomentum", "y-GasMomentum",
+					   "z-GasMomentum", "gasEnergy",     "radEnergy",
+					   "x-RadFlux",	    "y-RadFlux",     "z-RadFlux"};
+		} else {
+			// radiation components are stripped at compile time
+			componentNames_ = {"gasDensity",    "x-GasMomentum", "y-GasMomentum",
+					   "z-GasMomentum", "gasEnergy"};
+			componentNames_.resize(nvarTotal_); // isothermal EOS drops gasEnergy
+		}
+		if constexpr (HydroSystem<problem_t>::dual_energy_) {
+			// the auxiliary internal energy overlays the (necessarily
+			// unused) radiation energy component (or extends the stripped
+			// hydro layout by one component)
+			componentNames_.resize(
+			    std::max<std::size_t>(componentNames_.size(),
+						  HydroSystem<problem_t>::auxInternalEnergy_index + 1));
+			componentNames_[HydroSystem<problem_t>::auxInternalEnergy_index] =
+				"gasAuxInternalEnergy";
+		}
+		if constexpr (HydroSystem<problem_t>::nscalars_ > 0) {
+			// passive scalars sit at the end of the hydro layout
+			componentNames_.resize(std::max<std::size_t>(
+			    componentNames_.size(), HydroSystem<problem_t>::nvar_));
+			for (int s = 0; s < HydroSystem<problem_t>::nscalars_; ++s) {
+				componentNames_[HydroSystem<problem_t>::scalar0_index + s] =
+					"passiveScalar_" + std::to_string(s);
+			}
+		}
 	}
 
 	void checkHydroStates(amrex::MultiFab &mf, char const *file, int line);
-	void computeMaxSignalLocal(int level) override;
+	auto computeMaxSignalLocal(int level) -> amrex::Real override;
 	void setInitialConditionsAtLevel(int level) override;
 	void advanceSingleTimestepAtLevel(int lev, amrex::Real time, amrex::Real dt_lev,
 					  int iteration, int ncycle) override;
@@ -141,120 +281,204 @@ template <typename problem_t> class RadhydroSimulation : public AMRSimulation<pr
 	void ComputeDerivedVar(int lev, std::string const &dname, amrex::MultiFab &mf, int ncomp) const override;
 
 	// fix-up states
-	void FixupState(int level) override;
+	void FixupState(int level, bool newStateOnly, amrex::BoxArray const *syncRegion) override;
 
 	// tag cells for refinement
 	void ErrorEst(int lev, amrex::TagBoxArray &tags, amrex::Real time, int ngrow) override;
 
-	auto expandFluxArrays(std::array<amrex::FArrayBox, AMREX_SPACEDIM> &fluxes, int nstartNew,
-			      int ncompNew) -> std::array<amrex::FArrayBox, AMREX_SPACEDIM>;
+	// (re-)allocate the persistent per-level scratch buffers used for
+	// per-step temporaries (sized once per regrid from the BoxArray)
+	void defineScratchBuffers(int lev);
 
 	void advanceHydroAtLevel(int lev, amrex::Real time, amrex::Real dt_lev,
 				 amrex::YAFluxRegister *fr_as_crse,
 				 amrex::YAFluxRegister *fr_as_fine);
 
 	// radiation subcycle
-	void swapRadiationState(amrex::MultiFab &stateOld, amrex::MultiFab const &stateNew);
+	auto reducedSpeedOfLight(int lev) -> amrex::Real;
+	void computeRadiationActivityMask(int lev);
+	auto isRadiationBoxActive(int lev, amrex::MFIter const &iter) -> bool;
 	auto computeNumberOfRadiationSubsteps(int lev, amrex::Real dt_lev_hydro) -> int;
 	void advanceRadiationSubstepAtLevel(int lev, amrex::Real time,
 						   amrex::Real dt_radiation, int iter_count, int nsubsteps,
 						   amrex::YAFluxRegister *fr_as_crse,
-						   amrex::YAFluxRegister *fr_as_fine);
+						   amrex::YAFluxRegister *fr_as_fine,
+						   amrex::Long *p_iterCount);
 	void subcycleRadiationAtLevel(int lev, amrex::Real time, amrex::Real dt_lev_hydro,
 				      amrex::YAFluxRegister *fr_as_crse,
 				      amrex::YAFluxRegister *fr_as_fine);
 
 	void operatorSplitSourceTerms(amrex::Array4<amrex::Real> const &stateNew,
+			amrex::Array4<amrex::Real> const &radNewtonDelta,
+			amrex::FArrayBox &radEnergySource,
+			amrex::FArrayBox const &advectionFluxes,
 			const amrex::Box &indexRange, amrex::Real time, double dt,
 			amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &dx,
 			amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &prob_lo,
-			amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &prob_hi);
+			amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &prob_hi,
+			amrex::Long *p_iterCount, amrex::Real chat);
 
 	auto computeRadiationFluxes(amrex::Array4<const amrex::Real> const &consVar,
 				    const amrex::Box &indexRange, int nvars,
-				    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx)
+				    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx,
+				    amrex::Real chat)
 	    -> std::tuple<std::array<amrex::FArrayBox, AMREX_SPACEDIM>,
 			  std::array<amrex::FArrayBox, AMREX_SPACEDIM>>;
 
 	auto computeHydroFluxes(amrex::Array4<const amrex::Real> const &consVar,
-				const amrex::Box &indexRange, int nvars)
+				const amrex::Box &indexRange, int nvars,
+				amrex::MFIter const &iter, int lev,
+				bool computeFlattening)
 	    -> std::array<amrex::FArrayBox, AMREX_SPACEDIM>;
 
 	auto computeFOHydroFluxes(amrex::Array4<const amrex::Real> const &consVar,
-				const amrex::Box &indexRange, int nvars)
+				const amrex::Box &indexRange, int nvars,
+				amrex::MFIter const &iter, int lev)
     	-> std::array<amrex::FArrayBox, AMREX_SPACEDIM>;
 
 	template <FluxDir DIR>
 	void fluxFunction(amrex::Array4<const amrex::Real> const &consState,
 			  amrex::FArrayBox &x1Flux, amrex::FArrayBox &x1FluxDiffusive,
 			  const amrex::Box &indexRange, int nvars,
-			  amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx);
+			  amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx,
+			  amrex::Real chat);
 
 	template <FluxDir DIR>
 	void hydroFluxFunction(amrex::Array4<const amrex::Real> const &primVar,
+			  amrex::Array4<const float> const &primVarFloat,
 			  amrex::FArrayBox &x1Flux,
 			  amrex::Array4<const amrex::Real> const &x1Flat,
 			  amrex::Array4<const amrex::Real> const &x2Flat,
 			  amrex::Array4<const amrex::Real> const &x3Flat,
     		  const amrex::Box &indexRange, int nvars);
 
+#ifndef AMREX_USE_GPU
+	template <FluxDir DIR>
+	void hydroFluxFunctionTransposed(amrex::Array4<const amrex::Real> const &primVar,
+			  amrex::FArrayBox &x1Flux,
+			  amrex::Array4<const amrex::Real> const &x1Flat,
+			  amrex::Array4<const amrex::Real> const &x2Flat,
+			  amrex::Array4<const amrex::Real> const &x3Flat,
+			  const amrex::Box &indexRange, int nvars);
+#endif
+
 	template <FluxDir DIR>
 	void hydroFOFluxFunction(amrex::Array4<const amrex::Real> const &primVar,
 			  amrex::FArrayBox &x1Flux, const amrex::Box &indexRange, int nvars);
 
+	[[nodiscard]] static auto compactRedoFlags(amrex::IArrayBox const &redoFlag,
+				   amrex::Box const &indexRange)
+	    -> amrex::Gpu::DeviceVector<amrex::Dim3>;
+
 	void replaceFluxes(std::array<amrex::FArrayBox, AMREX_SPACEDIM> &fluxes,
 			  std::array<amrex::FArrayBox, AMREX_SPACEDIM> &FOfluxes,
 			  amrex::IArrayBox &redoFlag, amrex::Box const &validBox, int ncomp);
 };
 
+template <typename problem_t>
+auto RadhydroSimulation<problem_t>::reducedSpeedOfLight(int lev) -> amrex::Real
+{
+	// the reduced speed of light used on level 'lev' (the compile-time trait
+	// value scaled by the level's schedule factor; levels deeper than the
+	// schedule reuse its last entry)
+	const int i = std::min(lev, static_cast<int>(radiationChatFactors_.size()) - 1);
+	return radiationChatFactors_[i] * RadSystem<problem_t>::c_hat_;
+}
+
 template <typename problem_t>
 auto RadhydroSimulation<problem_t>::computeNumberOfRadiationSubsteps(int lev, amrex::Real dt_lev_hydro) -> int
 {
+	// compute the actual maximum radiation signal speed on this level
+	// (for the default RadSystem this is just the reduced speed of light,
+	//  but problems may specialize ComputeMaxSignalSpeed to return a smaller,
+	//  state-dependent signal speed, e.g. in optically-thick regions --
+	//  quiescent periods then run correspondingly fewer radiation substeps)
+	amrex::Real signal_max_rad = 0.;
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion()) reduction(max : signal_max_rad)
+#endif
+	for (amrex::MFIter iter(state_new_[lev], amrex::TilingIfNotGPU()); iter.isValid(); ++iter) {
+		const amrex::Box &indexRange = iter.tilebox();
+		auto const &stateNew = state_new_[lev].const_array(iter);
+		signal_max_rad = std::max(signal_max_rad,
+			RadSystem<problem_t>::ComputeMaxSignalSpeed(stateNew, indexRange));
+	}
+	// the substep count must agree on all ranks (the substep loop performs
+	// collective ghost exchanges), so reduce the level maximum globally
+	amrex::ParallelDescriptor::ReduceRealMax(signal_max_rad);
+
+	// rescale for the level's runtime reduced speed of light
+	signal_max_rad *= reducedSpeedOfLight(lev) / RadSystem<problem_t>::c_hat_;
+
 	// compute radiation timestep
 	auto const &dx = geom[lev].CellSizeArray();
-	amrex::Real c_hat = RadSystem<problem_t>::c_hat_;
 	amrex::Real dx_min = std::min({AMREX_D_DECL(dx[0], dx[1], dx[2])});
-	amrex::Real dtrad_tmp = radiationCflNumber_ * (dx_min / c_hat);
-	int nsubSteps = std::ceil(dt_lev_hydro / dtrad_tmp);
+	amrex::Real dtrad_tmp = radiationCflNumber_ * (dx_min / signal_max_rad);
+	int nsubSteps = std::max(1, static_cast<int>(std::ceil(dt_lev_hydro / dtrad_tmp)));
 	return nsubSteps;
 }
 
 template <typename problem_t>
-void RadhydroSimulation<problem_t>::computeMaxSignalLocal(int const level)
+auto RadhydroSimulation<problem_t>::computeMaxSignalLocal(int const level) -> amrex::Real
 {
 	BL_PROFILE("RadhydroSimulation::computeMaxSignalLocal()");
 
-	// hydro: loop over local grids, compute CFL timestep
-	for (amrex::MFIter iter(state_new_[level]); iter.isValid(); ++iter) {
-		const amrex::Box &indexRange = iter.validbox();
+	// consume the per-box maxima reduced in the stage-2 epilogue of the
+	// previous hydro update, if they cover the current grids (the first
+	// step and the step after a regrid fall back to the sweep below; -1
+	// entries mark boxes that have not been updated yet). the cached values
+	// predate the post-step fine-to-coarse averaging on covered regions,
+	// but those cells are constrained through their own level's maximum,
+	// and dt growth is limited to 10% per step in computeTimestep anyway.
+	if (cacheMaxSignalSpeed_ != 0 && is_hydro_enabled_ && !is_radiation_enabled_ &&
+	    level < static_cast<int>(hydroSignalMax_.size())) {
+		auto const &cached = hydroSignalMax_[level];
+		if (!cached.empty() && std::all_of(cached.begin(), cached.end(),
+						   [](amrex::Real s) { return s >= 0.; })) {
+			return *std::max_element(cached.begin(), cached.end());
+		}
+	}
+
+	// loop over local grids, each reduced on the fly to a per-box scalar
+	// (tiled across OpenMP threads in CPU builds)
+	amrex::Real signal_max = 0.;
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion()) reduction(max : signal_max)
+#endif
+	for (amrex::MFIter iter(state_new_[level], amrex::TilingIfNotGPU()); iter.isValid(); ++iter) {
+		const amrex::Box &indexRange = iter.tilebox();
 		auto const &stateNew = state_new_[level].const_array(iter);
-		auto const &maxSignal = max_signal_speed_[level].array(iter);
+		amrex::Real box_signal_max = NAN;
 
 		if (is_hydro_enabled_ && !(is_radiation_enabled_)) {
 			// hydro only
-			HydroSystem<problem_t>::ComputeMaxSignalSpeed(stateNew, maxSignal,
-								      indexRange);
+			box_signal_max =
+			    HydroSystem<problem_t>::ComputeMaxSignalSpeed(stateNew, indexRange);
 		} else if (is_radiation_enabled_) {
+			AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
+				radiationEnabled_,
+				"the radiation components are stripped at compile time by "
+				"Physics_Traits for this problem");
 			// radiation hydro, or radiation only
-			RadSystem<problem_t>::ComputeMaxSignalSpeed(stateNew, maxSignal,
-								    indexRange);
+			// (rescaled for the level's runtime reduced speed of light)
+			box_signal_max =
+			    RadSystem<problem_t>::ComputeMaxSignalSpeed(stateNew, indexRange) *
+			    (reducedSpeedOfLight(level) / RadSystem<problem_t>::c_hat_);
 			if (is_hydro_enabled_) {
-				auto maxSignalHydroFAB = amrex::FArrayBox(indexRange);
-				auto const &maxSignalHydro = maxSignalHydroFAB.array();
-				HydroSystem<problem_t>::ComputeMaxSignalSpeed(stateNew, maxSignalHydro, indexRange);
-				const int maxSubsteps = maxSubsteps_;
 				// ensure that we use the smaller of the two timesteps
-				amrex::ParallelFor(indexRange, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept {
-					amrex::Real const maxSignalRadiation = maxSignal(i,j,k) / static_cast<double>(maxSubsteps);
-					maxSignal(i, j, k) = std::max(maxSignalRadiation, maxSignalHydro(i, j, k));
-				});
+				amrex::Real const signal_max_hydro =
+				    HydroSystem<problem_t>::ComputeMaxSignalSpeed(stateNew, indexRange);
+				box_signal_max = std::max(
+				    box_signal_max / static_cast<double>(maxSubsteps_), signal_max_hydro);
 			}
 		} else {
 			// no physics modules enabled, why are we running?
 			amrex::Abort("At least one of hydro or radiation must be enabled! Cannot "
 				     "compute a time step.");
 		}
+		signal_max = std::max(signal_max, box_signal_max);
 	}
+	return signal_max;
 }
 
 #if !defined(NDEBUG)
@@ -268,17 +492,27 @@ void RadhydroSimulation<problem_t>::checkHydroStates(amrex::MultiFab &mf, char c
 {
 	BL_PROFILE("RadhydroSimulation::checkHydroStates()");
 
-	for (amrex::MFIter iter(mf); iter.isValid(); ++iter) {
-		const amrex::Box &indexRange = iter.validbox();
+	// reduce validity over all tiles first; checkpointing and aborting must
+	// happen outside the (possibly threaded) loop
+	int allValid = 1;
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion()) reduction(min : allValid)
+#endif
+	for (amrex::MFIter iter(mf, amrex::TilingIfNotGPU()); iter.isValid(); ++iter) {
+		const amrex::Box &indexRange = iter.tilebox();
 		auto const &state = mf.const_array(iter);
 		if(!HydroSystem<problem_t>::CheckStatesValid(indexRange, state)) {
-			amrex::Print() << "Hydro states invalid (" + std::string(file) + ":" + std::to_string(line) + ")\n";
-			amrex::Print() << "Writing checkpoint for debugging...\n";
-			amrex::MFIter::allowMultipleMFIters(true);
-			WriteCheckpointFile();
-			amrex::Abort("Hydro states invalid (" + std::string(file) + ":" + std::to_string(line) + ")");
+			allValid = 0;
 		}
 	}
+
+	if (allValid == 0) {
+		amrex::Print() << "Hydro states invalid (" + std::string(file) + ":" + std::to_string(line) + ")\n";
+		amrex::Print() << "Writing checkpoint for debugging...\n";
+		amrex::MFIter::allowMultipleMFIters(true);
+		WriteCheckpointFile();
+		amrex::Abort("Hydro states invalid (" + std::string(file) + ":" + std::to_string(line) + ")");
+	}
 }
 
 template <typename problem_t>
@@ -352,17 +586,16 @@ void RadhydroSimulation<problem_t>::computeAfterEvolve(amrex::Vector<amrex::Real
 		amrex::MultiFab state_ref_level0(boxArray(0), DistributionMap(0), ncomp, nghost);
 		computeReferenceSolution(state_ref_level0, geom[0].CellSizeArray(), geom[0].ProbLoArray());
 
-		// compute error norm
-		amrex::MultiFab residual(boxArray(0), DistributionMap(0), ncomp, nghost);
-		amrex::MultiFab::Copy(residual, state_ref_level0, 0, 0, ncomp, nghost);
-		amrex::MultiFab::Saxpy(residual, -1., state_new_[0], 0, 0, ncomp, nghost);
+		// compute the error norms in a single fused device pass (no residual
+		// MultiFab, no per-component norm1 reductions)
+		quokka::ErrorNorms const norms = computeErrorNorms(state_ref_level0);
 
 		amrex::Real sol_norm = 0.;
 		amrex::Real err_norm = 0.;
 		// compute rms of each component
 		for (int n = 0; n < ncomp; ++n) {
-			sol_norm += std::pow(state_ref_level0.norm1(n), 2);
-			err_norm += std::pow(residual.norm1(n), 2);
+			sol_norm += std::pow(norms.sol_L1[n], 2);
+			err_norm += std::pow(norms.L1[n], 2);
 		}
 		sol_norm = std::sqrt(sol_norm);
 		err_norm = std::sqrt(err_norm);
@@ -376,6 +609,13 @@ void RadhydroSimulation<problem_t>::computeAfterEvolve(amrex::Vector<amrex::Real
 	// compute average number of radiation subcycles per timestep
 	double const avg_rad_subcycles = static_cast<double>(radiationCellUpdates_) / static_cast<double>(cellUpdates_);
 	amrex::Print() << "avg. num. of radiation subcycles = " << avg_rad_subcycles << std::endl;
+
+	if (radiationCellUpdates_ > 0) {
+		// compute average number of Newton iterations per matter-coupling solve
+		// (lower is better -- the warm-started solve should need far fewer than a cold start)
+		double const avg_newton_iters = static_cast<double>(radiationNewtonIters_) / static_cast<double>(radiationCellUpdates_);
+		amrex::Print() << "avg. num. of Newton iterations per cell = " << avg_newton_iters << std::endl;
+	}
 	amrex::Print() << std::endl;
 }
 
@@ -419,6 +659,12 @@ void RadhydroSimulation<problem_t>::advanceSingleTimestepAtLevel(int lev, amrex:
 
 	// subcycle radiation
 	if (is_radiation_enabled_) {
+		AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
+			radiationEnabled_,
+			"the radiation components are stripped at compile time by "
+			"Physics_Traits for this problem");
+		// (dual energy or passive scalars + radiation is rejected at compile
+		// time -- see the static_asserts next to nvarTotal_)
 		subcycleRadiationAtLevel(lev, time, dt_lev, fr_as_crse, fr_as_fine);
 	}
 
@@ -439,18 +685,113 @@ void RadhydroSimulation<problem_t>::advanceSingleTimestepAtLevel(int lev, amrex:
 // fix-up any unphysical states created by AMR operations
 // (e.g., caused by the flux register or from interpolation)
 template <typename problem_t>
-void RadhydroSimulation<problem_t>::FixupState(int lev)
+void RadhydroSimulation<problem_t>::FixupState(int lev, bool newStateOnly, amrex::BoxArray const *syncRegion)
 {
 	BL_PROFILE("RadhydroSimulation::FixupState()");
 
-	for (amrex::MFIter iter(state_new_[lev]); iter.isValid(); ++iter) {
-		const amrex::Box &indexRange = iter.fabbox(); // include ghost zones!
+	if (syncRegion != nullptr) {
+		// build the intersection hash outside the (possibly threaded) loop
+		syncRegion->intersections(geom[lev].Domain());
+	}
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+	for (amrex::MFIter iter(state_new_[lev], amrex::TilingIfNotGPU()); iter.isValid(); ++iter) {
 		auto const &stateNew = state_new_[lev].array(iter);
-		auto const &stateOld = state_old_[lev].array(iter);
 
-		// fix hydro state
-		HydroSystem<problem_t>::EnforcePressureFloor(densityFloor_, pressureFloor_, indexRange, stateNew);
-		HydroSystem<problem_t>::EnforcePressureFloor(densityFloor_, pressureFloor_, indexRange, stateOld);
+		if (newStateOnly) {
+			// reflux and averaging only modify the valid region of the new state
+			const amrex::Box &indexRange = iter.tilebox();
+			if (syncRegion != nullptr) {
+				// only the cells reflux/average-down modified need re-checking
+				for (auto const &isect : syncRegion->intersections(indexRange)) {
+					HydroSystem<problem_t>::EnforcePressureFloor(densityFloor_, pressureFloor_, isect.second, stateNew);
+				}
+			} else {
+				HydroSystem<problem_t>::EnforcePressureFloor(densityFloor_, pressureFloor_, indexRange, stateNew);
+			}
+		} else {
+			// interpolation (regridding) fills both states, including ghost zones
+			const amrex::Box &indexRange = iter.growntilebox();
+			auto const &stateOld = state_old_[lev].array(iter);
+			HydroSystem<problem_t>::EnforcePressureFloor(densityFloor_, pressureFloor_, indexRange, stateNew);
+			HydroSystem<problem_t>::EnforcePressureFloor(densityFloor_, pressureFloor_, indexRange, stateOld);
+		}
+	}
+}
+
+template <typename problem_t>
+void RadhydroSimulation<problem_t>::defineScratchBuffers(int lev)
+{
+	if (static_cast<int>(scratchPrimVar_.size()) <= lev) {
+		scratchPrimVar_.resize(lev + 1);
+		scratchPrimVarFloat_.resize(lev + 1);
+		scratchFlatteningChi_.resize(lev + 1);
+		scratchStateFinal_.resize(lev + 1);
+		scratchRedoFlag_.resize(lev + 1);
+		hydroCleanStages_.resize(lev + 1);
+		hydroSignalMax_.resize(lev + 1);
+		scratchRadNewtonDelta_.resize(lev + 1);
+		scratchRadActivityMask_.resize(lev + 1);
+		scratchRadEnergySource_.resize(lev + 1);
+		radEnergySourceValid_.resize(lev + 1, 0);
+		scratchRadAdvectionFluxes_.resize(lev + 1);
+		scratchRadInterState_.resize(lev + 1);
+	}
+
+	amrex::BoxArray const &ba = boxArray(lev);
+	amrex::DistributionMapping const &dm = DistributionMap(lev);
+	if (scratchPrimVar_[lev].boxArray() == ba &&
+	    scratchPrimVar_[lev].DistributionMap() == dm) {
+		return; // already sized for the current grids
+	}
+
+	// ghost widths follow the per-field policy in simulation.hpp: only the
+	// primitive variables (read through the full reconstruction stencil) carry
+	// nghost_ ghost cells
+	scratchPrimVar_[lev] = amrex::MultiFab(ba, dm, ncompHydro_, nghost_);
+	if (floatReconstruction_ != 0) {
+		scratchPrimVarFloat_[lev] = amrex::FabArray<amrex::BaseFab<float>>(
+		    ba, dm, ncompHydro_, nghost_);
+	} else {
+		scratchPrimVarFloat_[lev] = amrex::FabArray<amrex::BaseFab<float>>();
+	}
+	scratchFlatteningChi_[lev] = amrex::MultiFab(ba, dm, 3, nghostAuxStencil_);
+	if (lowStorageIntegrator_ == 0) {
+		scratchStateFinal_[lev] = amrex::MultiFab(ba, dm, ncompHydro_, nghostAuxLocal_);
+	} else {
+		// low-storage mode: the stage-2 result FABs are allocated per box
+		// from the async arena and freed as soon as the box is finalized,
+		// so the high-water mark is a handful of boxes instead of a full
+		// level (see advanceHydroAtLevel)
+		scratchStateFinal_[lev] = amrex::MultiFab();
+	}
+	scratchRedoFlag_[lev] = amrex::iMultiFab(ba, dm, 1, nghostAuxLocal_);
+	// a regrid invalidates the per-box history, so speculation restarts clean
+	hydroCleanStages_[lev].assign(scratchRedoFlag_[lev].local_size(), 0);
+	// ... and the cached signal speeds, so computeTimestep falls back to its sweep
+	hydroSignalMax_[lev].assign(scratchRedoFlag_[lev].local_size(), -1.0);
+	if (is_radiation_enabled_) {
+		scratchRadNewtonDelta_[lev] = amrex::MultiFab(ba, dm, 2, nghostAuxLocal_);
+		scratchRadNewtonDelta_[lev].setVal(0.); // zero increments == cold start for the Newton solve
+		scratchRadActivityMask_[lev] = amrex::iMultiFab(ba, dm, 1, nghostAuxMask_);
+		scratchRadActivityMask_[lev].setVal(1); // everything active until the mask is computed
+		scratchRadEnergySource_[lev] = amrex::MultiFab(ba, dm, 1, nghostAuxLocal_);
+		scratchRadEnergySource_[lev].setVal(0.); // the default (no-op) source hook leaves it zero
+		radEnergySourceValid_[lev] = 0; // a grid change invalidates any cached static source
+		scratchRadAdvectionFluxes_[lev] = amrex::MultiFab(ba, dm, 3, nghostAuxLocal_);
+		scratchRadAdvectionFluxes_[lev].setVal(0.); // stays zero -- no kernel writes to it
+		// full-width so that the flux kernels (which read the gas density and
+		// energy at absolute component indices) can run on it directly
+		scratchRadInterState_[lev] = amrex::MultiFab(ba, dm, ncomp_, nghost_);
+	} else {
+		// hydro-only runs never touch the radiation scratch buffers
+		scratchRadNewtonDelta_[lev] = amrex::MultiFab();
+		scratchRadActivityMask_[lev] = amrex::iMultiFab();
+		scratchRadEnergySource_[lev] = amrex::MultiFab();
+		scratchRadAdvectionFluxes_[lev] = amrex::MultiFab();
+		scratchRadInterState_[lev] = amrex::MultiFab();
 	}
 }
 
@@ -461,160 +802,516 @@ void RadhydroSimulation<problem_t>::advanceHydroAtLevel(int lev, amrex::Real tim
 							amrex::YAFluxRegister *fr_as_fine)
 {
 	BL_PROFILE("RadhydroSimulation::advanceHydroAtLevel()");
+	QUOKKA_PROFILE_RANGE("Hydro::advance", lev);
 
+	// stage-1 flux-register weight: across the whole step, the stage fluxes
+	// enter u^{n+1} with weights dt (Euler), dt/2 + dt/2 (RK2-SSP), or
+	// dt/6 + dt/6 + 2*dt/3 (RK3-SSP, in Shu-Osher form)
 	amrex::Real fluxScaleFactor = NAN;
-	if (integratorOrder_ == 2) {
+	if (integratorOrder_ == 3) {
+		fluxScaleFactor = 1.0 / 6.0;
+	} else if (integratorOrder_ == 2) {
 		fluxScaleFactor = 0.5;
 	} else if (integratorOrder_ == 1) {
 		fluxScaleFactor = 1.0;
 	}
 
+	// (re-)allocate persistent scratch buffers if the grids have changed
+	defineScratchBuffers(lev);
+
+	// if overlap is enabled, the ghost exchange is posted asynchronously and
+	// boxes whose stencils do not touch off-rank data are advanced while the
+	// messages are in flight. (multi-level fills cannot be split, so refined
+	// levels always use the blocking path.)
+	bool const overlap = (overlapCommAndComputation_ != 0) && (lev == 0);
+	amrex::LayoutData<int> commFreeBoxes;
+	if (overlap) {
+		commFreeBoxes = computeCommFreeBoxes(lev);
+	}
+
 	// update ghost zones [old timestep]
-	fillBoundaryConditions(state_old_[lev], state_old_[lev], lev, time);
+	if (overlap) {
+		fillBoundaryConditionsBegin(state_old_[lev], state_old_[lev], lev, time);
+	} else {
+		fillBoundaryConditions(state_old_[lev], state_old_[lev], lev, time);
 
-	// check state validity
-	AMREX_ASSERT(!state_old_[lev].contains_nan(0, state_old_[lev].nComp()));
-	AMREX_ASSERT(!state_old_[lev].contains_nan()); // check ghost cells
+		// check state validity
+		AMREX_ASSERT(!state_old_[lev].contains_nan(0, state_old_[lev].nComp()));
+		AMREX_ASSERT(!state_old_[lev].contains_nan()); // check ghost cells
+	}
 
-	// advance all grids on local processor (Stage 1 of integrator)
-	for (amrex::MFIter iter(state_new_[lev]); iter.isValid(); ++iter) {
+	// per-box fluxes are retained between the launch pass and the
+	// finalization pass below (the flux-register increment must see the
+	// FOFC-corrected fluxes); this costs the face-flux storage of every
+	// local box for the duration of the RK stage
+	amrex::Vector<std::array<amrex::FArrayBox, AMREX_SPACEDIM>> fluxStore(
+	    state_new_[lev].local_size());
+
+	// per-box accumulator for the flux-register increments: the scaled
+	// (possibly FOFC-corrected) fluxes of every RK stage are summed here
+	// and the registers are incremented once per box per step, instead of
+	// one CrseAdd/FineAdd pair per box per stage. only boxes that touch a
+	// coarse-fine boundary allocate an accumulator
+	amrex::Vector<std::array<amrex::FArrayBox, AMREX_SPACEDIM>> fluxAccum(
+	    state_new_[lev].local_size());
+
+	// launch the kernel chain of a single grid (Stage 1 of integrator).
+	// no host synchronization happens here: MFIter rotates the boxes
+	// round-robin over the GPU streams, so the reconstruction of one box
+	// overlaps the Riemann solve and RK update of the others
+	auto launchGridStage1 = [&](amrex::MFIter &iter) {
+		amrex::Real const costStart = startCostTimer();
 
 		const amrex::Box &indexRange = iter.validbox(); // 'validbox' == exclude ghost zones
 		auto const &stateOld = state_old_[lev].const_array(iter);
 		auto const &stateNew = state_new_[lev].array(iter);
-		auto fluxArrays = computeHydroFluxes(stateOld, indexRange, ncompHydro_);
+		fluxStore[iter.LocalIndex()] =
+		    computeHydroFluxes(stateOld, indexRange, ncompHydro_, iter, lev,
+				       /*computeFlattening*/ true);
+		auto &fluxArrays = fluxStore[iter.LocalIndex()];
+
+		// persistent scratch FAB for RK stage
+		amrex::IArrayBox &redoFlag = scratchRedoFlag_[lev][iter];
+
+		// Stage 1 of RK2-SSP. boxes with a long clean history run the
+		// speculative flag-free kernel: only a per-box dirty bit is written,
+		// and the per-cell flags are recomputed in the (rare) failure case
+		if (speculativeUpdateThreshold_ > 0 &&
+		    hydroCleanStages_[lev][iter.LocalIndex()] >= speculativeUpdateThreshold_) {
+			amrex::Box const dirtyBox(indexRange.smallEnd(), indexRange.smallEnd());
+			redoFlag.setVal<amrex::RunOn::Device>(quokka::redoFlag::none, dirtyBox);
+			HydroSystem<problem_t>::template PredictStep<ncompHydro_, false>(
+			    stateOld, stateNew,
+			    {AMREX_D_DECL(fluxArrays[0].const_array(), fluxArrays[1].const_array(),
+					  fluxArrays[2].const_array())},
+			    dt_lev, geom[lev].CellSizeArray(), indexRange,
+				redoFlag.array(), densityFloor_, pressureFloor_);
+		} else {
+			HydroSystem<problem_t>::template PredictStep<ncompHydro_>(
+			    stateOld, stateNew,
+			    {AMREX_D_DECL(fluxArrays[0].const_array(), fluxArrays[1].const_array(),
+					  fluxArrays[2].const_array())},
+			    dt_lev, geom[lev].CellSizeArray(), indexRange,
+				redoFlag.array(), densityFloor_, pressureFloor_);
+		}
 
-		// temporary FAB for RK stage
-		amrex::IArrayBox redoFlag(indexRange, 1, amrex::The_Async_Arena());
+		stopCostTimer(lev, iter, costStart);
+	};
 
-		// Stage 1 of RK2-SSP
-		HydroSystem<problem_t>::PredictStep(
-		    stateOld, stateNew,
-		    {AMREX_D_DECL(fluxArrays[0].const_array(), fluxArrays[1].const_array(),
-				  fluxArrays[2].const_array())},
-		    dt_lev, geom[lev].CellSizeArray(), indexRange, ncompHydro_,
-			redoFlag.array());
+	// finalize a single grid (Stage 1): synchronize on the redo flag, apply
+	// the first-order flux correction where needed, and increment the flux
+	// registers with the (possibly corrected) fluxes. MFIter rotates the
+	// streams identically in both passes, so each box's finalization is
+	// ordered after its own launches
+	auto finalizeGridStage1 = [&](amrex::MFIter &iter) {
+		amrex::Real const costStart = startCostTimer();
 
-		// first-order flux correction (FOFC)
-		if (redoFlag.max<amrex::RunOn::Device>() != quokka::redoFlag::none) {
-			// compute first-order fluxes (on the whole FAB)
-			auto FOFluxArrays = computeFOHydroFluxes(stateOld, indexRange, ncompHydro_);
+		const amrex::Box &indexRange = iter.validbox();
+		auto const &stateOld = state_old_[lev].const_array(iter);
+		auto const &stateNew = state_new_[lev].array(iter);
+		auto &fluxArrays = fluxStore[iter.LocalIndex()];
+		amrex::IArrayBox &redoFlag = scratchRedoFlag_[lev][iter];
+
+		// synchronize on the redo flag: a single per-box dirty bit if this
+		// box ran the speculative kernel, the full flag FAB otherwise
+		bool boxClean = false;
+		if (speculativeUpdateThreshold_ > 0 &&
+		    hydroCleanStages_[lev][iter.LocalIndex()] >= speculativeUpdateThreshold_) {
+			amrex::Box const dirtyBox(indexRange.smallEnd(), indexRange.smallEnd());
+			boxClean = (redoFlag.max<amrex::RunOn::Device>(dirtyBox) ==
+				    quokka::redoFlag::none);
+			if (!boxClean) {
+				// speculation failed: re-run the flagging kernel (idempotent --
+				// it recomputes the update from the same inputs) so the FOFC
+				// machinery below sees per-cell flags
+				HydroSystem<problem_t>::template PredictStep<ncompHydro_>(
+				    stateOld, stateNew,
+				    {AMREX_D_DECL(fluxArrays[0].const_array(), fluxArrays[1].const_array(),
+						  fluxArrays[2].const_array())},
+				    dt_lev, geom[lev].CellSizeArray(), indexRange,
+					redoFlag.array(), densityFloor_, pressureFloor_);
+			}
+		} else {
+			boxClean = (redoFlag.max<amrex::RunOn::Device>() == quokka::redoFlag::none);
+		}
+		hydroCleanStages_[lev][iter.LocalIndex()] =
+		    boxClean ? hydroCleanStages_[lev][iter.LocalIndex()] + 1 : 0;
 
+		// first-order flux correction (FOFC)
+		if (!boxClean) {
 			for(int i = 0; i < fofcMaxIterations_; ++i) {
+				// compact the flagged cells into a device-side index list
+				auto redoCells = compactRedoFlags(redoFlag, indexRange);
+
 				if (Verbose()) {
 					std::cout << "[FOFC-1] iter = "
 							  << i
 							  << ", ncells = "
-							  << redoFlag.sum<amrex::RunOn::Device>(0)
+							  << redoCells.size()
 							  << "\n";
 				}
 
-				// replace fluxes in fluxArrays with first-order fluxes at faces of flagged cells
-				replaceFluxes(fluxArrays, FOFluxArrays, redoFlag, indexRange, ncompHydro_);
+				// overwrite the fluxes on the faces of the flagged cells with
+				// first-order fluxes (only those faces are recomputed; the
+				// primitive scratch still holds the state the fluxes came from)
+				HydroSystem<problem_t>::ComputeFirstOrderFluxesSparse(
+					scratchPrimVar_[lev].const_array(iter),
+					{AMREX_D_DECL(fluxArrays[0].array(), fluxArrays[1].array(),
+						fluxArrays[2].array())},
+					redoCells.data(), static_cast<int>(redoCells.size()));
 
 				// re-do RK stage update for *all* cells
 				// (since neighbors of problem cells will have modified states as well)
-				HydroSystem<problem_t>::PredictStep(
+				HydroSystem<problem_t>::template PredictStep<ncompHydro_>(
 					stateOld, stateNew,
 					{AMREX_D_DECL(fluxArrays[0].const_array(), fluxArrays[1].const_array(),
 						fluxArrays[2].const_array())},
-					dt_lev, geom[lev].CellSizeArray(), indexRange, ncompHydro_,
-					redoFlag.array());
+					dt_lev, geom[lev].CellSizeArray(), indexRange,
+					redoFlag.array(), densityFloor_, pressureFloor_);
 
 				if(redoFlag.max<amrex::RunOn::Device>() == quokka::redoFlag::none) {
 					break;
 				}
 			}
-		}
 
-		// prevent vacuum
-		HydroSystem<problem_t>::EnforcePressureFloor(densityFloor_, pressureFloor_, indexRange, stateNew);
+			// floor any cells that remained invalid after the iteration limit
+			// (the fused floor in PredictStep only applies to valid cells)
+			HydroSystem<problem_t>::EnforcePressureFloor(densityFloor_, pressureFloor_, indexRange, stateNew);
+		}
 
 		if (do_reflux) {
-			// increment flux registers
-			auto expandedFluxes = expandFluxArrays(fluxArrays, 0, state_new_[lev].nComp());
-			incrementFluxRegisters(iter, fr_as_crse, fr_as_fine, expandedFluxes, lev,
-					       fluxScaleFactor * dt_lev);
+			// accumulate this stage's contribution to the flux registers
+			// (the registers are incremented once per step, below)
+			accumulateFluxesForReflux(iter, fr_as_crse, fr_as_fine, fluxArrays, 0, lev,
+						  fluxAccum[iter.LocalIndex()], fluxScaleFactor);
 		}
+
+		stopCostTimer(lev, iter, costStart);
+	};
+
+	// advance all grids on local processor (Stage 1 of integrator): first
+	// launch every box's kernel chain, then finalize (FOFC + reflux) in a
+	// second pass once all chains are in flight. in CPU builds the OpenMP
+	// threads split whole boxes between them: the redo-flag logic and the
+	// per-box scratch FABs require each box to be advanced by a single
+	// thread, so the loops are not tiled. boxes are claimed dynamically
+	// from a shared queue (MFItInfo::SetDynamic) rather than dealt out
+	// statically, so threads that finish early pick up the remaining boxes
+	// of slower ones -- the first-order redo path makes individual boxes
+	// 2-3x more expensive in shock-heavy steps
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+	for (amrex::MFIter iter(state_new_[lev], amrex::MFItInfo().SetDynamic(true)); iter.isValid(); ++iter) {
+		if (!overlap || (commFreeBoxes[iter] != 0)) {
+			launchGridStage1(iter);
+		}
+	}
+	if (overlap) {
+		// complete the ghost exchange, then advance the remaining boxes
+		fillBoundaryConditionsEnd(state_old_[lev], state_old_[lev], lev);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+		for (amrex::MFIter iter(state_new_[lev], amrex::MFItInfo().SetDynamic(true)); iter.isValid(); ++iter) {
+			if (commFreeBoxes[iter] == 0) {
+				launchGridStage1(iter);
+			}
+		}
+	}
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+	for (amrex::MFIter iter(state_new_[lev], amrex::MFItInfo().SetDynamic(true)); iter.isValid(); ++iter) {
+		finalizeGridStage1(iter);
 	}
 
-	if (integratorOrder_ == 2) {
+	// later SSP stages: each one is a convex combination of the old state and
+	// a forward-Euler update of the previous stage (Shu-Osher form). RK2-SSP
+	// has one such stage with weights (1/2, 1/2); RK3-SSP has two, with
+	// weights (3/4, 1/4) and (1/3, 2/3)
+	for (int stage = 2; stage <= integratorOrder_; ++stage) {
+		amrex::Real w0 = 0.5;
+		amrex::Real w1 = 0.5;
+		amrex::Real fluxScaleStage = 0.5;
+		amrex::Real stageTime = time + dt_lev; // u^(1) is a full forward-Euler step
+		if (integratorOrder_ == 3) {
+			if (stage == 2) {
+				w0 = 0.75;
+				w1 = 0.25;
+				fluxScaleStage = 1.0 / 6.0;
+			} else {
+				w0 = 1.0 / 3.0;
+				w1 = 2.0 / 3.0;
+				fluxScaleStage = 2.0 / 3.0;
+				stageTime = time + 0.5 * dt_lev; // u^(2) is a half-step state
+			}
+		}
+
 		// update ghost zones [intermediate stage stored in state_new_]
-		fillBoundaryConditions(state_new_[lev], state_new_[lev], lev, time + dt_lev);
+		if (overlap) {
+			fillBoundaryConditionsBegin(state_new_[lev], state_new_[lev], lev, stageTime);
+		} else {
+			fillBoundaryConditions(state_new_[lev], state_new_[lev], lev, stageTime);
 
-		// check intermediate state validity
-		AMREX_ASSERT(!state_new_[lev].contains_nan(0, state_new_[lev].nComp()));
-		AMREX_ASSERT(!state_new_[lev].contains_nan()); // check ghost zones
+			// check intermediate state validity
+			AMREX_ASSERT(!state_new_[lev].contains_nan(0, state_new_[lev].nComp()));
+			AMREX_ASSERT(!state_new_[lev].contains_nan()); // check ghost zones
+		}
+
+		// low-storage mode: transient per-box stage FABs (freed in the
+		// finalization of each box) instead of the full-level scratch
+		amrex::Vector<amrex::FArrayBox> stateFinalStore;
+		if (lowStorageIntegrator_ != 0) {
+			stateFinalStore.resize(state_new_[lev].local_size());
+		}
 
-		// advance all grids on local processor (Stage 2 of integrator)
-		for (amrex::MFIter iter(state_new_[lev]); iter.isValid(); ++iter) {
+		// launch the kernel chain of a single grid (later SSP stage);
+		// as in Stage 1, no host synchronization happens here
+		auto launchGridStage2 = [&](amrex::MFIter &iter) {
+			amrex::Real const costStart = startCostTimer();
 
 			const amrex::Box &indexRange = iter.validbox(); // 'validbox' == exclude ghost zones
 			auto const &stateOld = state_old_[lev].const_array(iter);
 			auto const &stateInter = state_new_[lev].const_array(iter);
-			auto fluxArrays = computeHydroFluxes(stateInter, indexRange, ncompHydro_);
-
-			amrex::FArrayBox stateFinalFAB = amrex::FArrayBox(indexRange, ncompHydro_,
-															amrex::The_Async_Arena());
+			// the flattening field barely changes between RK stages, so by
+			// default the chi FABs computed in stage 1 are reused here
+			// (saving three stencil kernels per step)
+			fluxStore[iter.LocalIndex()] =
+			    computeHydroFluxes(stateInter, indexRange, ncompHydro_, iter, lev,
+					       /*computeFlattening*/ cacheFlatteningCoefficients_ == 0);
+			auto &fluxArrays = fluxStore[iter.LocalIndex()];
+
+			// scratch FABs for RK stage (persistent full-level scratch by
+			// default; a transient per-box FAB in low-storage mode)
+			if (lowStorageIntegrator_ != 0) {
+				stateFinalStore[iter.LocalIndex()] = amrex::FArrayBox(
+				    indexRange, ncompHydro_, amrex::The_Async_Arena());
+			}
+			amrex::FArrayBox &stateFinalFAB =
+			    (lowStorageIntegrator_ != 0) ? stateFinalStore[iter.LocalIndex()]
+							 : scratchStateFinal_[lev][iter];
 			auto const &stateFinal = stateFinalFAB.array();
-			amrex::IArrayBox redoFlag(indexRange, 1, amrex::The_Async_Arena());
+			amrex::IArrayBox &redoFlag = scratchRedoFlag_[lev][iter];
+
+			// SSP convex combination of the old state and the previous stage
+			// (speculative flag-free kernel for boxes with a clean history,
+			// as in Stage 1)
+			if (speculativeUpdateThreshold_ > 0 &&
+			    hydroCleanStages_[lev][iter.LocalIndex()] >= speculativeUpdateThreshold_) {
+				amrex::Box const dirtyBox(indexRange.smallEnd(), indexRange.smallEnd());
+				redoFlag.setVal<amrex::RunOn::Device>(quokka::redoFlag::none, dirtyBox);
+				HydroSystem<problem_t>::template AddFluxesSSP<ncompHydro_, false>(
+					stateFinal, stateOld, stateInter,
+					{AMREX_D_DECL(fluxArrays[0].const_array(), fluxArrays[1].const_array(),
+						fluxArrays[2].const_array())},
+					dt_lev, w0, w1, geom[lev].CellSizeArray(), indexRange,
+					redoFlag.array(), densityFloor_, pressureFloor_);
+			} else {
+				HydroSystem<problem_t>::template AddFluxesSSP<ncompHydro_>(
+					stateFinal, stateOld, stateInter,
+					{AMREX_D_DECL(fluxArrays[0].const_array(), fluxArrays[1].const_array(),
+						fluxArrays[2].const_array())},
+					dt_lev, w0, w1, geom[lev].CellSizeArray(), indexRange,
+					redoFlag.array(), densityFloor_, pressureFloor_);
+			}
 
-			// Stage 2 of RK2-SSP
-			HydroSystem<problem_t>::AddFluxesRK2(
-				stateFinal, stateOld, stateInter,
-				{AMREX_D_DECL(fluxArrays[0].const_array(), fluxArrays[1].const_array(),
-					fluxArrays[2].const_array())},
-				dt_lev, geom[lev].CellSizeArray(), indexRange, ncompHydro_,
-				redoFlag.array());
+			stopCostTimer(lev, iter, costStart);
+		};
 
-			// first-order flux correction (FOFC)
-			if (redoFlag.max<amrex::RunOn::Device>() != quokka::redoFlag::none) {
-				// compute first-order fluxes (on the whole FAB)
-				auto FOFluxArrays = computeFOHydroFluxes(stateInter, indexRange, ncompHydro_);
+		// finalize a single grid (later SSP stage): FOFC, copy-back, and reflux
+		auto finalizeGridStage2 = [&](amrex::MFIter &iter) {
+			amrex::Real const costStart = startCostTimer();
+
+			const amrex::Box &indexRange = iter.validbox();
+			auto const &stateOld = state_old_[lev].const_array(iter);
+			auto const &stateInter = state_new_[lev].const_array(iter);
+			auto &fluxArrays = fluxStore[iter.LocalIndex()];
+			amrex::FArrayBox &stateFinalFAB =
+			    (lowStorageIntegrator_ != 0) ? stateFinalStore[iter.LocalIndex()]
+							 : scratchStateFinal_[lev][iter];
+			auto const &stateFinal = stateFinalFAB.array();
+			amrex::IArrayBox &redoFlag = scratchRedoFlag_[lev][iter];
+
+			// synchronize on the redo flag (per-box dirty bit if this box ran
+			// the speculative kernel, as in Stage 1)
+			bool boxClean = false;
+			if (speculativeUpdateThreshold_ > 0 &&
+			    hydroCleanStages_[lev][iter.LocalIndex()] >= speculativeUpdateThreshold_) {
+				amrex::Box const dirtyBox(indexRange.smallEnd(), indexRange.smallEnd());
+				boxClean = (redoFlag.max<amrex::RunOn::Device>(dirtyBox) ==
+					    quokka::redoFlag::none);
+				if (!boxClean) {
+					// speculation failed: re-run the flagging kernel so the FOFC
+					// machinery below sees per-cell flags
+					HydroSystem<problem_t>::template AddFluxesSSP<ncompHydro_>(
+						stateFinal, stateOld, stateInter,
+						{AMREX_D_DECL(fluxArrays[0].const_array(), fluxArrays[1].const_array(),
+							fluxArrays[2].const_array())},
+						dt_lev, w0, w1, geom[lev].CellSizeArray(), indexRange,
+						redoFlag.array(), densityFloor_, pressureFloor_);
+				}
+			} else {
+				boxClean = (redoFlag.max<amrex::RunOn::Device>() == quokka::redoFlag::none);
+			}
+			hydroCleanStages_[lev][iter.LocalIndex()] =
+			    boxClean ? hydroCleanStages_[lev][iter.LocalIndex()] + 1 : 0;
 
+			// first-order flux correction (FOFC)
+			if (!boxClean) {
 				for(int i = 0; i < fofcMaxIterations_; ++i) {
+					// compact the flagged cells into a device-side index list
+					auto redoCells = compactRedoFlags(redoFlag, indexRange);
+
 					if (Verbose()) {
-						std::cout << "[FOFC-2] iter = "
+						std::cout << "[FOFC-" << stage << "] iter = "
 								<< i
 								<< ", ncells = "
-								<< redoFlag.sum<amrex::RunOn::Device>(0)
+								<< redoCells.size()
 								<< "\n";
 					}
 
-					// replace fluxes in fluxArrays with first-order fluxes at faces of flagged cells
-					replaceFluxes(fluxArrays, FOFluxArrays, redoFlag, indexRange, ncompHydro_);
+					// overwrite the fluxes on the faces of the flagged cells with
+					// first-order fluxes (only those faces are recomputed; the
+					// primitive scratch still holds the state the fluxes came from)
+					HydroSystem<problem_t>::ComputeFirstOrderFluxesSparse(
+						scratchPrimVar_[lev].const_array(iter),
+						{AMREX_D_DECL(fluxArrays[0].array(), fluxArrays[1].array(),
+							fluxArrays[2].array())},
+						redoCells.data(), static_cast<int>(redoCells.size()));
 
 					// re-do RK stage update for *all* cells
 					// (since neighbors of problem cells will have modified states as well)
-					HydroSystem<problem_t>::AddFluxesRK2(
+					HydroSystem<problem_t>::template AddFluxesSSP<ncompHydro_>(
 						stateFinal, stateOld, stateInter,
 						{AMREX_D_DECL(fluxArrays[0].const_array(), fluxArrays[1].const_array(),
 							fluxArrays[2].const_array())},
-						dt_lev, geom[lev].CellSizeArray(), indexRange, ncompHydro_,
-						redoFlag.array());
+						dt_lev, w0, w1, geom[lev].CellSizeArray(), indexRange,
+						redoFlag.array(), densityFloor_, pressureFloor_);
 
 					if(redoFlag.max<amrex::RunOn::Device>() == quokka::redoFlag::none) {
 						break;
 					}
 				}
+
+				// floor any cells that remained invalid after the iteration limit
+				// (the fused floor in AddFluxesSSP only applies to valid cells)
+				HydroSystem<problem_t>::EnforcePressureFloor(densityFloor_, pressureFloor_, indexRange, stateFinal);
 			}
 
-			// prevent vacuum
-			HydroSystem<problem_t>::EnforcePressureFloor(densityFloor_, pressureFloor_, indexRange, stateFinal);
+			// copy stateFinal to state_new_[lev]
+			state_new_[lev][iter].copy<amrex::RunOn::Device>(stateFinalFAB, 0, 0,
+									 ncompHydro_);
 
-			// copy stateNew to state_new_[lev]
-			auto const &stateNew = state_new_[lev].array(iter);
-			amrex::FArrayBox stateNewFAB = amrex::FArrayBox(stateNew);
-			stateNewFAB.copy<amrex::RunOn::Device>(stateFinalFAB, 0, 0, ncompHydro_);
+			if (lowStorageIntegrator_ != 0) {
+				// release this box's stage FAB (the async arena frees it in
+				// stream order, after the copy above has executed)
+				stateFinalFAB.clear();
+			}
+
+			if (cacheMaxSignalSpeed_ != 0 && !is_radiation_enabled_) {
+				// reduce this box's maximum signal speed while the updated
+				// state is still hot in cache; computeMaxSignalLocal consumes
+				// the per-box maxima instead of re-sweeping the level
+				hydroSignalMax_[lev][iter.LocalIndex()] =
+				    HydroSystem<problem_t>::ComputeMaxSignalSpeed(
+					state_new_[lev].const_array(iter), indexRange);
+			}
 
 			if (do_reflux) {
-				// increment flux registers
-				auto expandedFluxes = expandFluxArrays(fluxArrays, 0, state_new_[lev].nComp());
-				incrementFluxRegisters(iter, fr_as_crse, fr_as_fine, expandedFluxes, lev,
-							fluxScaleFactor * dt_lev);
+				// accumulate this stage's contribution to the flux registers
+				accumulateFluxesForReflux(iter, fr_as_crse, fr_as_fine, fluxArrays, 0, lev,
+							  fluxAccum[iter.LocalIndex()], fluxScaleStage);
+			}
+
+			stopCostTimer(lev, iter, costStart);
+		};
+
+		// in low-storage mode each box is finalized immediately after its
+		// launch, so its stage FAB is freed before later boxes allocate
+		// theirs (at the cost of the cross-box stream overlap)
+		auto advanceGridStage2 = [&](amrex::MFIter &iter) {
+			launchGridStage2(iter);
+			if (lowStorageIntegrator_ != 0) {
+				finalizeGridStage2(iter);
+			}
+		};
+
+		// advance all grids on local processor (later SSP stage):
+		// launch pass, then finalize pass, as in Stage 1
+		// (whole boxes per OpenMP thread in CPU builds)
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+		for (amrex::MFIter iter(state_new_[lev], amrex::MFItInfo().SetDynamic(true)); iter.isValid(); ++iter) {
+			if (!overlap || (commFreeBoxes[iter] != 0)) {
+				advanceGridStage2(iter);
+			}
+		}
+		if (overlap) {
+			// complete the ghost exchange, then advance the remaining boxes
+			fillBoundaryConditionsEnd(state_new_[lev], state_new_[lev], lev);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+			for (amrex::MFIter iter(state_new_[lev], amrex::MFItInfo().SetDynamic(true)); iter.isValid(); ++iter) {
+				if (commFreeBoxes[iter] == 0) {
+					advanceGridStage2(iter);
+				}
+			}
+		}
+		if (lowStorageIntegrator_ == 0) {
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+			for (amrex::MFIter iter(state_new_[lev], amrex::MFItInfo().SetDynamic(true)); iter.isValid(); ++iter) {
+				finalizeGridStage2(iter);
 			}
 		}
 	}
+
+	if (do_reflux) {
+		// increment the flux registers once per box with the accumulated
+		// stage fluxes (CrseAdd/FineAdd are thread-safe per box)
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+		for (amrex::MFIter iter(state_new_[lev], amrex::MFItInfo().SetDynamic(true)); iter.isValid(); ++iter) {
+			auto &accum = fluxAccum[iter.LocalIndex()];
+			if (accum[0].isAllocated()) {
+				incrementFluxRegisters(iter, fr_as_crse, fr_as_fine, accum, lev, dt_lev);
+			}
+		}
+	}
+}
+
+// gather the (i, j, k) indices of the cells flagged for first-order redo into
+// a compact device-side list (stream compaction via an atomic slot counter)
+template <typename problem_t>
+auto RadhydroSimulation<problem_t>::compactRedoFlags(
+    amrex::IArrayBox const &redoFlag, amrex::Box const &indexRange)
+    -> amrex::Gpu::DeviceVector<amrex::Dim3>
+{
+	BL_PROFILE("RadhydroSimulation::compactRedoFlags()");
+
+	// the flag values are 0 or 1, so the sum counts the flagged cells
+	const int ncells = static_cast<int>(redoFlag.sum<amrex::RunOn::Device>(0));
+	amrex::Gpu::DeviceVector<amrex::Dim3> cellList(ncells);
+
+	amrex::Gpu::Buffer<int> count_buf({0});
+	int *const count = count_buf.data();
+	amrex::Dim3 *const cells = cellList.data();
+	amrex::Array4<const int> const &redoFlag_arr = redoFlag.const_array();
+
+	amrex::ParallelFor(indexRange,
+	    [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+		if (redoFlag_arr(i, j, k) == quokka::redoFlag::redo) {
+			const int slot = amrex::Gpu::Atomic::Add(count, 1);
+			cells[slot] = amrex::Dim3{i, j, k};
+		}
+	});
+
+	return cellList;
 }
 
 template <typename problem_t>
@@ -655,50 +1352,58 @@ void RadhydroSimulation<problem_t>::replaceFluxes(
 	}
 }
 
-template <typename problem_t>
-auto RadhydroSimulation<problem_t>::expandFluxArrays(
-    std::array<amrex::FArrayBox, AMREX_SPACEDIM> &fluxes, const int nstartNew, const int ncompNew)
-    -> std::array<amrex::FArrayBox, AMREX_SPACEDIM>
-{
-	BL_PROFILE("RadhydroSimulation::expandFluxArrays()");
-
-	// This is needed because reflux arrays must have the same number of components as
-	// state_new_[lev]
-	auto copyFlux = [nstartNew, ncompNew](amrex::FArrayBox const &oldFlux) {
-		amrex::Box const &fluxRange = oldFlux.box();
-		amrex::FArrayBox newFlux(fluxRange, ncompNew, amrex::The_Async_Arena());
-		newFlux.setVal<amrex::RunOn::Device>(0.);
-		// copy oldFlux (starting at 0) to newFlux (starting at nstart)
-		AMREX_ASSERT(ncompNew > oldFlux.nComp());
-		newFlux.copy<amrex::RunOn::Device>(oldFlux, 0, nstartNew, oldFlux.nComp());
-		return newFlux;
-	};
-	return {AMREX_D_DECL(copyFlux(fluxes[0]), copyFlux(fluxes[1]), copyFlux(fluxes[2]))};
-}
-
 template <typename problem_t>
 auto RadhydroSimulation<problem_t>::computeHydroFluxes(
-    amrex::Array4<const amrex::Real> const &consVar, const amrex::Box &indexRange, const int nvars)
+    amrex::Array4<const amrex::Real> const &consVar, const amrex::Box &indexRange, const int nvars,
+    amrex::MFIter const &iter, const int lev, const bool computeFlattening)
     -> std::array<amrex::FArrayBox, AMREX_SPACEDIM>
 {
 	BL_PROFILE("RadhydroSimulation::computeHydroFluxes()");
 
-	// convert conserved to primitive variables
+	// the ghost region is sized from Reconstruction_Traits::max_order; a
+	// runtime order above that bound would read unfilled ghost cells
+	AMREX_ASSERT(nghost_ >= ((reconstructionOrder_ == 3) ? 4 : 2));
+
+	// convert conserved to primitive variables (into persistent scratch)
 	amrex::Box const &ghostRange = amrex::grow(indexRange, nghost_);
-	amrex::FArrayBox primVar(ghostRange, nvars, amrex::The_Async_Arena());
-	HydroSystem<problem_t>::ConservedToPrimitive(consVar, primVar.array(), ghostRange);
-
-	// compute flattening coefficients
-	amrex::Box const &flatteningRange = amrex::grow(indexRange, 2); // +1 greater
-	amrex::FArrayBox x1Flat(flatteningRange, 1, amrex::The_Async_Arena());
-	amrex::FArrayBox x2Flat(flatteningRange, 1, amrex::The_Async_Arena());
-	amrex::FArrayBox x3Flat(flatteningRange, 1, amrex::The_Async_Arena());
-	AMREX_D_TERM(HydroSystem<problem_t>::template ComputeFlatteningCoefficients<FluxDir::X1>(
-			primVar.array(), x1Flat.array(), flatteningRange);
-		, HydroSystem<problem_t>::template ComputeFlatteningCoefficients<FluxDir::X2>(
-			primVar.array(), x2Flat.array(), flatteningRange);
-		, HydroSystem<problem_t>::template ComputeFlatteningCoefficients<FluxDir::X3>(
-			primVar.array(), x3Flat.array(), flatteningRange); )
+	array_t primVar = scratchPrimVar_[lev].array(iter);
+	HydroSystem<problem_t>::ConservedToPrimitive(consVar, primVar, ghostRange);
+
+	// compute flattening coefficients (into persistent scratch). when
+	// computeFlattening == false, the chi FABs computed earlier in this step
+	// are reused instead
+	array_t x1Flat = scratchFlatteningChi_[lev].array(iter, 0);
+	array_t x2Flat = scratchFlatteningChi_[lev].array(iter, 1);
+	array_t x3Flat = scratchFlatteningChi_[lev].array(iter, 2);
+	// shock flattening needs chi over grow(indexRange, 2), whose stencil
+	// reaches 4 ghost cells into the primitive array; problems that bound the
+	// reconstruction at PLM (Reconstruction_Traits::max_order <= 2) carry only
+	// 2 ghost cells and run unflattened
+	if constexpr (detail::reconstruction_ghost_width<problem_t>::value >= 4) {
+		if (computeFlattening) {
+			amrex::Box const &flatteningRange = amrex::grow(indexRange, 2); // +1 greater
+			AMREX_D_TERM(HydroSystem<problem_t>::template ComputeFlatteningCoefficients<FluxDir::X1>(
+					primVar, x1Flat, flatteningRange);
+				, HydroSystem<problem_t>::template ComputeFlatteningCoefficients<FluxDir::X2>(
+					primVar, x2Flat, flatteningRange);
+				, HydroSystem<problem_t>::template ComputeFlatteningCoefficients<FluxDir::X3>(
+					primVar, x3Flat, flatteningRange); )
+		}
+	}
+
+	// demote the primitive variables for reduced-precision stencil reads
+	// (see floatReconstruction_); the demotion is done once per box and
+	// amortized over the directional reconstruction sweeps
+	amrex::Array4<const float> primVarFloat;
+	if (floatReconstruction_ != 0) {
+		amrex::Array4<float> const &dst = scratchPrimVarFloat_[lev].array(iter);
+		auto const &src = scratchPrimVar_[lev].const_array(iter);
+		amrex::ParallelFor(ghostRange, nvars,
+				   [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+					   dst(i, j, k, n) = static_cast<float>(src(i, j, k, n));
+				   });
+		primVarFloat = scratchPrimVarFloat_[lev].const_array(iter);
+	}
 
 	// compute flux functions
 	amrex::Box const &x1FluxRange = amrex::surroundingNodes(indexRange, 0);
@@ -711,12 +1416,12 @@ auto RadhydroSimulation<problem_t>::computeHydroFluxes(
 	amrex::Box const &x3FluxRange = amrex::surroundingNodes(indexRange, 2);
 	amrex::FArrayBox x3Flux(x3FluxRange, nvars, amrex::The_Async_Arena()); // node-centered in z
 #endif
-	AMREX_D_TERM(hydroFluxFunction<FluxDir::X1>(primVar.array(), x1Flux,
-					x1Flat.array(), x2Flat.array(), x3Flat.array(), indexRange, nvars);
-		     , hydroFluxFunction<FluxDir::X2>(primVar.array(), x2Flux,
-					x1Flat.array(), x2Flat.array(), x3Flat.array(), indexRange, nvars);
-		     , hydroFluxFunction<FluxDir::X3>(primVar.array(), x3Flux,
-					x1Flat.array(), x2Flat.array(), x3Flat.array(), indexRange, nvars); )
+	AMREX_D_TERM(hydroFluxFunction<FluxDir::X1>(primVar, primVarFloat, x1Flux,
+					x1Flat, x2Flat, x3Flat, indexRange, nvars);
+		     , hydroFluxFunction<FluxDir::X2>(primVar, primVarFloat, x2Flux,
+					x1Flat, x2Flat, x3Flat, indexRange, nvars);
+		     , hydroFluxFunction<FluxDir::X3>(primVar, primVarFloat, x3Flux,
+					x1Flat, x2Flat, x3Flat, indexRange, nvars); )
 
 	return {AMREX_D_DECL(std::move(x1Flux), std::move(x2Flux), std::move(x3Flux))};
 }
@@ -724,12 +1429,28 @@ auto RadhydroSimulation<problem_t>::computeHydroFluxes(
 template <typename problem_t>
 template <FluxDir DIR>
 void RadhydroSimulation<problem_t>::hydroFluxFunction(
-    amrex::Array4<const amrex::Real> const &primVar, amrex::FArrayBox &x1Flux,
+    amrex::Array4<const amrex::Real> const &primVar,
+	amrex::Array4<const float> const &primVarFloat, amrex::FArrayBox &x1Flux,
 	amrex::Array4<const amrex::Real> const &x1Flat,
 	amrex::Array4<const amrex::Real> const &x2Flat,
 	amrex::Array4<const amrex::Real> const &x3Flat,
     const amrex::Box &indexRange, const int nvars)
 {
+#ifndef AMREX_USE_GPU
+	if constexpr (DIR != FluxDir::X1) {
+		// the Array4View permutation leaves these sweeps strided through
+		// memory; optionally run the whole pipeline in a physically
+		// transposed (unit-stride) frame instead. the float32 stencil path
+		// keeps the view-based sweep: demoting a second, transposed copy
+		// would cancel the bandwidth saving the demotion exists for.
+		if (transposedSweeps_ != 0 && floatReconstruction_ == 0) {
+			hydroFluxFunctionTransposed<DIR>(primVar, x1Flux, x1Flat, x2Flat,
+							 x3Flat, indexRange, nvars);
+			return;
+		}
+	}
+#endif
+
 	int dir = 0;
 	if constexpr (DIR == FluxDir::X1) {
 		dir = 0;
@@ -748,28 +1469,46 @@ void RadhydroSimulation<problem_t>::hydroFluxFunction(
 	amrex::FArrayBox x1RightState(x1ReconstructRange, nvars, amrex::The_Async_Arena());
 
 	if (reconstructionOrder_ == 3) {
-		// mixed interface/cell-centered kernel
-		HydroSystem<problem_t>::template ReconstructStatesPPM<DIR>(
-			primVar, x1LeftState.array(), x1RightState.array(), reconstructRange,
-			x1ReconstructRange, nvars);
-	} else if (reconstructionOrder_ == 2) {
-		// interface-centered kernel
-		HydroSystem<problem_t>::template ReconstructStatesPLM<DIR>(
-			primVar, x1LeftState.array(), x1RightState.array(),
-			x1ReconstructRange, nvars);
-	} else if (reconstructionOrder_ == 1) {
-		// interface-centered kernel
-		HydroSystem<problem_t>::template ReconstructStatesConstant<DIR>(
-			primVar, x1LeftState.array(), x1RightState.array(),
-			x1ReconstructRange, nvars);
+		// fused interface-centered kernel: reconstructs both adjacent cells
+		// in registers and applies shock flattening in the same pass, so the
+		// unflattened states never touch global memory. only the interfaces
+		// the Riemann solver actually reads are computed.
+		array_t x1LeftArr = x1LeftState.array();
+		array_t x1RightArr = x1RightState.array();
+		if (floatReconstruction_ != 0) {
+			// stencil reads come from the demoted copy; every load is
+			// promoted, so the parabola itself is still computed in double
+			HydroSystem<problem_t>::template ReconstructFlattenedStatesPPM<DIR, float>(
+				primVarFloat, x1Flat, x2Flat, x3Flat, x1LeftArr, x1RightArr,
+				x1FluxRange, nvars);
+		} else {
+			HydroSystem<problem_t>::template ReconstructFlattenedStatesPPM<DIR>(
+				primVar, x1Flat, x2Flat, x3Flat, x1LeftArr, x1RightArr,
+				x1FluxRange, nvars);
+		}
 	} else {
-		amrex::Abort("Invalid reconstruction order specified!");
-	}
+		if (reconstructionOrder_ == 2) {
+			// interface-centered kernel
+			HydroSystem<problem_t>::template ReconstructStatesPLM<DIR>(
+				primVar, x1LeftState.array(), x1RightState.array(),
+				x1ReconstructRange, nvars);
+		} else if (reconstructionOrder_ == 1) {
+			// interface-centered kernel
+			HydroSystem<problem_t>::template ReconstructStatesConstant<DIR>(
+				primVar, x1LeftState.array(), x1RightState.array(),
+				x1ReconstructRange, nvars);
+		} else {
+			amrex::Abort("Invalid reconstruction order specified!");
+		}
 
-	// cell-centered kernel
-	HydroSystem<problem_t>::template FlattenShocks<DIR>(
-	    primVar, x1Flat, x2Flat, x3Flat, x1LeftState.array(), x1RightState.array(),
-	    reconstructRange, nvars);
+		// cell-centered kernel (compiled out for problems whose ghost region
+		// is too narrow for the flattening stencil -- see computeHydroFluxes)
+		if constexpr (detail::reconstruction_ghost_width<problem_t>::value >= 4) {
+			HydroSystem<problem_t>::template FlattenShocks<DIR>(
+			    primVar, x1Flat, x2Flat, x3Flat, x1LeftState.array(), x1RightState.array(),
+			    reconstructRange, nvars);
+		}
+	}
 
 	// interface-centered kernel
 	HydroSystem<problem_t>::template ComputeFluxes<DIR>(
@@ -777,17 +1516,118 @@ void RadhydroSimulation<problem_t>::hydroFluxFunction(
 		primVar, x1FluxRange);
 }
 
+#ifndef AMREX_USE_GPU
+// transposed-frame variant of hydroFluxFunction for the X2/X3 sweeps: gather
+// the primitive variables (and the flattening coefficients) into a frame in
+// which the sweep direction is unit stride, run the X1-templated kernels
+// there, and scatter the fluxes back. the velocity/momentum components are
+// cyclically permuted along with the axes, so the X1 Riemann solver sees the
+// sweep-normal velocity in its usual slot -- the result is bitwise identical
+// to the view-based sweep, but the reconstruction stencil no longer strides
+// by the row (X2) or plane (X3) pitch.
+template <typename problem_t>
+template <FluxDir DIR>
+void RadhydroSimulation<problem_t>::hydroFluxFunctionTransposed(
+    amrex::Array4<const amrex::Real> const &primVar, amrex::FArrayBox &x1Flux,
+	amrex::Array4<const amrex::Real> const &x1Flat,
+	amrex::Array4<const amrex::Real> const &x2Flat,
+	amrex::Array4<const amrex::Real> const &x3Flat,
+    const amrex::Box &indexRange, const int nvars)
+{
+	int dir = 0;
+	if constexpr (DIR == FluxDir::X2) {
+		dir = 1;
+	} else if constexpr (DIR == FluxDir::X3) {
+		dir = 2;
+	}
+	quokka::SweepCompMap<DIR> const compMap{};
+
+	// gather the primitive variables into the sweep frame
+	amrex::Box const &ghostRangeT =
+	    quokka::permuteSweepBox<DIR>(amrex::grow(indexRange, nghost_));
+	amrex::FArrayBox primT(ghostRangeT, nvars, amrex::The_Async_Arena());
+	quokka::TransposeToSweep<DIR>(primVar, primT.array(), ghostRangeT, nvars, compMap);
+
+	// the flattening kernels read all three chi fields at cell indices along
+	// each axis, so the chi fields follow the axes into the sweep frame:
+	// kernel chi component m is the physical chi along axis compMap(m+1)-1
+	amrex::Box const &flatRangeT = quokka::permuteSweepBox<DIR>(amrex::grow(indexRange, 2));
+	amrex::FArrayBox chi1T(flatRangeT, 1, amrex::The_Async_Arena());
+	amrex::FArrayBox chi2T(flatRangeT, 1, amrex::The_Async_Arena());
+	amrex::FArrayBox chi3T(flatRangeT, 1, amrex::The_Async_Arena());
+	if constexpr (detail::reconstruction_ghost_width<problem_t>::value >= 4) {
+		std::array<amrex::Array4<const amrex::Real>, 3> const chis{x1Flat, x2Flat, x3Flat};
+		std::array<amrex::Array4<amrex::Real>, 3> const chiT{chi1T.array(), chi2T.array(),
+								     chi3T.array()};
+		for (int m = 0; m < 3; ++m) {
+			quokka::TransposeToSweep<DIR>(chis[compMap(m + 1) - 1], chiT[m], flatRangeT, 1,
+						      quokka::SweepCompMap<FluxDir::X1>{});
+		}
+	}
+
+	// sweep-frame index ranges (kernel x is the sweep direction; the
+	// node-centering offset is applied before permuting, so only integer
+	// bounds are carried over)
+	amrex::Box const &reconstructRangeT = quokka::permuteSweepBox<DIR>(amrex::grow(indexRange, 1));
+	amrex::Box const &x1ReconstructRangeT = quokka::permuteSweepBox<DIR>(
+	    amrex::surroundingNodes(amrex::grow(indexRange, 1), dir));
+	amrex::Box const &x1FluxRangeT =
+	    quokka::permuteSweepBox<DIR>(amrex::surroundingNodes(indexRange, dir));
+
+	amrex::FArrayBox x1LeftState(x1ReconstructRangeT, nvars, amrex::The_Async_Arena());
+	amrex::FArrayBox x1RightState(x1ReconstructRangeT, nvars, amrex::The_Async_Arena());
+	amrex::FArrayBox x1FluxT(x1FluxRangeT, nvars, amrex::The_Async_Arena());
+
+	if (reconstructionOrder_ == 3) {
+		HydroSystem<problem_t>::template ReconstructFlattenedStatesPPM<FluxDir::X1>(
+			primT.const_array(), chi1T.const_array(), chi2T.const_array(),
+			chi3T.const_array(), x1LeftState.array(), x1RightState.array(),
+			x1FluxRangeT, nvars);
+	} else {
+		if (reconstructionOrder_ == 2) {
+			HydroSystem<problem_t>::template ReconstructStatesPLM<FluxDir::X1>(
+				primT.const_array(), x1LeftState.array(), x1RightState.array(),
+				x1ReconstructRangeT, nvars);
+		} else if (reconstructionOrder_ == 1) {
+			HydroSystem<problem_t>::template ReconstructStatesConstant<FluxDir::X1>(
+				primT.const_array(), x1LeftState.array(), x1RightState.array(),
+				x1ReconstructRangeT, nvars);
+		} else {
+			amrex::Abort("Invalid reconstruction order specified!");
+		}
+
+		if constexpr (detail::reconstruction_ghost_width<problem_t>::value >= 4) {
+			HydroSystem<problem_t>::template FlattenShocks<FluxDir::X1>(
+			    primT.const_array(), chi1T.const_array(), chi2T.const_array(),
+			    chi3T.const_array(), x1LeftState.array(), x1RightState.array(),
+			    reconstructRangeT, nvars);
+		}
+	}
+
+	HydroSystem<problem_t>::template ComputeFluxes<FluxDir::X1>(
+	    x1FluxT.array(), x1LeftState.array(), x1RightState.array(),
+		primT.const_array(), x1FluxRangeT);
+
+	// scatter the fluxes back into the physical frame (the momentum flux
+	// triple is un-permuted by the same component map)
+	quokka::TransposeFromSweep<DIR>(x1FluxT.const_array(), x1Flux.array(), x1FluxRangeT,
+					nvars, compMap);
+}
+#endif // AMREX_USE_GPU
+
 template <typename problem_t>
 auto RadhydroSimulation<problem_t>::computeFOHydroFluxes(
-    amrex::Array4<const amrex::Real> const &consVar, const amrex::Box &indexRange, const int nvars)
+    amrex::Array4<const amrex::Real> const &consVar, const amrex::Box &indexRange, const int nvars,
+    amrex::MFIter const &iter, const int lev)
     -> std::array<amrex::FArrayBox, AMREX_SPACEDIM>
 {
 	BL_PROFILE("RadhydroSimulation::computeFOHydroFluxes()");
 
-	// convert conserved to primitive variables
+	// convert conserved to primitive variables (reuses the scratch buffer;
+	// the higher-order fluxes have already been computed from it)
 	amrex::Box const &ghostRange = amrex::grow(indexRange, nghost_);
-	amrex::FArrayBox primVar(ghostRange, nvars, amrex::The_Async_Arena());
-	HydroSystem<problem_t>::ConservedToPrimitive(consVar, primVar.array(), ghostRange);
+	array_t primVar = scratchPrimVar_[lev].array(iter);
+	HydroSystem<problem_t>::ConservedToPrimitive(consVar, primVar, ghostRange);
 
 	// compute flux functions
 	amrex::Box const &x1FluxRange = amrex::surroundingNodes(indexRange, 0);
@@ -800,9 +1640,9 @@ auto RadhydroSimulation<problem_t>::computeFOHydroFluxes(
 	amrex::Box const &x3FluxRange = amrex::surroundingNodes(indexRange, 2);
 	amrex::FArrayBox x3Flux(x3FluxRange, nvars, amrex::The_Async_Arena()); // node-centered in z
 #endif
-	AMREX_D_TERM(hydroFOFluxFunction<FluxDir::X1>(primVar.array(), x1Flux, indexRange, nvars);
-		       , hydroFOFluxFunction<FluxDir::X2>(primVar.array(), x2Flux, indexRange, nvars);
-		       , hydroFOFluxFunction<FluxDir::X3>(primVar.array(), x3Flux, indexRange, nvars); )
+	AMREX_D_TERM(hydroFOFluxFunction<FluxDir::X1>(primVar, x1Flux, indexRange, nvars);
+		       , hydroFOFluxFunction<FluxDir::X2>(primVar, x2Flux, indexRange, nvars);
+		       , hydroFOFluxFunction<FluxDir::X3>(primVar, x3Flux, indexRange, nvars); )
 
 	return {AMREX_D_DECL(std::move(x1Flux), std::move(x2Flux), std::move(x3Flux))};
 }
@@ -841,10 +1681,45 @@ void RadhydroSimulation<problem_t>::hydroFOFluxFunction(
 }
 
 template <typename problem_t>
-void RadhydroSimulation<problem_t>::swapRadiationState(amrex::MultiFab &stateOld, amrex::MultiFab const &stateNew)
+void RadhydroSimulation<problem_t>::computeRadiationActivityMask(int lev)
+{
+	BL_PROFILE("RadhydroSimulation::computeRadiationActivityMask()");
+
+	// mark each box active (1) or quiescent (0). a box is quiescent only if
+	// *every* cell passes the quiescence test, so skipping it cannot change
+	// the solution to within the tolerance.
+	const amrex::Real tol = radiationQuiescenceTol_;
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+	for (amrex::MFIter iter(state_new_[lev], amrex::MFItInfo().SetDynamic(true)); iter.isValid(); ++iter) {
+		const amrex::Box &indexRange = iter.validbox();
+		auto const &state = state_new_[lev].const_array(iter);
+
+		amrex::ReduceOps<amrex::ReduceOpLogicalAnd> reduce_op;
+		amrex::ReduceData<int> reduce_data(reduce_op);
+		reduce_op.eval(indexRange, reduce_data,
+			       [=] AMREX_GPU_DEVICE(int i, int j, int k) -> amrex::GpuTuple<int> {
+				       return {RadSystem<problem_t>::IsRadiationQuiescent(state, i, j, k, tol)};
+			       });
+		const bool quiescent = amrex::get<0>(reduce_data.value(reduce_op)) != 0;
+		scratchRadActivityMask_[lev][iter].template setVal<amrex::RunOn::Device>(quiescent ? 0 : 1);
+	}
+
+	// conservative dilation: exchange one ghost layer so that any box
+	// face-adjacent to an active box is itself treated as active (a radiation
+	// front cannot cross a whole neighbouring box within one coarse step at
+	// the radiation CFL)
+	scratchRadActivityMask_[lev].FillBoundary(geom[lev].periodicity());
+}
+
+template <typename problem_t>
+auto RadhydroSimulation<problem_t>::isRadiationBoxActive(int lev, amrex::MFIter const &iter) -> bool
 {
-	// copy radiation state variables from stateNew to stateOld
-	amrex::MultiFab::Copy(stateOld, stateNew, nstartHyperbolic_, nstartHyperbolic_, ncompHyperbolic_, 0);
+	// active if this box, or any dilated neighbour value in the ghost layer,
+	// is flagged active
+	amrex::Box const &grownRange = amrex::grow(iter.validbox(), 1);
+	return (scratchRadActivityMask_[lev][iter].template max<amrex::RunOn::Device>(grownRange) > 0);
 }
 
 template <typename problem_t>
@@ -853,6 +1728,8 @@ void RadhydroSimulation<problem_t>::subcycleRadiationAtLevel(int lev, amrex::Rea
 							     amrex::YAFluxRegister *fr_as_crse,
 							     amrex::YAFluxRegister *fr_as_fine)
 {
+	QUOKKA_PROFILE_RANGE("Radiation::subcycle", lev);
+
 	// compute radiation timestep
 	int nsubSteps = 0;
 	amrex::Real dt_radiation = NAN;
@@ -874,35 +1751,57 @@ void RadhydroSimulation<problem_t>::subcycleRadiationAtLevel(int lev, amrex::Rea
 	AMREX_ALWAYS_ASSERT(nsubSteps <= (maxSubsteps_+1));
 	AMREX_ALWAYS_ASSERT(dt_radiation > 0.0);
 
-	// perform subcycle
-	auto const &dx = geom[lev].CellSizeArray();
-	amrex::Real time_subcycle = time;
-	for (int i = 0; i < nsubSteps; ++i) {
-		if (i > 0) {
-			// since we are starting a new substep, we need to copy radiation state from
-			// 	new state vector to old state vector
-			// (this is not necessary for the i=0 substep because we have already swapped
-			//  the full hydro+radiation state vectors at the beginning of the level advance)
-			swapRadiationState(state_old_[lev], state_new_[lev]);
-		}
-
-		// advance hyperbolic radiation subsystem starting from state_old_ to state_new_
-		advanceRadiationSubstepAtLevel(lev, time_subcycle, dt_radiation, i, nsubSteps,
-							  fr_as_crse, fr_as_fine);
-
-		// new radiation state is stored in state_new_
-		// new hydro state is stored in state_new_ (always the case during radiation update)
+	// (re-)allocate persistent scratch buffers if the grids have changed
+	// (usually a no-op -- the hydro update has already done this, but hydro
+	//  may be disabled for radiation test problems)
+	defineScratchBuffers(lev);
 
-		// matter-radiation exchange source terms
-		for (amrex::MFIter iter(state_new_[lev]); iter.isValid(); ++iter) {
-			const amrex::Box &indexRange = iter.validbox();
-			auto const &stateNew = state_new_[lev].array(iter);
+	// static radiation energy sources are evaluated once per grid change and
+	// reused across every substep of every step (see RadSystem_Traits)
+	if constexpr (RadSystem<problem_t>::time_independent_rad_source_) {
+		if (radEnergySourceValid_[lev] == 0) {
 			auto const &prob_lo = geom[lev].ProbLoArray();
 			auto const &prob_hi = geom[lev].ProbHiArray();
-			// update state_new_[lev] in place (updates both radiation and hydro vars)
-			operatorSplitSourceTerms(stateNew, indexRange, time_subcycle, dt_radiation,
-									 dx, prob_lo, prob_hi);
+			auto const &dx = geom[lev].CellSizeArray();
+			for (amrex::MFIter iter(scratchRadEnergySource_[lev]); iter.isValid(); ++iter) {
+				RadSystem<problem_t>::SetRadEnergySource(
+					scratchRadEnergySource_[lev][iter].array(), iter.validbox(),
+					dx, prob_lo, prob_hi, time);
+			}
+			radEnergySourceValid_[lev] = 1;
 		}
+	}
+
+	// the level advance starts by swapping the full state vectors, so the
+	// radiation components of state_new_ are stale; copy them forward once.
+	// the substeps then double-buffer between state_new_ and the intermediate
+	// stage buffer instead of copying new->old on every substep (see
+	// advanceRadiationSubstepAtLevel), which also leaves the time-level-n
+	// radiation state in state_old_ for FillPatch time interpolation
+	amrex::MultiFab::Copy(state_new_[lev], state_old_[lev], nstartHyperbolic_,
+			      nstartHyperbolic_, ncompHyperbolic_, 0);
+
+	// flag quiescent boxes so the substep loop can skip them
+	if (skipQuiescentRadiation_ != 0) {
+		computeRadiationActivityMask(lev);
+	}
+
+	// device counter for Newton iteration statistics (accumulated over all
+	// boxes and substeps of this level advance)
+	amrex::Gpu::Buffer<amrex::Long> iter_buf({0});
+	amrex::Long *const p_iterCount = iter_buf.data();
+
+	// perform subcycle
+	amrex::Real time_subcycle = time;
+	for (int i = 0; i < nsubSteps; ++i) {
+		// advance hyperbolic radiation subsystem in place in state_new_ (with the
+		// intermediate RK2 stage held in scratchRadInterState_, so no state copy is
+		// needed between substeps), applying the matter-radiation exchange source
+		// terms to each box as soon as its final hyperbolic stage has been launched
+		// (the source terms are purely local, so the implicit solves of finished
+		// boxes overlap the flux kernels of the rest)
+		advanceRadiationSubstepAtLevel(lev, time_subcycle, dt_radiation, i, nsubSteps,
+							  fr_as_crse, fr_as_fine, p_iterCount);
 
 		// new hydro+radiation state is stored in state_new_
 
@@ -912,12 +1811,17 @@ void RadhydroSimulation<problem_t>::subcycleRadiationAtLevel(int lev, amrex::Rea
 		// update cell update counter
 		radiationCellUpdates_ += CountCells(lev); // keep track of number of cell updates
 	}
+
+	// accumulate Newton iteration statistics (synchronizes the device)
+	amrex::Long const *const h_iterCount = iter_buf.copyToHost();
+	radiationNewtonIters_ += h_iterCount[0];
 }
 
 template <typename problem_t>
 void RadhydroSimulation<problem_t>::advanceRadiationSubstepAtLevel(
     int lev, amrex::Real time, amrex::Real dt_radiation, int const iter_count, int const /*nsubsteps*/,
-	amrex::YAFluxRegister *fr_as_crse, amrex::YAFluxRegister *fr_as_fine)
+	amrex::YAFluxRegister *fr_as_crse, amrex::YAFluxRegister *fr_as_fine,
+	amrex::Long *const p_iterCount)
 {
 	if (Verbose()) {
 		amrex::Print() << "\tsubstep " << iter_count << " t = " << time << std::endl;
@@ -926,23 +1830,64 @@ void RadhydroSimulation<problem_t>::advanceRadiationSubstepAtLevel(
 	// get cell sizes
 	auto const &dx = geom[lev].CellSizeArray();
 
+	// get this level's reduced speed of light
+	const amrex::Real chat = reducedSpeedOfLight(lev);
+
 	// We use the RK2-SSP method here. It needs two registers: one to store the old timestep,
 	// and another to store the intermediate stage (which is reused for the final stage).
 
-	// update ghost zones [old timestep]
-	fillBoundaryConditions(state_old_[lev], state_old_[lev], lev, time);
+	// per-box accumulator for the flux-register increments of this substep:
+	// both stages are summed here and the registers are incremented once per
+	// box per substep (see accumulateFluxesForReflux)
+	amrex::Vector<std::array<amrex::FArrayBox, AMREX_SPACEDIM>> fluxAccum(
+	    state_new_[lev].local_size());
+
+	// update ghost zones [start of substep, stored in state_new_]
+	// the first substep fills the full state (the flux kernels also read the
+	// gas density and temperature in ghost cells for the optical depth); the
+	// remaining fills exchange only the radiation components
+	if (iter_count == 0) {
+		fillBoundaryConditions(state_new_[lev], state_new_[lev], lev, time);
+		// freeze the gas components (valid + ghost) of the intermediate stage
+		// buffer for the whole subcycle, so the stage-2 flux kernels can read
+		// them at their usual component indices
+		amrex::MultiFab::Copy(scratchRadInterState_[lev], state_new_[lev], 0, 0,
+				      nstartHyperbolic_, nghost_);
+	} else {
+		fillBoundaryConditions(state_new_[lev], state_new_[lev], lev, time,
+				       nstartHyperbolic_, ncompHyperbolic_);
+	}
 
 	// advance all grids on local processor (Stage 1 of integrator)
-	for (amrex::MFIter iter(state_new_[lev]); iter.isValid(); ++iter) {
+	// (whole boxes per OpenMP thread in CPU builds; the per-box scratch
+	// FABs require each box to be advanced by a single thread)
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+	for (amrex::MFIter iter(state_new_[lev], amrex::MFItInfo().SetDynamic(true)); iter.isValid(); ++iter) {
+		amrex::Real const costStart = startCostTimer();
 		const amrex::Box &indexRange = iter.validbox();
-		auto const &stateOld = state_old_[lev].const_array(iter);
-		auto const &stateNew = state_new_[lev].array(iter);
+
+		if ((skipQuiescentRadiation_ != 0) && !isRadiationBoxActive(lev, iter)) {
+			// quiescent box: the radiation state is unchanged (state_new_ already
+			// holds it), but the intermediate buffer must be kept consistent so
+			// that active neighbours see the unchanged radiation in their stage-2
+			// ghost cells
+			scratchRadInterState_[lev][iter].template copy<amrex::RunOn::Device>(
+				state_new_[lev][iter], indexRange, nstartHyperbolic_, indexRange,
+				nstartHyperbolic_, ncompHyperbolic_);
+			stopCostTimer(lev, iter, costStart);
+			continue;
+		}
+
+		auto const &stateOld = state_new_[lev].const_array(iter);
+		auto const &stateInter = scratchRadInterState_[lev].array(iter);
 		auto [fluxArrays, fluxDiffusiveArrays] =
-			computeRadiationFluxes(stateOld, indexRange, ncompHyperbolic_, dx);
+			computeRadiationFluxes(stateOld, indexRange, ncompHyperbolic_, dx, chat);
 
-		// Stage 1 of RK2-SSP
+		// Stage 1 of RK2-SSP (writes the intermediate stage buffer)
 		RadSystem<problem_t>::PredictStep(
-			stateOld, stateNew,
+			stateOld, stateInter,
 			{AMREX_D_DECL(fluxArrays[0].array(), fluxArrays[1].array(),
 				fluxArrays[2].array())},
 			{AMREX_D_DECL(fluxDiffusiveArrays[0].const_array(),
@@ -951,28 +1896,45 @@ void RadhydroSimulation<problem_t>::advanceRadiationSubstepAtLevel(
 			dt_radiation, dx, indexRange, ncompHyperbolic_);
 
 		if (do_reflux) {
-			// increment flux registers
+			// accumulate this stage's contribution to the flux registers
 			// WARNING: as written, diffusive flux correction is not compatible with reflux!!
-			auto expandedFluxes =
-				expandFluxArrays(fluxArrays, nstartHyperbolic_, state_new_[lev].nComp());
-			incrementFluxRegisters(iter, fr_as_crse, fr_as_fine, expandedFluxes, lev,
-						0.5 * dt_radiation);
+			accumulateFluxesForReflux(iter, fr_as_crse, fr_as_fine, fluxArrays,
+						  nstartHyperbolic_, lev, fluxAccum[iter.LocalIndex()], 0.5);
 		}
+
+		stopCostTimer(lev, iter, costStart);
 	}
 
-	// update ghost zones [intermediate stage stored in state_new_]
-	fillBoundaryConditions(state_new_[lev], state_new_[lev], lev, time + dt_radiation);
+	// update ghost zones [intermediate stage buffer]
+	// the gas components of the buffer were frozen (valid + ghost) at the
+	// start of the subcycle, so only the radiation components are exchanged
+	fillBoundaryConditions(scratchRadInterState_[lev], scratchRadInterState_[lev], lev,
+			       time + dt_radiation, nstartHyperbolic_, ncompHyperbolic_);
 
 	// advance all grids on local processor (Stage 2 of integrator)
-	for (amrex::MFIter iter(state_new_[lev]); iter.isValid(); ++iter) {
+	// (whole boxes per OpenMP thread, as in Stage 1)
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+	for (amrex::MFIter iter(state_new_[lev], amrex::MFItInfo().SetDynamic(true)); iter.isValid(); ++iter) {
+		amrex::Real const costStart = startCostTimer();
 		const amrex::Box &indexRange = iter.validbox();
-		auto const &stateOld = state_old_[lev].const_array(iter);
-		auto const &stateInter = state_new_[lev].const_array(iter);
+
+		if ((skipQuiescentRadiation_ != 0) && !isRadiationBoxActive(lev, iter)) {
+			// quiescent box: state_new_ already holds the unchanged radiation
+			stopCostTimer(lev, iter, costStart);
+			continue;
+		}
+
+		auto const &stateOld = state_new_[lev].const_array(iter);
+		auto const &stateInter = scratchRadInterState_[lev].const_array(iter);
 		auto const &stateNew = state_new_[lev].array(iter);
 		auto [fluxArrays, fluxDiffusiveArrays] =
-			computeRadiationFluxes(stateInter, indexRange, ncompHyperbolic_, dx);
+			computeRadiationFluxes(stateInter, indexRange, ncompHyperbolic_, dx, chat);
 
-		// Stage 2 of RK2-SSP
+		// Stage 2 of RK2-SSP, updating state_new_ in place (AddFluxesRK2 is
+		// pointwise in the old-state argument, so aliasing it with the output
+		// is safe)
 		RadSystem<problem_t>::AddFluxesRK2(
 			stateNew, stateOld, stateInter,
 			{AMREX_D_DECL(fluxArrays[0].array(), fluxArrays[1].array(),
@@ -983,45 +1945,82 @@ void RadhydroSimulation<problem_t>::advanceRadiationSubstepAtLevel(
 			dt_radiation, dx, indexRange, ncompHyperbolic_);
 
 		if (do_reflux) {
-			// increment flux registers
+			// accumulate this stage's contribution to the flux registers
 			// WARNING: as written, diffusive flux correction is not compatible with reflux!!
-			auto expandedFluxes =
-				expandFluxArrays(fluxArrays, nstartHyperbolic_, state_new_[lev].nComp());
-			incrementFluxRegisters(iter, fr_as_crse, fr_as_fine, expandedFluxes, lev,
-						0.5 * dt_radiation);
+			accumulateFluxesForReflux(iter, fr_as_crse, fr_as_fine, fluxArrays,
+						  nstartHyperbolic_, lev, fluxAccum[iter.LocalIndex()], 0.5);
+		}
+
+		// matter-radiation exchange source terms (purely local, so they can be
+		// launched as soon as this box's hyperbolic update is in flight; MFIter
+		// rotates GPU streams between boxes, so these implicit solves overlap the
+		// flux kernels of subsequent boxes instead of waiting for a device-wide
+		// synchronization between two box loops)
+		{
+			auto const &prob_lo = geom[lev].ProbLoArray();
+			auto const &prob_hi = geom[lev].ProbHiArray();
+			// update state_new_[lev] in place (updates both radiation and hydro vars)
+			operatorSplitSourceTerms(stateNew, scratchRadNewtonDelta_[lev].array(iter),
+									 scratchRadEnergySource_[lev][iter],
+									 scratchRadAdvectionFluxes_[lev][iter],
+									 indexRange, time, dt_radiation, dx, prob_lo,
+									 prob_hi, p_iterCount, chat);
+		}
+
+		stopCostTimer(lev, iter, costStart);
+	}
+
+	if (do_reflux) {
+		// increment the flux registers once per box with the accumulated
+		// stage fluxes (CrseAdd/FineAdd are thread-safe per box)
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+		for (amrex::MFIter iter(state_new_[lev], amrex::MFItInfo().SetDynamic(true)); iter.isValid(); ++iter) {
+			auto &accum = fluxAccum[iter.LocalIndex()];
+			if (accum[0].isAllocated()) {
+				incrementFluxRegisters(iter, fr_as_crse, fr_as_fine, accum, lev, dt_radiation);
+			}
 		}
 	}
 }
 
 template <typename problem_t>
 void RadhydroSimulation<problem_t>::operatorSplitSourceTerms(
-    amrex::Array4<amrex::Real> const &stateNew, const amrex::Box &indexRange,
-	const amrex::Real time, const double dt,
+    amrex::Array4<amrex::Real> const &stateNew,
+	amrex::Array4<amrex::Real> const &radNewtonDelta,
+	amrex::FArrayBox &radEnergySource, amrex::FArrayBox const &advectionFluxes,
+	const amrex::Box &indexRange, const amrex::Real time, const double dt,
 	amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &dx,
 	amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &prob_lo,
-	amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &prob_hi)
+	amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &prob_hi,
+	amrex::Long *const p_iterCount, const amrex::Real chat)
 {
-	amrex::FArrayBox radEnergySource(indexRange, 1,
-					 amrex::The_Async_Arena()); // cell-centered scalar
-	amrex::FArrayBox advectionFluxes(indexRange, 3,
-					 amrex::The_Async_Arena()); // cell-centered vector
-
-	radEnergySource.setVal<amrex::RunOn::Device>(0.);
-	advectionFluxes.setVal<amrex::RunOn::Device>(0.);
-
-	// cell-centered radiation energy source
-	RadSystem<problem_t>::SetRadEnergySource(radEnergySource.array(), indexRange,
-						 dx, prob_lo, prob_hi, time + dt);
+	// 'radEnergySource' and 'advectionFluxes' are persistent scratch buffers
+	// (see defineScratchBuffers); 'advectionFluxes' is identically zero and is
+	// never written here
+	if constexpr (!RadSystem<problem_t>::time_independent_rad_source_) {
+		// cell-centered radiation energy source. incremental problems assign
+		// every cell themselves, so the previous substep's field need not be
+		// cleared first; time-independent sources were filled once per grid
+		// change in subcycleRadiationAtLevel and are reused as-is.
+		if constexpr (!RadSystem<problem_t>::incremental_rad_source_) {
+			radEnergySource.setVal<amrex::RunOn::Device>(0.);
+		}
+		RadSystem<problem_t>::SetRadEnergySource(radEnergySource.array(), indexRange,
+							 dx, prob_lo, prob_hi, time + dt);
+	}
 
 	// cell-centered source terms
 	RadSystem<problem_t>::AddSourceTerms(stateNew, radEnergySource.const_array(),
-					     advectionFluxes.const_array(), indexRange, dt);
+					     advectionFluxes.const_array(), radNewtonDelta,
+					     indexRange, dt, p_iterCount, chat);
 }
 
 template <typename problem_t>
 auto RadhydroSimulation<problem_t>::computeRadiationFluxes(
     amrex::Array4<const amrex::Real> const &consVar, const amrex::Box &indexRange, const int nvars,
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx)
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx, const amrex::Real chat)
     -> std::tuple<std::array<amrex::FArrayBox, AMREX_SPACEDIM>,
 		  std::array<amrex::FArrayBox, AMREX_SPACEDIM>>
 {
@@ -1040,9 +2039,9 @@ auto RadhydroSimulation<problem_t>::computeRadiationFluxes(
 #endif
 
 	AMREX_D_TERM(
-	    fluxFunction<FluxDir::X1>(consVar, x1Flux, x1FluxDiffusive, indexRange, nvars, dx);
-	    , fluxFunction<FluxDir::X2>(consVar, x2Flux, x2FluxDiffusive, indexRange, nvars, dx);
-	    , fluxFunction<FluxDir::X3>(consVar, x3Flux, x3FluxDiffusive, indexRange, nvars, dx);)
+	    fluxFunction<FluxDir::X1>(consVar, x1Flux, x1FluxDiffusive, indexRange, nvars, dx, chat);
+	    , fluxFunction<FluxDir::X2>(consVar, x2Flux, x2FluxDiffusive, indexRange, nvars, dx, chat);
+	    , fluxFunction<FluxDir::X3>(consVar, x3Flux, x3FluxDiffusive, indexRange, nvars, dx, chat);)
 
 	std::array<amrex::FArrayBox, AMREX_SPACEDIM> fluxArrays = {
 	    AMREX_D_DECL(std::move(x1Flux), std::move(x2Flux), std::move(x3Flux))};
@@ -1058,7 +2057,8 @@ void RadhydroSimulation<problem_t>::fluxFunction(amrex::Array4<const amrex::Real
 						 amrex::FArrayBox &x1Flux,
 						 amrex::FArrayBox &x1FluxDiffusive,
 						 const amrex::Box &indexRange, const int nvars,
-						 amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx)
+						 amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx,
+						 const amrex::Real chat)
 {
 	int dir = 0;
 	if constexpr (DIR == FluxDir::X1) {
@@ -1069,6 +2069,17 @@ void RadhydroSimulation<problem_t>::fluxFunction(amrex::Array4<const amrex::Real
 		dir = 2;
 	}
 
+#ifndef MULTIDIM_EXTREMA_CHECK
+	if ((fuseRadiationFluxKernel_ != 0) && (radiationReconstructionOrder_ == 3)) {
+		// fused path: reconstruct the interface states inline and evaluate the
+		// HLL flux in a single kernel (no staged primitive/interface FABs)
+		amrex::Box const &fusedFluxRange = amrex::surroundingNodes(indexRange, dir);
+		RadSystem<problem_t>::template ComputeFusedFluxesPPM<DIR>(
+			x1Flux.array(), x1FluxDiffusive.array(), fusedFluxRange, consState, dx, chat);
+		return;
+	}
+#endif // MULTIDIM_EXTREMA_CHECK
+
 	// extend box to include ghost zones
 	amrex::Box const &ghostRange = amrex::grow(indexRange, nghost_);
 	// N.B.: A one-zone layer around the cells must be fully reconstructed in order for PPM to
@@ -1105,7 +2116,7 @@ void RadhydroSimulation<problem_t>::fluxFunction(amrex::Array4<const amrex::Real
 	RadSystem<problem_t>::template ComputeFluxes<DIR>(x1Flux.array(), x1FluxDiffusive.array(),
 							  x1LeftState.array(), x1RightState.array(),
 							  x1FluxRange, consState,
-							  dx); // watch out for argument order!!
+							  dx, chat); // watch out for argument order!!
 }
 
 #endif // RADIATION_SIMULATION_HPP_
@@ -0,0 +1,175 @@
+//==============================================================================
+// TwoMomentRad - a radiation transport library for patch-based AMR codes
+// Copyright 2020 Benjamin Wibking.
+// Released under the MIT license. See LICENSE file included in the GitHub repo.
+//==============================================================================
+/// \file benchmark_riemann.cpp
+/// \brief A standalone microbenchmark for the PPM reconstruction and HLLC
+/// Riemann solver kernels.
+///
+/// Fills a single box with a synthetic shocktube-like state and times the
+/// x-sweep reconstruction and flux kernels in isolation, without the AMR
+/// machinery around them. Reports the time per interface, the effective
+/// bandwidth from a hand-counted byte-traffic model, and an approximate
+/// FLOP rate. (Achieved occupancy requires hardware profiler counters and
+/// must be measured with Nsight Compute / rocprof; the per-kernel register
+/// counts that bound it are printed at build time by the ptxas verbose
+/// output enabled for CUDA builds.)
+///
+/// Runtime parameters (ParmParse prefix 'benchmark'):
+///   benchmark.box_size    cells per side of the benchmark box (default 64)
+///   benchmark.iterations  timed kernel launches per measurement (default 100)
+
+#include <cmath>
+
+#include "AMReX_FArrayBox.H"
+#include "AMReX_GpuDevice.H"
+#include "AMReX_ParmParse.H"
+#include "AMReX_Print.H"
+#include "AMReX_REAL.H"
+#include "AMReX_Utility.H"
+
+#include "benchmark_riemann.hpp"
+#include "hydro_system.hpp"
+#include "main.hpp"
+
+struct RiemannBench {};
+
+template <> struct EOS_Traits<RiemannBench> {
+  static constexpr double gamma = 5. / 3.;
+  static constexpr bool reconstruct_eint = true;
+};
+
+namespace {
+// time a kernel launch sequence: one warm-up launch, then 'niter' timed
+// launches bracketed by stream synchronization. returns seconds per launch.
+template <typename F> auto timeKernel(const int niter, F &&kernel) -> double {
+  kernel(); // warm-up (page in FABs, JIT-compile on first launch)
+  amrex::Gpu::streamSynchronize();
+  const double t_start = amrex::second();
+  for (int it = 0; it < niter; ++it) {
+    kernel();
+  }
+  amrex::Gpu::streamSynchronize();
+  return (amrex::second() - t_start) / static_cast<double>(niter);
+}
+
+void reportRate(const char *name, const double time_sec,
+                const double n_interfaces, const double bytes_per_iface,
+                const double flops_per_iface) {
+  amrex::Print() << name << ":\n"
+                 << "\t" << time_sec * 1.0e6 << " us per launch ("
+                 << time_sec / n_interfaces * 1.0e9 << " ns per interface)\n"
+                 << "\t" << n_interfaces * bytes_per_iface / time_sec / 1.0e9
+                 << " GB/s effective bandwidth (counted traffic)\n"
+                 << "\t" << n_interfaces * flops_per_iface / time_sec / 1.0e9
+                 << " GFLOP/s (approximate FLOP count)\n";
+}
+} // namespace
+
+auto problem_main() -> int {
+  constexpr int nvars = HydroSystem<RiemannBench>::nvar_;
+  constexpr double gamma = HydroSystem<RiemannBench>::gamma_;
+  constexpr int nghost = 4; // == AMRSimulation<>::nghost_
+
+  int box_size = 64;
+  int iterations = 100;
+  amrex::ParmParse const pp("benchmark");
+  pp.query("box_size", box_size);
+  pp.query("iterations", iterations);
+
+  amrex::Box const indexRange(amrex::IntVect(AMREX_D_DECL(0, 0, 0)),
+                              amrex::IntVect(AMREX_D_DECL(
+                                  box_size - 1, box_size - 1, box_size - 1)));
+  amrex::Box const ghostRange = amrex::grow(indexRange, nghost);
+  amrex::Box const flatteningRange = amrex::grow(indexRange, 2);
+  amrex::Box const x1FluxRange = amrex::surroundingNodes(indexRange, 0);
+
+  // synthetic conserved state: a Sod-like jump at the box midplane with a
+  // small smooth ripple, so the reconstruction stencils and the flattening
+  // logic both see non-trivial input
+  amrex::FArrayBox consFab(ghostRange, nvars);
+  auto const &cons = consFab.array();
+  const int i_jump = box_size / 2;
+  amrex::ParallelFor(
+      ghostRange, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        const double ripple = 1.0 + 0.01 * std::sin(0.5 * (i + j + k));
+        const double rho = ((i < i_jump) ? 1.0 : 0.125) * ripple;
+        const double P = ((i < i_jump) ? 1.0 : 0.1) * ripple;
+        const double vx = (i < i_jump) ? 0.1 : -0.1;
+        cons(i, j, k, HydroSystem<RiemannBench>::density_index) = rho;
+        cons(i, j, k, HydroSystem<RiemannBench>::x1Momentum_index) = rho * vx;
+        cons(i, j, k, HydroSystem<RiemannBench>::x2Momentum_index) = 0.;
+        cons(i, j, k, HydroSystem<RiemannBench>::x3Momentum_index) = 0.;
+        cons(i, j, k, HydroSystem<RiemannBench>::energy_index) =
+            P / (gamma - 1.0) + 0.5 * rho * vx * vx;
+      });
+
+  // inputs for the timed kernels, computed once (these are the persistent
+  // scratch MultiFabs in the real solver)
+  amrex::FArrayBox primFab(ghostRange, nvars);
+  amrex::FArrayBox x1ChiFab(flatteningRange, 1);
+  amrex::FArrayBox x2ChiFab(flatteningRange, 1);
+  amrex::FArrayBox x3ChiFab(flatteningRange, 1);
+  array_t primVar = primFab.array();
+  array_t x1Chi = x1ChiFab.array();
+  array_t x2Chi = x2ChiFab.array();
+  array_t x3Chi = x3ChiFab.array();
+  HydroSystem<RiemannBench>::ConservedToPrimitive(consFab.const_array(),
+                                                  primVar, ghostRange);
+  AMREX_D_TERM(
+      HydroSystem<RiemannBench>::ComputeFlatteningCoefficients<FluxDir::X1>(
+          primVar, x1Chi, flatteningRange);
+      , HydroSystem<RiemannBench>::ComputeFlatteningCoefficients<FluxDir::X2>(
+            primVar, x2Chi, flatteningRange);
+      , HydroSystem<RiemannBench>::ComputeFlatteningCoefficients<FluxDir::X3>(
+            primVar, x3Chi, flatteningRange);)
+
+  // outputs for the timed kernels (interface-centered in x)
+  amrex::FArrayBox x1LeftFab(x1FluxRange, nvars);
+  amrex::FArrayBox x1RightFab(x1FluxRange, nvars);
+  amrex::FArrayBox x1FluxFab(x1FluxRange, nvars);
+  array_t x1Left = x1LeftFab.array();
+  array_t x1Right = x1RightFab.array();
+  array_t x1Flux = x1FluxFab.array();
+
+  const double t_ppm = timeKernel(iterations, [&] {
+    HydroSystem<RiemannBench>::ReconstructFlattenedStatesPPM<FluxDir::X1>(
+        primVar, x1Chi, x2Chi, x3Chi, x1Left, x1Right, x1FluxRange, nvars);
+  });
+  const double t_hllc = timeKernel(iterations, [&] {
+    HydroSystem<RiemannBench>::ComputeFluxes<FluxDir::X1>(
+        x1Flux, x1LeftFab.const_array(), x1RightFab.const_array(), primVar,
+        x1FluxRange);
+  });
+
+  const auto n_iface = static_cast<double>(x1FluxRange.numPts());
+  amrex::Print() << "Riemann/reconstruction microbenchmark: "
+                 << indexRange.numPts() << " cells, " << n_iface
+                 << " x-interfaces, " << iterations << " iterations\n";
+
+  // byte-traffic models (doubles; stencil reuse through cache not counted):
+  //  fused PPM reads a 6-cell stencil per variable plus 3 flattening
+  //  coefficients and writes both interface states; HLLC reads the two
+  //  interface states plus the two adjacent primitive cells (for the
+  //  pressure-based wave-speed estimate) and writes one flux vector.
+  const double bytes_ppm = (6.0 * nvars + 3.0 + 2.0 * nvars) * 8.0;
+  const double bytes_hllc = (2.0 * nvars + 2.0 * nvars + 1.0 * nvars) * 8.0;
+  // approximate per-interface FLOP counts (hand-counted from the kernels;
+  // limiter/flattening branches counted as taken)
+  const double flops_ppm = 60.0 * nvars;
+  const double flops_hllc = 180.0;
+
+  reportRate("ReconstructFlattenedStatesPPM<X1>", t_ppm, n_iface, bytes_ppm,
+             flops_ppm);
+  reportRate("ComputeFluxes<X1> (HLLC)", t_hllc, n_iface, bytes_hllc,
+             flops_hllc);
+
+  // sanity check so a broken kernel cannot silently report great numbers
+  int status = 0;
+  if (x1FluxFab.contains_nan<amrex::RunOn::Device>(x1FluxRange, 0, nvars)) {
+    amrex::Print() << "NaN(s) in benchmark fluxes!\n";
+    status = 1;
+  }
+  return status;
+}
@@ -0,0 +1,19 @@
+#ifndef BENCHMARK_RIEMANN_HPP_ // NOLINT
+#define BENCHMARK_RIEMANN_HPP_
+//==============================================================================
+// TwoMomentRad - a radiation transport library for patch-based AMR codes
+// Copyright 2020 Benjamin Wibking.
+// Released under the MIT license. See LICENSE file included in the GitHub repo.
+//==============================================================================
+/// \file benchmark_riemann.hpp
+/// \brief Defines a microbenchmark for the PPM reconstruction and HLLC
+/// Riemann solver kernels.
+///
+
+// internal headers
+
+#include "hydro_system.hpp"
+
+// function definitions
+
+#endif // BENCHMARK_RIEMANN_HPP_
@@ -216,6 +216,7 @@ AMRSimulation<ShockCloud>::setCustomBoundaryConditions(
 struct ODEUserData {
   Real rho;
   cloudyGpuConstTables tables;
+  Real T_prev; // previous temperature solution (warm start), or NAN
 };
 
 AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
@@ -244,8 +245,10 @@ user_rhs(Real /*t*/, quokka::valarray<Real, 1> &y_data,
     y_rhs[0] = cloudy_cooling_function(rho, Tmax, tables);
   } else {
     // ok, within tabulated cooling limits
-    const Real T = ComputeTgasFromEgas(rho, Eint, gamma, tables);
+    const Real T =
+        ComputeTgasFromEgas(rho, Eint, gamma, tables, udata->T_prev);
     if (!std::isnan(T)) { // temp iteration succeeded
+      udata->T_prev = T;
       y_rhs[0] = cloudy_cooling_function(rho, T, tables);
     } else { // temp iteration failed
       y_rhs[0] = NAN;
@@ -264,6 +267,17 @@ void computeCooling(amrex::MultiFab &mf, const Real dt_in,
   const Real reltol_floor = 0.01;
   const Real rtol = 1.0e-4; // not recommended to change this
 
+  // where the local cooling time exceeds this multiple of dt, a single
+  // explicit update is exact to machine precision and the adaptive ODE
+  // integration is skipped (can be overridden in the inputs file)
+  static Real tcool_over_dt_explicit = [] {
+    Real fac = 100.;
+    amrex::ParmParse pp;
+    pp.query("cooling_tcool_over_dt_explicit", fac);
+    return fac;
+  }();
+  const Real tcoolFac = tcool_over_dt_explicit;
+
   auto tables = cloudyTables.const_tables();
 
   const auto &ba = mf.boxArray();
@@ -289,7 +303,23 @@ void computeCooling(amrex::MultiFab &mf, const Real dt_in,
       Real Eint = RadSystem<ShockCloud>::ComputeEintFromEgas(rho, x1Mom, x2Mom,
                                                              x3Mom, Egas);
 
-      ODEUserData user_data{rho, tables};
+      // gate on the local cooling time: where tcool >> dt, a single
+      // first-order explicit update is exact to machine precision, so only
+      // the thermally unstable cells pay for the adaptive integration
+      const Real T0 = ComputeTgasFromEgas(
+          rho, Eint, HydroSystem<ShockCloud>::gamma_, tables);
+      const Real Edot0 = cloudy_cooling_function(rho, T0, tables);
+      const Real tcool = std::abs(Eint / Edot0); // +inf where Edot0 == 0
+
+      if (!std::isnan(T0) && (tcool > tcoolFac * dt)) {
+        const Real Egas_new = RadSystem<ShockCloud>::ComputeEgasFromEint(
+            rho, x1Mom, x2Mom, x3Mom, Eint + Edot0 * dt);
+        state(i, j, k, HydroSystem<ShockCloud>::energy_index) = Egas_new;
+        nsubsteps(i, j, k) = 1;
+        return;
+      }
+
+      ODEUserData user_data{rho, tables, T0};
       quokka::valarray<Real, 1> y = {Eint};
       quokka::valarray<Real, 1> abstol = {
           reltol_floor * ComputeEgasFromTgas(rho, T_floor,
@@ -415,36 +445,9 @@ void RadhydroSimulation<ShockCloud>::ErrorEst(int lev, amrex::TagBoxArray &tags,
   const Real eta_threshold = 0.1;            // gradient refinement threshold
   const Real q_min = std::sqrt(rho0 * rho1); // minimum density for refinement
 
-  for (amrex::MFIter mfi(state_new_[lev]); mfi.isValid(); ++mfi) {
-    const amrex::Box &box = mfi.validbox();
-    const auto state = state_new_[lev].const_array(mfi);
-    const auto tag = tags.array(mfi);
-    const int nidx = HydroSystem<ShockCloud>::density_index;
-
-    amrex::ParallelFor(box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-      Real const q = state(i, j, k, nidx);
-
-      Real const q_xplus = state(i + 1, j, k, nidx);
-      Real const q_xminus = state(i - 1, j, k, nidx);
-      Real const q_yplus = state(i, j + 1, k, nidx);
-      Real const q_yminus = state(i, j - 1, k, nidx);
-      Real const q_zplus = state(i, j, k + 1, nidx);
-      Real const q_zminus = state(i, j, k - 1, nidx);
-
-      Real const del_x =
-          std::max(std::abs(q_xplus - q), std::abs(q - q_xminus));
-      Real const del_y =
-          std::max(std::abs(q_yplus - q), std::abs(q - q_yminus));
-      Real const del_z =
-          std::max(std::abs(q_zplus - q), std::abs(q - q_zminus));
-
-      Real const gradient_indicator = std::max({del_x, del_y, del_z}) / q;
-
-      if ((gradient_indicator > eta_threshold) && (q > q_min)) {
-        tag(i, j, k) = amrex::TagBox::SET;
-      }
-    });
-  }
+  tagCellsByCriteria(lev, tags,
+                     quokka::RefineGradient{HydroSystem<ShockCloud>::density_index,
+                                            eta_threshold, q_min});
 }
 
 auto problem_main() -> int {
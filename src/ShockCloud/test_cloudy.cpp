@@ -34,6 +34,7 @@ template <> struct EOS_Traits<ShockCloud> {
 struct ODEUserData {
   Real rho;
   cloudyGpuConstTables tables;
+  Real T_prev; // previous temperature solution (warm start), or NAN
 };
 
 AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
@@ -62,8 +63,10 @@ user_rhs(Real /*t*/, quokka::valarray<Real, 1> &y_data,
     y_rhs[0] = cloudy_cooling_function(rho, Tmax, tables);
   } else {
     // ok, within tabulated cooling limits
-    const Real T = ComputeTgasFromEgas(rho, Eint, gamma, tables);
+    const Real T =
+        ComputeTgasFromEgas(rho, Eint, gamma, tables, udata->T_prev);
     if (!std::isnan(T)) { // temp iteration succeeded
+      udata->T_prev = T;
       y_rhs[0] = cloudy_cooling_function(rho, T, tables);
       AMREX_ASSERT(!std::isnan(y_rhs[0]));
     } else { // temp iteration failed
@@ -111,7 +114,7 @@ auto problem_main() -> int {
   const Real rtol = 1.0e-4;       // not recommended to change this
   constexpr Real T_floor = 100.0; // K
 
-  ODEUserData user_data{rho, tables};
+  ODEUserData user_data{rho, tables, NAN};
   quokka::valarray<Real, 1> y = {Eint};
   quokka::valarray<Real, 1> abstol = {
       reltol_floor * ComputeEgasFromTgas(rho, T_floor,
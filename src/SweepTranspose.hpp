@@ -0,0 +1,146 @@
+#ifndef SWEEPTRANSPOSE_HPP_ // NOLINT
+#define SWEEPTRANSPOSE_HPP_
+//==============================================================================
+// TwoMomentRad - a radiation transport library for patch-based AMR codes
+// Copyright 2020 Benjamin Wibking.
+// Released under the MIT license. See LICENSE file included in the GitHub repo.
+//==============================================================================
+/// \file SweepTranspose.hpp
+/// \brief Tile-blocked physical transposes between the mesh layout and a
+/// sweep-aligned layout in which the sweep direction is unit stride (used by
+/// the transposed X2/X3 sweep pipeline in CPU builds; see transposedSweeps_).
+
+#include <algorithm>
+
+#include <AMReX_Array4.H>
+#include <AMReX_Box.H>
+
+#include "ArrayView.hpp"
+
+namespace quokka
+{
+/// box bounds in sweep ("kernel") space. Array4View<DIR> maps kernel (i, j, k)
+/// onto physical indices, so a kernel launched over the permuted bounds with
+/// DIR == X1 touches exactly the cells the DIR-templated kernel would.
+/// (nodal flags are not carried over; only the integer bounds matter here, so
+/// permute the already-noded box, not the cell-centered one.)
+template <FluxDir DIR> auto permuteSweepBox(amrex::Box const &box) -> amrex::Box
+{
+	amrex::IntVect const lo = box.smallEnd();
+	amrex::IntVect const hi = box.bigEnd();
+	if constexpr (DIR == FluxDir::X2) {
+#if (AMREX_SPACEDIM == 3)
+		// view<X2>(i,j,k) == arr(k,i,j): kernel (i,j,k) = physical (y,z,x)
+		return {{lo[1], lo[2], lo[0]}, {hi[1], hi[2], hi[0]}};
+#else
+		// view<X2>(i,j,k) == arr(j,i,k): kernel (i,j,k) = physical (y,x,z)
+		return {{lo[1], lo[0], lo[2]}, {hi[1], hi[0], hi[2]}};
+#endif
+	} else if constexpr (DIR == FluxDir::X3) {
+		// view<X3>(i,j,k) == arr(j,k,i): kernel (i,j,k) = physical (z,x,y)
+		return {{lo[2], lo[0], lo[1]}, {hi[2], hi[0], hi[1]}};
+	} else {
+		return box;
+	}
+}
+
+/// component permutation matching the coordinate permutation: the velocity /
+/// momentum triple (components 1..3 in both the primitive and conserved
+/// orderings) follows the axes into the sweep frame, so the X1-templated
+/// Riemann solver sees the sweep-normal velocity in its usual slot. maps a
+/// kernel-frame component to the corresponding physical component.
+template <FluxDir DIR> struct SweepCompMap {
+	AMREX_FORCE_INLINE auto operator()(int n) const -> int
+	{
+		if constexpr (DIR == FluxDir::X1) {
+			return n;
+		}
+		if (n < 1 || n > 3) {
+			return n;
+		}
+		if constexpr (DIR == FluxDir::X2) {
+#if (AMREX_SPACEDIM == 3)
+			return (n == 3) ? 1 : n + 1; // kernel (x,y,z) = physical (y,z,x)
+#else
+			return (n == 3) ? 3 : (3 - n); // kernel (x,y,z) = physical (y,x,z)
+#endif
+		} else {
+			return (n == 1) ? 3 : n - 1; // kernel (x,y,z) = physical (z,x,y)
+		}
+	}
+};
+
+namespace detail
+{
+constexpr int transpose_tile = 16; // cells per tile edge (16 doubles == 2 cache lines)
+}
+
+/// gather the physical-layout 'src' into the sweep-aligned 'dst' over the
+/// kernel-space box 'dstBox'. tile-blocked so the strided source reads of a
+/// tile stay resident in L1/L2 while its unit-stride writes stream out.
+/// host-only: the transposed pipeline is selected in CPU builds.
+template <FluxDir DIR, typename F>
+void TransposeToSweep(amrex::Array4<const amrex::Real> const &src,
+		      amrex::Array4<amrex::Real> const &dst, amrex::Box const &dstBox,
+		      const int ncomp, F const &compMap)
+{
+	Array4View<const amrex::Real, DIR> const view(src);
+	auto const lo = amrex::lbound(dstBox);
+	auto const hi = amrex::ubound(dstBox);
+	constexpr int tile = detail::transpose_tile;
+	for (int n = 0; n < ncomp; ++n) {
+		int const nsrc = compMap(n);
+		for (int k0 = lo.z; k0 <= hi.z; k0 += tile) {
+			for (int j0 = lo.y; j0 <= hi.y; j0 += tile) {
+				for (int i0 = lo.x; i0 <= hi.x; i0 += tile) {
+					int const kmax = std::min(k0 + tile - 1, hi.z);
+					int const jmax = std::min(j0 + tile - 1, hi.y);
+					int const imax = std::min(i0 + tile - 1, hi.x);
+					for (int k = k0; k <= kmax; ++k) {
+						for (int j = j0; j <= jmax; ++j) {
+							for (int i = i0; i <= imax; ++i) {
+								dst(i, j, k, n) = view(i, j, k, nsrc);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+/// scatter the sweep-aligned 'src' (e.g. the fluxes) back into the
+/// physical-layout 'dst' over the kernel-space box 'srcBox', restoring the
+/// physical component ordering.
+template <FluxDir DIR, typename F>
+void TransposeFromSweep(amrex::Array4<const amrex::Real> const &src,
+			amrex::Array4<amrex::Real> const &dst, amrex::Box const &srcBox,
+			const int ncomp, F const &compMap)
+{
+	Array4View<amrex::Real, DIR> const view(dst);
+	auto const lo = amrex::lbound(srcBox);
+	auto const hi = amrex::ubound(srcBox);
+	constexpr int tile = detail::transpose_tile;
+	for (int n = 0; n < ncomp; ++n) {
+		int const ndst = compMap(n);
+		for (int k0 = lo.z; k0 <= hi.z; k0 += tile) {
+			for (int j0 = lo.y; j0 <= hi.y; j0 += tile) {
+				for (int i0 = lo.x; i0 <= hi.x; i0 += tile) {
+					int const kmax = std::min(k0 + tile - 1, hi.z);
+					int const jmax = std::min(j0 + tile - 1, hi.y);
+					int const imax = std::min(i0 + tile - 1, hi.x);
+					for (int k = k0; k <= kmax; ++k) {
+						for (int j = j0; j <= jmax; ++j) {
+							for (int i = i0; i <= imax; ++i) {
+								view(i, j, k, ndst) = src(i, j, k, n);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
+} // namespace quokka
+
+#endif // SWEEPTRANSPOSE_HPP_
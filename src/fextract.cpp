@@ -5,6 +5,7 @@
 
 #include "AMReX_Config.H"
 #include "AMReX_Geometry.H"
+#include "AMReX_GpuContainers.H"
 #include "AMReX_MultiFab.H"
 #include "AMReX_SPACE.H"
 #include <AMReX.H>
@@ -85,54 +86,82 @@ auto fextract(MultiFab &mf, Geometry &geom, const int idir,
 
   const IntVect ivloc{AMREX_D_DECL(iloc, jloc, kloc)};
 
-  Vector<Real> pos;
-  Vector<Vector<Real>> data(mf.nComp());
-
   IntVect rr{1};
   Box slice_box(ivloc * rr, ivloc * rr);
   slice_box.setSmall(idir, std::numeric_limits<int>::lowest());
   slice_box.setBig(idir, std::numeric_limits<int>::max());
 
+  const int ncomp = mf.nComp();
+
+  // host pass: intersect each box with the slice and assign packing offsets
+  Vector<int> offsets;
+  int totalpts = 0;
+  for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+    const Box bx = mfi.validbox() & slice_box;
+    if (bx.ok()) {
+      offsets.push_back(totalpts);
+      totalpts += static_cast<int>(bx.numPts());
+    }
+  }
+
+  // device pass: pack the slice cells of each intersecting box directly on
+  // the device (the previous host loops forced a device-to-host copy of
+  // every intersecting FAB). layout: pos[pt], then data[comp][pt].
+  Gpu::DeviceVector<Real> posDev(totalpts);
+  Gpu::DeviceVector<Real> dataDev(static_cast<std::size_t>(totalpts) * ncomp);
+  Real *const p_pos = posDev.data();
+  Real *const p_data = dataDev.data();
+  const int npts = totalpts;
   GpuArray<Real, AMREX_SPACEDIM> dx = dx0;
 
-  for (int ivar = 0; ivar < mf.nComp(); ++ivar) {
-    for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
-      const Box &bx = mfi.validbox() & slice_box;
-      if (bx.ok()) {
-        const auto &fab = mf.array(mfi);
-        const auto lo = amrex::lbound(bx);
-        const auto hi = amrex::ubound(bx);
-        for (int k = lo.z; k <= hi.z; ++k) {
-          for (int j = lo.y; j <= hi.y; ++j) {
-            for (int i = lo.x; i <= hi.x; ++i) {
-              if (pos.size() == data[ivar].size()) {
-                Array<Real, AMREX_SPACEDIM> p = {AMREX_D_DECL(
-                    problo[0] + static_cast<Real>(i + 0.5) * dx[0],
-                    problo[1] + static_cast<Real>(j + 0.5) * dx[1],
-                    problo[2] + static_cast<Real>(k + 0.5) * dx[2])};
-                pos.push_back(p[idir]);
-              }
-              data[ivar].push_back(fab(i, j, k, ivar));
-            }
-          }
-        }
-      }
+  int nb = 0;
+  for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+    const Box bx = mfi.validbox() & slice_box;
+    if (!bx.ok()) {
+      continue;
     }
+    const int offset = offsets[nb++];
+    auto const &fab = mf.const_array(mfi);
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+      const auto idx =
+          offset + bx.index(IntVect{AMREX_D_DECL(i, j, k)});
+      const IntVect iv{AMREX_D_DECL(i, j, k)};
+      p_pos[idx] = problo[idir] + (static_cast<Real>(iv[idir]) + 0.5) * dx[idir];
+      for (int n = 0; n < ncomp; ++n) {
+        p_data[static_cast<std::size_t>(n) * npts + idx] = fab(i, j, k, n);
+      }
+    });
+  }
+
+  // stage in pinned host memory for MPI
+  Gpu::PinnedVector<Real> posHost(totalpts);
+  Gpu::PinnedVector<Real> dataHost(static_cast<std::size_t>(totalpts) * ncomp);
+  Gpu::copyAsync(Gpu::deviceToHost, posDev.begin(), posDev.end(),
+                 posHost.begin());
+  Gpu::copyAsync(Gpu::deviceToHost, dataDev.begin(), dataDev.end(),
+                 dataHost.begin());
+  Gpu::streamSynchronize();
+
+  Vector<Real> pos(posHost.begin(), posHost.end());
+  Vector<Vector<Real>> data(ncomp);
+  for (int n = 0; n < ncomp; ++n) {
+    data[n].assign(dataHost.begin() + static_cast<std::size_t>(n) * totalpts,
+                   dataHost.begin() + static_cast<std::size_t>(n + 1) * totalpts);
   }
 
 #ifdef AMREX_USE_MPI
   {
-    const int numpts = static_cast<int>(pos.size());
+    const int numpts = totalpts;
     auto numpts_vec = ParallelDescriptor::Gather(
         numpts, ParallelDescriptor::IOProcessorNumber());
     Vector<int> recvcnt;
     Vector<int> disp;
     Vector<Real> allpos;
-    Vector<Vector<Real>> alldata(data.size());
+    Vector<Real> allpacked;
+    int ntot = 0;
     if (ParallelDescriptor::IOProcessor()) {
       recvcnt.resize(numpts_vec.size());
       disp.resize(numpts_vec.size());
-      int ntot = 0;
       disp[0] = 0;
       for (int i = 0, N = static_cast<int>(numpts_vec.size()); i < N; ++i) {
         ntot += numpts_vec[i];
@@ -142,28 +171,43 @@ auto fextract(MultiFab &mf, Geometry &geom, const int idir,
         }
       }
       allpos.resize(ntot);
-      alldata.resize(data.size());
-      for (auto &v : alldata) {
-        v.resize(ntot);
-      }
+      allpacked.resize(static_cast<std::size_t>(ntot) * ncomp);
     } else {
       recvcnt.resize(1);
       disp.resize(1);
       allpos.resize(1);
-      for (auto &v : alldata) {
-        v.resize(1);
-      }
+      allpacked.resize(1);
     }
-    ParallelDescriptor::Gatherv(pos.data(), numpts, allpos.data(), recvcnt,
+    ParallelDescriptor::Gatherv(posHost.data(), numpts, allpos.data(), recvcnt,
                                 disp, ParallelDescriptor::IOProcessorNumber());
-    for (int i = 0; i < data.size(); ++i) {
-      ParallelDescriptor::Gatherv(data[i].data(), numpts, alldata[i].data(),
-                                  recvcnt, disp,
-                                  ParallelDescriptor::IOProcessorNumber());
+
+    // gather all components in a single Gatherv of the packed per-rank
+    // blocks (the per-component Gatherv loop cost ncomp collectives)
+    Vector<int> recvcnt_packed(recvcnt.size());
+    Vector<int> disp_packed(disp.size());
+    for (int i = 0; i < static_cast<int>(recvcnt.size()); ++i) {
+      recvcnt_packed[i] = recvcnt[i] * ncomp;
+      disp_packed[i] = disp[i] * ncomp;
     }
+    ParallelDescriptor::Gatherv(dataHost.data(), numpts * ncomp,
+                                allpacked.data(), recvcnt_packed, disp_packed,
+                                ParallelDescriptor::IOProcessorNumber());
+
     if (ParallelDescriptor::IOProcessor()) {
       pos = std::move(allpos);
-      data = std::move(alldata);
+      // unpack the rank-major blocks into per-component arrays
+      for (int n = 0; n < ncomp; ++n) {
+        data[n].resize(ntot);
+      }
+      for (int r = 0; r < static_cast<int>(numpts_vec.size()); ++r) {
+        for (int n = 0; n < ncomp; ++n) {
+          for (int p = 0; p < numpts_vec[r]; ++p) {
+            data[n][disp[r] + p] =
+                allpacked[static_cast<std::size_t>(disp_packed[r]) +
+                          static_cast<std::size_t>(n) * numpts_vec[r] + p];
+          }
+        }
+      }
     }
   }
 #endif // AMREX_USE_MPI
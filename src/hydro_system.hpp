@@ -10,13 +10,18 @@
 ///
 
 // c++ headers
+#include <type_traits>
 
 // library headers
 #include "AMReX_Arena.H"
 #include "AMReX_BLassert.H"
+#include "AMReX_Dim3.H"
 #include "AMReX_FArrayBox.H"
+#include "AMReX_GpuAtomic.H"
+#include "AMReX_GpuBuffer.H"
 #include "AMReX_Loop.H"
 #include "AMReX_REAL.H"
+#include "AMReX_Reduce.H"
 
 // internal headers
 #include "ArrayView.hpp"
@@ -33,6 +38,63 @@ template <typename problem_t> struct EOS_Traits {
   static constexpr bool reconstruct_eint = true;
 };
 
+// opt-in trait: problems may tune the threads-per-block launch bound of the
+// register-heavy flux and reconstruction kernels by adding
+//   static constexpr int gpu_launch_max_threads = 128;
+// to their EOS_Traits specialization. the HLLC lambda spills registers at the
+// AMReX default block size on some GPUs, and a smaller bound lets the
+// compiler keep it in registers (the value is ignored for CPU builds).
+namespace detail {
+template <typename problem_t, typename = void>
+struct gpu_launch_max_threads
+    : std::integral_constant<int, 256> {}; // the AMReX default block size
+template <typename problem_t>
+struct gpu_launch_max_threads<
+    problem_t,
+    std::void_t<decltype(EOS_Traits<problem_t>::gpu_launch_max_threads)>>
+    : std::integral_constant<int,
+                             EOS_Traits<problem_t>::gpu_launch_max_threads> {};
+
+// opt-in trait: problems may enable the dual-energy formalism by adding
+//   static constexpr bool dual_energy = true;
+// to their EOS_Traits specialization. an auxiliary internal energy density is
+// then advected as an extra conserved component and used in place of
+// (E - KE) wherever the thermal energy is a tiny fraction of the total, so
+// catastrophic cancellation at high Mach number no longer produces negative
+// pressures (and no longer triggers the first-order redo sweep).
+// problems must initialize the auxiliary component to rho * e_int in their
+// initial conditions.
+// N.B.: only supported for pure hydro problems -- the auxiliary component
+// overlays the radiation energy component of the state layout.
+template <typename problem_t, typename = void>
+struct dual_energy : std::false_type {};
+template <typename problem_t>
+struct dual_energy<problem_t,
+                   std::void_t<decltype(EOS_Traits<problem_t>::dual_energy)>>
+    : std::integral_constant<bool, EOS_Traits<problem_t>::dual_energy> {};
+
+// opt-in trait: problems may carry N passive scalars (metallicity, tracer
+// dyes for mixing diagnostics) by adding
+//   static constexpr int num_passive_scalars = N;
+// to their EOS_Traits specialization. the scalars occupy a block at the end
+// of the hydro state layout, are reconstructed and upwinded in the same
+// kernels as the dynamical variables (so N scalars cost incremental memory
+// bandwidth rather than extra sweeps), and advect with the contact
+// discontinuity through the HLLC solver exactly like the dual-energy
+// auxiliary component. problems must initialize the scalar components to
+// rho * s in their initial conditions.
+// N.B.: only supported for pure hydro problems -- the scalar block overlays
+// the radiation components of the state layout.
+template <typename problem_t, typename = void>
+struct nscalars : std::integral_constant<int, 0> {};
+template <typename problem_t>
+struct nscalars<
+    problem_t,
+    std::void_t<decltype(EOS_Traits<problem_t>::num_passive_scalars)>>
+    : std::integral_constant<int, EOS_Traits<problem_t>::num_passive_scalars> {
+};
+} // namespace detail
+
 /// Class for the Euler equations of inviscid hydrodynamics
 ///
 template <typename problem_t>
@@ -43,25 +105,44 @@ public:
     x1Momentum_index = 1,
     x2Momentum_index = 2,
     x3Momentum_index = 3,
-    energy_index = 4
+    energy_index = 4,
+    auxInternalEnergy_index = 5 // only exists when dual_energy_ is enabled
   };
   enum primVarIndex {
     primDensity_index = 0,
     x1Velocity_index = 1,
     x2Velocity_index = 2,
     x3Velocity_index = 3,
-    pressure_index = 4
+    pressure_index = 4,
+    primAuxEint_index = 5 // only exists when dual_energy_ is enabled
   };
 
-  static constexpr int nvar_ = 5;
+  static constexpr bool dual_energy_ = detail::dual_energy<problem_t>::value;
+  static constexpr int nscalars_ = detail::nscalars<problem_t>::value;
+
+  // for an isothermal EOS (gamma == 1), the energy component is never used:
+  // drop it at compile time so reconstruction, the Riemann solver, and the
+  // scratch MultiFabs carry one fewer component. with the dual-energy
+  // formalism, an auxiliary internal energy density is carried as an extra
+  // component. any passive scalars occupy a block at the end of the layout
+  // (see detail::nscalars).
+  static constexpr int nvar_ =
+      ((EOS_Traits<problem_t>::gamma == 1.0) ? 4 : (dual_energy_ ? 6 : 5)) +
+      nscalars_;
+
+  // first component of the passive scalar block; the conserved and primitive
+  // layouts coincide (conserved: rho * s, primitive: specific scalar s)
+  static constexpr int scalar0_index = nvar_ - nscalars_;
+  static constexpr int primScalar0_index = scalar0_index;
 
   static void ConservedToPrimitive(amrex::Array4<const amrex::Real> const &cons,
                                    array_t &primVar,
                                    amrex::Box const &indexRange);
 
-  static void
+  // fused device-side reduction to a scalar (requires GPU reductions)
+  static auto
   ComputeMaxSignalSpeed(amrex::Array4<const amrex::Real> const &cons,
-                        array_t &maxSignal, amrex::Box const &indexRange);
+                        amrex::Box const &indexRange) -> amrex::Real;
   // requires GPU reductions
   static auto CheckStatesValid(amrex::Box const &indexRange,
                                amrex::Array4<const amrex::Real> const &cons)
@@ -71,6 +152,13 @@ public:
                                    amrex::Box const &indexRange,
                                    amrex::Array4<amrex::Real> const &state);
 
+  // apply the density/pressure floors to a single cell (used by
+  // EnforcePressureFloor and fused into the RK update kernels)
+  AMREX_GPU_DEVICE static void
+  ApplyPressureFloor(amrex::Real densityFloor, amrex::Real pressureFloor,
+                     amrex::Array4<amrex::Real> const &state, int i, int j,
+                     int k);
+
   AMREX_GPU_DEVICE static auto
   ComputePressure(amrex::Array4<const amrex::Real> const &cons, int i, int j,
                   int k) -> amrex::Real;
@@ -79,19 +167,56 @@ public:
   isStateValid(amrex::Array4<const amrex::Real> const &cons, int i, int j,
                int k) -> bool;
 
+  // dual-energy formalism: synchronize the auxiliary internal energy with
+  // the conservative one, or vice versa (applied per cell in the RK update
+  // kernels after the flux update)
+  AMREX_GPU_DEVICE static void
+  SyncDualEnergy(amrex::Array4<amrex::Real> const &state, int i, int j, int k);
+
+  // cell-centered velocity divergence (central differences; requires one
+  // layer of valid ghost cells in 'cons')
+  AMREX_GPU_DEVICE static auto
+  ComputeVelocityDivergence(amrex::Array4<const amrex::Real> const &cons,
+                            amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx,
+                            int i, int j, int k) -> amrex::Real;
+
+  // the RK update kernels write a per-cell redo flag by default. with
+  // perCellFlags == false they run in speculative mode instead: no per-cell
+  // flag traffic, and an invalid cell sets a single per-box dirty bit (the
+  // first cell of 'redoFlag', which the caller must pre-clear)
+  template <int N_vars, bool perCellFlags = true>
   static void PredictStep(arrayconst_t &consVarOld, array_t &consVarNew,
                           std::array<arrayconst_t, AMREX_SPACEDIM> fluxArray,
                           double dt_in,
                           amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx_in,
-                          amrex::Box const &indexRange, int nvars,
-                          amrex::Array4<int> const &redoFlag);
+                          amrex::Box const &indexRange,
+                          amrex::Array4<int> const &redoFlag,
+                          amrex::Real densityFloor,
+                          amrex::Real pressureFloor);
 
+  template <int N_vars>
   static void AddFluxesRK2(array_t &U_new, arrayconst_t &U0, arrayconst_t &U1,
                            std::array<arrayconst_t, AMREX_SPACEDIM> fluxArray,
                            double dt_in,
                            amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx_in,
-                           amrex::Box const &indexRange, int nvars,
-                           amrex::Array4<int> const &redoFlag);
+                           amrex::Box const &indexRange,
+                           amrex::Array4<int> const &redoFlag,
+                           amrex::Real densityFloor,
+                           amrex::Real pressureFloor);
+
+  // generic Shu-Osher SSP stage:
+  //   U_new = w0 * U0 + w1 * [U1 + dt * L(U1)]
+  // AddFluxesRK2 is the special case (w0, w1) = (1/2, 1/2); the two later
+  // SSP-RK3 stages use (3/4, 1/4) and (1/3, 2/3).
+  template <int N_vars, bool perCellFlags = true>
+  static void AddFluxesSSP(array_t &U_new, arrayconst_t &U0, arrayconst_t &U1,
+                           std::array<arrayconst_t, AMREX_SPACEDIM> fluxArray,
+                           double dt_in, double w0, double w1,
+                           amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx_in,
+                           amrex::Box const &indexRange,
+                           amrex::Array4<int> const &redoFlag,
+                           amrex::Real densityFloor,
+                           amrex::Real pressureFloor);
 
   template <FluxDir DIR>
   static void
@@ -107,9 +232,25 @@ public:
                           array_t &x1FluxDiffusive,
                           amrex::Box const &indexRange);
 
+  // solve the Riemann problem at a single interface given gathered left/right
+  // primitive states (used by ComputeFluxes and the sparse first-order redo)
   template <FluxDir DIR>
+  [[nodiscard]] AMREX_GPU_DEVICE AMREX_FORCE_INLINE static auto
+  ComputeHLLCFlux(quokka::valarray<double, nvar_> const &primL,
+                  quokka::valarray<double, nvar_> const &primR,
+                  quokka::Array4View<const amrex::Real, DIR> const &q, int i,
+                  int j, int k) -> quokka::valarray<double, nvar_>;
+
+  static void ComputeFirstOrderFluxesSparse(
+      amrex::Array4<const amrex::Real> const &primVar,
+      std::array<amrex::Array4<amrex::Real>, AMREX_SPACEDIM> fluxArrays,
+      amrex::Dim3 const *cellList, int ncells);
+
+  // (T may be float for reduced-precision stencil storage; the coefficients
+  // themselves are always computed and stored in double)
+  template <FluxDir DIR, typename T = amrex::Real>
   static void
-  ComputeFlatteningCoefficients(amrex::Array4<const amrex::Real> const &primVar,
+  ComputeFlatteningCoefficients(amrex::Array4<const T> const &primVar,
                                 array_t &x1Chi, amrex::Box const &indexRange);
 
   template <FluxDir DIR>
@@ -120,12 +261,26 @@ public:
                             array_t &x1LeftState_in, array_t &x1RightState_in,
                             amrex::Box const &indexRange, int nvars);
 
+  // (T may be float for reduced-precision stencil storage: every load is
+  // promoted and the parabola/limiter arithmetic runs in double, so only
+  // the global-memory traffic of the stencil reads is halved)
+  template <FluxDir DIR, typename T = amrex::Real>
+  static void ReconstructFlattenedStatesPPM(
+      amrex::Array4<const T> const &q_in,
+      amrex::Array4<const amrex::Real> const &x1Chi_in,
+      amrex::Array4<const amrex::Real> const &x2Chi_in,
+      amrex::Array4<const amrex::Real> const &x3Chi_in,
+      array_t &x1LeftState_in, array_t &x1RightState_in,
+      amrex::Box const &interfaceRange, int nvars);
+
   // C++ does not allow constexpr to be uninitialized, even in a templated
   // class!
   static constexpr double gamma_ = EOS_Traits<problem_t>::gamma;
   static constexpr double cs_iso_ = EOS_Traits<problem_t>::cs_isothermal;
   static constexpr bool reconstruct_eint =
       EOS_Traits<problem_t>::reconstruct_eint;
+  static constexpr int max_gpu_threads_ =
+      detail::gpu_launch_max_threads<problem_t>::value;
 
   static constexpr auto is_eos_isothermal() -> bool { return (gamma_ == 1.0); }
 };
@@ -139,157 +294,258 @@ void HydroSystem<problem_t>::ConservedToPrimitive(
     const auto px = cons(i, j, k, x1Momentum_index);
     const auto py = cons(i, j, k, x2Momentum_index);
     const auto pz = cons(i, j, k, x3Momentum_index);
-    const auto E =
-        cons(i, j, k, energy_index); // *total* gas energy per unit volume
 
     AMREX_ASSERT(!std::isnan(rho));
     AMREX_ASSERT(!std::isnan(px));
     AMREX_ASSERT(!std::isnan(py));
     AMREX_ASSERT(!std::isnan(pz));
-    AMREX_ASSERT(!std::isnan(E));
+    AMREX_ASSERT(rho > 0.);
 
     const auto vx = px / rho;
     const auto vy = py / rho;
     const auto vz = pz / rho;
-    const auto kinetic_energy = 0.5 * rho * (vx * vx + vy * vy + vz * vz);
-    const auto thermal_energy = E - kinetic_energy;
-
-    const auto P = thermal_energy * (HydroSystem<problem_t>::gamma_ - 1.0);
-    const auto eint = thermal_energy / rho; // specific internal energy
-
-    AMREX_ASSERT(rho > 0.);
-    if constexpr (!is_eos_isothermal()) {
-      AMREX_ASSERT(P > 0.);
-    }
 
     primVar(i, j, k, primDensity_index) = rho;
     primVar(i, j, k, x1Velocity_index) = vx;
     primVar(i, j, k, x2Velocity_index) = vy;
     primVar(i, j, k, x3Velocity_index) = vz;
-    if constexpr (reconstruct_eint) {
-      // save eint
-      primVar(i, j, k, pressure_index) = eint;
-    } else {
-      // save pressure
-      primVar(i, j, k, pressure_index) = P;
-    }
-  });
-}
 
-template <typename problem_t>
-void HydroSystem<problem_t>::ComputeMaxSignalSpeed(
-    amrex::Array4<const amrex::Real> const &cons, array_t &maxSignal,
-    amrex::Box const &indexRange) {
-  amrex::ParallelFor(indexRange, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-    const auto rho = cons(i, j, k, density_index);
-    const auto px = cons(i, j, k, x1Momentum_index);
-    const auto py = cons(i, j, k, x2Momentum_index);
-    const auto pz = cons(i, j, k, x3Momentum_index);
-    AMREX_ASSERT(!std::isnan(rho));
-    AMREX_ASSERT(!std::isnan(px));
-    AMREX_ASSERT(!std::isnan(py));
-    AMREX_ASSERT(!std::isnan(pz));
-
-    const auto vx = px / rho;
-    const auto vy = py / rho;
-    const auto vz = pz / rho;
-    const double vel_mag = std::sqrt(vx * vx + vy * vy + vz * vz);
-    double cs = NAN;
-
-    if constexpr (is_eos_isothermal()) {
-      cs = cs_iso_;
-    } else {
+    if constexpr (!is_eos_isothermal()) {
       const auto E =
           cons(i, j, k, energy_index); // *total* gas energy per unit volume
       AMREX_ASSERT(!std::isnan(E));
+
       const auto kinetic_energy = 0.5 * rho * (vx * vx + vy * vy + vz * vz);
       const auto thermal_energy = E - kinetic_energy;
+
       const auto P = thermal_energy * (HydroSystem<problem_t>::gamma_ - 1.0);
-      cs = std::sqrt(HydroSystem<problem_t>::gamma_ * P / rho);
+      const auto eint = thermal_energy / rho; // specific internal energy
+      AMREX_ASSERT(P > 0.);
+
+      if constexpr (reconstruct_eint) {
+        // save eint
+        primVar(i, j, k, pressure_index) = eint;
+      } else {
+        // save pressure
+        primVar(i, j, k, pressure_index) = P;
+      }
+
+      if constexpr (dual_energy_) {
+        // specific auxiliary internal energy (reconstructed like a velocity)
+        primVar(i, j, k, primAuxEint_index) =
+            cons(i, j, k, auxInternalEnergy_index) / rho;
+      }
     }
-    AMREX_ASSERT(cs > 0.);
 
-    const double signal_max = cs + vel_mag;
-    maxSignal(i, j, k) = signal_max;
+    // specific passive scalars (reconstructed like velocities)
+    for (int s = 0; s < nscalars_; ++s) {
+      primVar(i, j, k, primScalar0_index + s) =
+          cons(i, j, k, scalar0_index + s) / rho;
+    }
   });
 }
 
+template <typename problem_t>
+auto HydroSystem<problem_t>::ComputeMaxSignalSpeed(
+    amrex::Array4<const amrex::Real> const &cons, amrex::Box const &indexRange)
+    -> amrex::Real {
+  // compute the maximum signal speed over the box with a fused device-side
+  // reduction (this avoids materializing a per-cell signal speed array)
+  amrex::ReduceOps<amrex::ReduceOpMax> reduce_op;
+  amrex::ReduceData<amrex::Real> reduce_data(reduce_op);
+  using ReduceTuple = typename decltype(reduce_data)::Type;
+
+  reduce_op.eval(
+      indexRange, reduce_data,
+      [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+        const auto rho = cons(i, j, k, density_index);
+        const auto px = cons(i, j, k, x1Momentum_index);
+        const auto py = cons(i, j, k, x2Momentum_index);
+        const auto pz = cons(i, j, k, x3Momentum_index);
+        AMREX_ASSERT(!std::isnan(rho));
+        AMREX_ASSERT(!std::isnan(px));
+        AMREX_ASSERT(!std::isnan(py));
+        AMREX_ASSERT(!std::isnan(pz));
+
+        const auto vx = px / rho;
+        const auto vy = py / rho;
+        const auto vz = pz / rho;
+        const double vel_mag = std::sqrt(vx * vx + vy * vy + vz * vz);
+        double cs = NAN;
+
+        if constexpr (is_eos_isothermal()) {
+          cs = cs_iso_;
+        } else {
+          const auto E =
+              cons(i, j, k, energy_index); // *total* gas energy per unit volume
+          AMREX_ASSERT(!std::isnan(E));
+          const auto kinetic_energy = 0.5 * rho * (vx * vx + vy * vy + vz * vz);
+          const auto thermal_energy = E - kinetic_energy;
+          const auto P = thermal_energy * (HydroSystem<problem_t>::gamma_ - 1.0);
+          cs = std::sqrt(HydroSystem<problem_t>::gamma_ * P / rho);
+        }
+        AMREX_ASSERT(cs > 0.);
+
+        return {cs + vel_mag};
+      });
+
+  amrex::Real const signal_max = amrex::get<0>(reduce_data.value());
+  AMREX_ASSERT(!std::isnan(signal_max));
+  return signal_max;
+}
+
 template <typename problem_t>
 auto HydroSystem<problem_t>::CheckStatesValid(
     amrex::Box const &indexRange, amrex::Array4<const amrex::Real> const &cons)
     -> bool {
-  bool areValid = true;
-  AMREX_LOOP_3D(indexRange, i, j, k, {
+  // check whether the cell at (i, j, k) is a valid hydro state
+  auto isValid = [=] AMREX_GPU_DEVICE(int i, int j, int k) -> bool {
     const auto rho = cons(i, j, k, density_index);
-    const auto px = cons(i, j, k, x1Momentum_index);
-    const auto py = cons(i, j, k, x2Momentum_index);
-    const auto pz = cons(i, j, k, x3Momentum_index);
-    const auto E =
-        cons(i, j, k, energy_index); // *total* gas energy per unit volume
-    const auto vx = px / rho;
-    const auto vy = py / rho;
-    const auto vz = pz / rho;
-    const auto kinetic_energy = 0.5 * rho * (vx * vx + vy * vy + vz * vz);
-    const auto thermal_energy = E - kinetic_energy;
-    const auto P = thermal_energy * (HydroSystem<problem_t>::gamma_ - 1.0);
-
     bool negativeDensity = (rho <= 0.);
-    bool negativePressure = (P <= 0.);
 
     if constexpr (is_eos_isothermal()) {
-      if (negativeDensity) {
-        areValid = false;
-        printf("invalid state at (%d, %d, %d): rho %g\n", i, j, k, rho);
-      }
+      return !negativeDensity;
     } else {
-      if (negativeDensity || negativePressure) {
-        areValid = false;
-        printf("invalid state at (%d, %d, %d): "
-               "rho %g, Etot %g, Eint %g, P %g\n",
-               i, j, k, rho, E, thermal_energy, P);
-      }
+      const auto px = cons(i, j, k, x1Momentum_index);
+      const auto py = cons(i, j, k, x2Momentum_index);
+      const auto pz = cons(i, j, k, x3Momentum_index);
+      const auto E =
+          cons(i, j, k, energy_index); // *total* gas energy per unit volume
+      const auto vx = px / rho;
+      const auto vy = py / rho;
+      const auto vz = pz / rho;
+      const auto kinetic_energy = 0.5 * rho * (vx * vx + vy * vy + vz * vz);
+      const auto thermal_energy = E - kinetic_energy;
+      const auto P = thermal_energy * (HydroSystem<problem_t>::gamma_ - 1.0);
+      bool negativePressure = (P <= 0.);
+      return !(negativeDensity || negativePressure);
     }
-  })
+  };
+
+  // reduce on the device (the previous host loop single-threaded the scan and
+  // forced device-resident FABs back to host-visible memory)
+  amrex::ReduceOps<amrex::ReduceOpLogicalAnd> reduce_op;
+  amrex::ReduceData<int> reduce_data(reduce_op);
+  using ReduceTuple = typename decltype(reduce_data)::Type;
+
+  reduce_op.eval(indexRange, reduce_data,
+                 [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                   return {static_cast<int>(isValid(i, j, k))};
+                 });
+
+  const bool areValid = (amrex::get<0>(reduce_data.value()) != 0);
+
+  if (!areValid) {
+    // gather diagnostics for the first few offending cells into a small
+    // device buffer (a printf per bad cell is very slow on GPUs and can
+    // flood the log)
+    constexpr int maxBadCells = 8;
+    constexpr int recordSize = 7; // (i, j, k, rho, Etot, Eint, P)
+    amrex::Vector<amrex::Real> zeros(maxBadCells * recordSize, 0.0);
+    amrex::Gpu::Buffer<amrex::Real> diag_buf(zeros.data(), zeros.size());
+    amrex::Gpu::Buffer<int> count_buf({0});
+    amrex::Real *const diag = diag_buf.data();
+    int *const count = count_buf.data();
+
+    amrex::ParallelFor(
+        indexRange, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          if (!isValid(i, j, k)) {
+            const int slot = amrex::Gpu::Atomic::Add(count, 1);
+            if (slot < maxBadCells) {
+              const auto rho = cons(i, j, k, density_index);
+              const auto px = cons(i, j, k, x1Momentum_index);
+              const auto py = cons(i, j, k, x2Momentum_index);
+              const auto pz = cons(i, j, k, x3Momentum_index);
+              amrex::Real E = NAN;
+              amrex::Real thermal_energy = NAN;
+              amrex::Real P = NAN;
+              if constexpr (!is_eos_isothermal()) {
+                E = cons(i, j, k, energy_index);
+                const auto kinetic_energy =
+                    0.5 * (px * px + py * py + pz * pz) / rho;
+                thermal_energy = E - kinetic_energy;
+                P = thermal_energy * (HydroSystem<problem_t>::gamma_ - 1.0);
+              }
+              amrex::Real *const rec = diag + slot * recordSize;
+              rec[0] = i;
+              rec[1] = j;
+              rec[2] = k;
+              rec[3] = rho;
+              rec[4] = E;
+              rec[5] = thermal_energy;
+              rec[6] = P;
+            }
+          }
+        });
+
+    amrex::Real const *const h_diag = diag_buf.copyToHost();
+    int const *const h_count = count_buf.copyToHost();
+    const int nbad = *h_count;
+    printf("%d invalid hydro state(s) found; showing the first %d:\n", nbad,
+           std::min(nbad, maxBadCells));
+    for (int s = 0; s < std::min(nbad, maxBadCells); ++s) {
+      amrex::Real const *const rec = h_diag + s * recordSize;
+      printf("invalid state at (%d, %d, %d): "
+             "rho %g, Etot %g, Eint %g, P %g\n",
+             static_cast<int>(rec[0]), static_cast<int>(rec[1]),
+             static_cast<int>(rec[2]), rec[3], rec[4], rec[5], rec[6]);
+    }
+  }
 
   return areValid;
 }
 
+template <typename problem_t>
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE void
+HydroSystem<problem_t>::ApplyPressureFloor(
+    amrex::Real const densityFloor, amrex::Real const pressureFloor,
+    amrex::Array4<amrex::Real> const &state, int i, int j, int k) {
+  // prevent vacuum creation
+  amrex::Real const rho = state(i, j, k, density_index);
+  amrex::Real const vx1 = state(i, j, k, x1Momentum_index) / rho;
+  amrex::Real const vx2 = state(i, j, k, x2Momentum_index) / rho;
+  amrex::Real const vx3 = state(i, j, k, x3Momentum_index) / rho;
+  amrex::Real const vsq = (vx1 * vx1 + vx2 * vx2 + vx3 * vx3);
+
+  amrex::Real rho_new = rho;
+  if (rho < densityFloor) {
+    rho_new = densityFloor;
+    state(i, j, k, density_index) = rho_new;
+  }
+
+  if constexpr (!is_eos_isothermal()) {
+    // recompute gas energy (to prevent P < 0)
+    amrex::Real const Etot = state(i, j, k, energy_index);
+    amrex::Real const Eint_star = Etot - 0.5 * rho_new * vsq;
+    amrex::Real const P_star = Eint_star * (gamma_ - 1.);
+    amrex::Real P_new = P_star;
+    if (P_star < pressureFloor) {
+      P_new = pressureFloor;
+#pragma nv_diag_suppress divide_by_zero
+      amrex::Real const Etot_new = P_new / (gamma_ - 1.) + 0.5 * rho_new * vsq;
+      state(i, j, k, energy_index) = Etot_new;
+    }
+
+    if constexpr (dual_energy_) {
+      // keep the auxiliary internal energy consistent with the pressure floor
+      amrex::Real const Eint_aux = state(i, j, k, auxInternalEnergy_index);
+      if (Eint_aux * (gamma_ - 1.) < pressureFloor) {
+        state(i, j, k, auxInternalEnergy_index) = pressureFloor / (gamma_ - 1.);
+      }
+    }
+  }
+}
+
 template <typename problem_t>
 void HydroSystem<problem_t>::EnforcePressureFloor(
     amrex::Real const densityFloor, amrex::Real const pressureFloor,
     amrex::Box const &indexRange, amrex::Array4<amrex::Real> const &state) {
-  // prevent vacuum creation
   amrex::Real const rho_floor = densityFloor; // workaround nvcc bug
   amrex::Real const P_floor = pressureFloor;
 
   amrex::ParallelFor(
       indexRange, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        amrex::Real const rho = state(i, j, k, density_index);
-        amrex::Real const vx1 = state(i, j, k, x1Momentum_index) / rho;
-        amrex::Real const vx2 = state(i, j, k, x2Momentum_index) / rho;
-        amrex::Real const vx3 = state(i, j, k, x3Momentum_index) / rho;
-        amrex::Real const vsq = (vx1 * vx1 + vx2 * vx2 + vx3 * vx3);
-        amrex::Real const Etot = state(i, j, k, energy_index);
-
-        amrex::Real rho_new = rho;
-        if (rho < rho_floor) {
-          rho_new = rho_floor;
-          state(i, j, k, density_index) = rho_new;
-        }
-
-        if (!is_eos_isothermal()) {
-          // recompute gas energy (to prevent P < 0)
-          amrex::Real const Eint_star = Etot - 0.5 * rho_new * vsq;
-          amrex::Real const P_star = Eint_star * (gamma_ - 1.);
-          amrex::Real P_new = P_star;
-          if (P_star < P_floor) {
-            P_new = P_floor;
-#pragma nv_diag_suppress divide_by_zero
-            amrex::Real const Etot_new =
-                P_new / (gamma_ - 1.) + 0.5 * rho_new * vsq;
-            state(i, j, k, energy_index) = Etot_new;
-          }
-        }
+        ApplyPressureFloor(rho_floor, P_floor, state, i, j, k);
       });
 }
 
@@ -299,18 +555,23 @@ HydroSystem<problem_t>::ComputePressure(
     amrex::Array4<const amrex::Real> const &cons, int i, int j, int k)
     -> amrex::Real {
   const auto rho = cons(i, j, k, density_index);
-  const auto px = cons(i, j, k, x1Momentum_index);
-  const auto py = cons(i, j, k, x2Momentum_index);
-  const auto pz = cons(i, j, k, x3Momentum_index);
-  const auto E =
-      cons(i, j, k, energy_index); // *total* gas energy per unit volume
-  const auto vx = px / rho;
-  const auto vy = py / rho;
-  const auto vz = pz / rho;
-  const auto kinetic_energy = 0.5 * rho * (vx * vx + vy * vy + vz * vz);
-  const auto thermal_energy = E - kinetic_energy;
-  const auto P = thermal_energy * (HydroSystem<problem_t>::gamma_ - 1.0);
-  return P;
+
+  if constexpr (is_eos_isothermal()) {
+    return rho * (cs_iso_ * cs_iso_);
+  } else {
+    const auto px = cons(i, j, k, x1Momentum_index);
+    const auto py = cons(i, j, k, x2Momentum_index);
+    const auto pz = cons(i, j, k, x3Momentum_index);
+    const auto E =
+        cons(i, j, k, energy_index); // *total* gas energy per unit volume
+    const auto vx = px / rho;
+    const auto vy = py / rho;
+    const auto vz = pz / rho;
+    const auto kinetic_energy = 0.5 * rho * (vx * vx + vy * vy + vz * vz);
+    const auto thermal_energy = E - kinetic_energy;
+    const auto P = thermal_energy * (HydroSystem<problem_t>::gamma_ - 1.0);
+    return P;
+  }
 }
 
 template <typename problem_t>
@@ -321,23 +582,78 @@ AMREX_GPU_DEVICE AMREX_FORCE_INLINE auto HydroSystem<problem_t>::isStateValid(
   bool isDensityPositive = (rho > 0.);
   bool isPressurePositive = false;
 
-  if constexpr (!is_eos_isothermal()) {
+  if constexpr (is_eos_isothermal()) {
+    isPressurePositive = true;
+  } else if constexpr (dual_energy_) {
+    // with the dual-energy formalism, a negative (E - KE) from catastrophic
+    // cancellation is recoverable from the auxiliary internal energy, so only
+    // the auxiliary field must remain positive
+    isPressurePositive = (cons(i, j, k, auxInternalEnergy_index) > 0.);
+  } else {
     const amrex::Real P = ComputePressure(cons, i, j, k);
     isPressurePositive = (P > 0.);
-  } else {
-    isPressurePositive = true;
   }
 
   return (isDensityPositive && isPressurePositive);
 }
 
 template <typename problem_t>
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE void HydroSystem<problem_t>::SyncDualEnergy(
+    amrex::Array4<amrex::Real> const &state, int i, int j, int k) {
+  // if the conservatively-computed thermal energy is well-resolved, it is the
+  // more accurate one, so re-synchronize the auxiliary field to it. otherwise
+  // (thermal energy a tiny fraction of the total, i.e. high Mach number),
+  // rebuild the total energy from the advected auxiliary internal energy
+  // [Bryan et al., ApJS 211, 19 (2014), Sec. 8.2].
+  constexpr amrex::Real eta = 1.0e-3;
+
+  const amrex::Real rho = state(i, j, k, density_index);
+  const amrex::Real px = state(i, j, k, x1Momentum_index);
+  const amrex::Real py = state(i, j, k, x2Momentum_index);
+  const amrex::Real pz = state(i, j, k, x3Momentum_index);
+  const amrex::Real Etot = state(i, j, k, energy_index);
+  const amrex::Real ke = 0.5 * (px * px + py * py + pz * pz) / rho;
+  const amrex::Real Eint_cons = Etot - ke;
+
+  if (Eint_cons > eta * Etot) {
+    state(i, j, k, auxInternalEnergy_index) = Eint_cons;
+  } else {
+    state(i, j, k, energy_index) =
+        ke + state(i, j, k, auxInternalEnergy_index);
+  }
+}
+
+template <typename problem_t>
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE auto
+HydroSystem<problem_t>::ComputeVelocityDivergence(
+    amrex::Array4<const amrex::Real> const &cons,
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const dx, int i, int j,
+    int k) -> amrex::Real {
+  auto v = [&cons](int ii, int jj, int kk, int n) {
+    return cons(ii, jj, kk, n) / cons(ii, jj, kk, density_index);
+  };
+
+  amrex::Real div = (v(i + 1, j, k, x1Momentum_index) -
+                     v(i - 1, j, k, x1Momentum_index)) / (2. * dx[0]);
+#if (AMREX_SPACEDIM >= 2)
+  div += (v(i, j + 1, k, x2Momentum_index) -
+          v(i, j - 1, k, x2Momentum_index)) / (2. * dx[1]);
+#endif
+#if (AMREX_SPACEDIM == 3)
+  div += (v(i, j, k + 1, x3Momentum_index) -
+          v(i, j, k - 1, x3Momentum_index)) / (2. * dx[2]);
+#endif
+  return div;
+}
+
+template <typename problem_t>
+template <int N_vars, bool perCellFlags>
 void HydroSystem<problem_t>::PredictStep(
     arrayconst_t &consVarOld, array_t &consVarNew,
     std::array<arrayconst_t, AMREX_SPACEDIM> fluxArray, const double dt_in,
     amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx_in,
-    amrex::Box const &indexRange, const int nvars_in,
-    amrex::Array4<int> const &redoFlag) {
+    amrex::Box const &indexRange, amrex::Array4<int> const &redoFlag,
+    amrex::Real const densityFloor, amrex::Real const pressureFloor) {
   BL_PROFILE("HydroSystem::PredictStep()");
 
   // By convention, the fluxes are defined on the left edge of each zone,
@@ -345,7 +661,9 @@ void HydroSystem<problem_t>::PredictStep(
   // left of zone i, and -1.0*flux(i+1) is the flux *into* zone i through
   // the interface on the right of zone i.
 
-  int const nvars = nvars_in; // workaround nvcc bug
+  // N_vars is a compile-time constant so that the component loop below
+  // fully unrolls and the flux differences stay register-resident.
+  constexpr int nvars = N_vars;
 
   auto const dt = dt_in;
   auto const dx = dx_in[0];
@@ -358,6 +676,7 @@ void HydroSystem<problem_t>::PredictStep(
   auto const dz = dx_in[2];
   auto const x3Flux = fluxArray[2];
 #endif
+  auto const flagCell = amrex::lbound(indexRange); // per-box dirty bit
 
   amrex::ParallelFor(
       indexRange, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
@@ -370,30 +689,72 @@ void HydroSystem<problem_t>::PredictStep(
                   +(dt / dz) * (x3Flux(i, j, k, n) - x3Flux(i, j, k + 1, n))));
         }
 
+        if constexpr (dual_energy_) {
+          // non-conservative source term d(rho e)/dt = -P div(v), evaluated
+          // from the old state (which has filled ghost cells); the pressure
+          // comes from the auxiliary field itself for robustness
+          const amrex::Real P_old =
+              consVarOld(i, j, k, auxInternalEnergy_index) * (gamma_ - 1.0);
+          consVarNew(i, j, k, auxInternalEnergy_index) -=
+              dt * P_old *
+              ComputeVelocityDivergence(consVarOld, dx_in, i, j, k);
+          SyncDualEnergy(consVarNew, i, j, k);
+        }
+
         // check if state is valid -- flag for re-do if not
-        if (!isStateValid(consVarNew, i, j, k)) {
-          redoFlag(i, j, k) = quokka::redoFlag::redo;
+        if constexpr (perCellFlags) {
+          if (!isStateValid(consVarNew, i, j, k)) {
+            redoFlag(i, j, k) = quokka::redoFlag::redo;
+          } else {
+            redoFlag(i, j, k) = quokka::redoFlag::none;
+            // apply floors while the state is still in cache (avoids a
+            // separate pass over the level)
+            ApplyPressureFloor(densityFloor, pressureFloor, consVarNew, i, j, k);
+          }
         } else {
-          redoFlag(i, j, k) = quokka::redoFlag::none;
+          // speculative mode: invalid cells set the per-box dirty bit (all
+          // failing threads store the same value, so the race is benign)
+          if (!isStateValid(consVarNew, i, j, k)) {
+            redoFlag(flagCell.x, flagCell.y, flagCell.z) =
+                quokka::redoFlag::redo;
+          } else {
+            ApplyPressureFloor(densityFloor, pressureFloor, consVarNew, i, j, k);
+          }
         }
       });
 }
 
 template <typename problem_t>
+template <int N_vars>
 void HydroSystem<problem_t>::AddFluxesRK2(
     array_t &U_new, arrayconst_t &U0, arrayconst_t &U1,
     std::array<arrayconst_t, AMREX_SPACEDIM> fluxArray, const double dt_in,
     amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx_in,
-    amrex::Box const &indexRange, const int nvars_in,
-    amrex::Array4<int> const &redoFlag) {
-  BL_PROFILE("HyperbolicSystem::AddFluxesRK2()");
+    amrex::Box const &indexRange, amrex::Array4<int> const &redoFlag,
+    amrex::Real const densityFloor, amrex::Real const pressureFloor) {
+  AddFluxesSSP<N_vars>(U_new, U0, U1, fluxArray, dt_in, 0.5, 0.5, dx_in,
+                       indexRange, redoFlag, densityFloor, pressureFloor);
+}
+
+template <typename problem_t>
+template <int N_vars, bool perCellFlags>
+void HydroSystem<problem_t>::AddFluxesSSP(
+    array_t &U_new, arrayconst_t &U0, arrayconst_t &U1,
+    std::array<arrayconst_t, AMREX_SPACEDIM> fluxArray, const double dt_in,
+    const double w0, const double w1,
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx_in,
+    amrex::Box const &indexRange, amrex::Array4<int> const &redoFlag,
+    amrex::Real const densityFloor, amrex::Real const pressureFloor) {
+  BL_PROFILE("HydroSystem::AddFluxesSSP()");
 
   // By convention, the fluxes are defined on the left edge of each zone,
   // i.e. flux_(i) is the flux *into* zone i through the interface on the
   // left of zone i, and -1.0*flux(i+1) is the flux *into* zone i through
   // the interface on the right of zone i.
 
-  int const nvars = nvars_in; // workaround nvcc bug
+  // N_vars is a compile-time constant so that the component loop below
+  // fully unrolls and the flux differences stay register-resident.
+  constexpr int nvars = N_vars;
 
   auto const dt = dt_in;
   auto const dx = dx_in[0];
@@ -406,11 +767,12 @@ void HydroSystem<problem_t>::AddFluxesRK2(
   auto const dz = dx_in[2];
   auto const x3Flux = fluxArray[2];
 #endif
+  auto const flagCell = amrex::lbound(indexRange); // per-box dirty bit
 
   amrex::ParallelFor(
       indexRange, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
         for (int n = 0; n < nvars; ++n) {
-          // RK-SSP2 integrator
+          // SSP convex combination of U0 and the forward-Euler update of U1
           const double U_0 = U0(i, j, k, n);
           const double U_1 = U1(i, j, k, n);
 
@@ -427,25 +789,49 @@ void HydroSystem<problem_t>::AddFluxesRK2(
 
           // save results in U_new
           U_new(i, j, k, n) =
-              (0.5 * U_0 + 0.5 * U_1) +
-              (AMREX_D_TERM(0.5 * FxU_1, +0.5 * FyU_1, +0.5 * FzU_1));
+              (w0 * U_0 + w1 * U_1) +
+              (AMREX_D_TERM(w1 * FxU_1, +w1 * FyU_1, +w1 * FzU_1));
+        }
+
+        if constexpr (dual_energy_) {
+          // this stage's contribution of the -P div(v) source term, evaluated
+          // from the intermediate state (which has filled ghost cells)
+          const amrex::Real P_1 =
+              U1(i, j, k, auxInternalEnergy_index) * (gamma_ - 1.0);
+          U_new(i, j, k, auxInternalEnergy_index) -=
+              w1 * dt * P_1 * ComputeVelocityDivergence(U1, dx_in, i, j, k);
+          SyncDualEnergy(U_new, i, j, k);
         }
 
         // check if state is valid -- flag for re-do if not
-        if (!isStateValid(U_new, i, j, k)) {
-          redoFlag(i, j, k) = quokka::redoFlag::redo;
+        if constexpr (perCellFlags) {
+          if (!isStateValid(U_new, i, j, k)) {
+            redoFlag(i, j, k) = quokka::redoFlag::redo;
+          } else {
+            redoFlag(i, j, k) = quokka::redoFlag::none;
+            // apply floors while the state is still in cache (avoids a
+            // separate pass over the level)
+            ApplyPressureFloor(densityFloor, pressureFloor, U_new, i, j, k);
+          }
         } else {
-          redoFlag(i, j, k) = quokka::redoFlag::none;
+          // speculative mode: invalid cells set the per-box dirty bit (all
+          // failing threads store the same value, so the race is benign)
+          if (!isStateValid(U_new, i, j, k)) {
+            redoFlag(flagCell.x, flagCell.y, flagCell.z) =
+                quokka::redoFlag::redo;
+          } else {
+            ApplyPressureFloor(densityFloor, pressureFloor, U_new, i, j, k);
+          }
         }
       });
 }
 
 template <typename problem_t>
-template <FluxDir DIR>
+template <FluxDir DIR, typename T>
 void HydroSystem<problem_t>::ComputeFlatteningCoefficients(
-    amrex::Array4<const amrex::Real> const &primVar_in, array_t &x1Chi_in,
+    amrex::Array4<const T> const &primVar_in, array_t &x1Chi_in,
     amrex::Box const &indexRange) {
-  quokka::Array4View<const amrex::Real, DIR> primVar(primVar_in);
+  quokka::Array4View<const T, DIR> primVar(primVar_in);
   quokka::Array4View<amrex::Real, DIR> x1Chi(x1Chi_in);
 
   // compute the PPM shock flattening coefficient following
@@ -463,28 +849,35 @@ void HydroSystem<problem_t>::ComputeFlatteningCoefficients(
                                                       int k_in) {
     auto [i, j, k] = quokka::reorderMultiIndex<DIR>(i_in, j_in, k_in);
 
-    amrex::Real Pplus2 = primVar(i + 2, j, k, pressure_index);
-    amrex::Real Pplus1 = primVar(i + 1, j, k, pressure_index);
-    amrex::Real P = primVar(i, j, k, pressure_index);
-    amrex::Real Pminus1 = primVar(i - 1, j, k, pressure_index);
-    amrex::Real Pminus2 = primVar(i - 2, j, k, pressure_index);
-
-    if constexpr (reconstruct_eint) {
-      // compute (rho e) (gamma - 1)
-      Pplus2 *= primVar(i + 2, j, k, primDensity_index) * (gamma_ - 1.0);
-      Pplus1 *= primVar(i + 1, j, k, primDensity_index) * (gamma_ - 1.0);
-      P *= primVar(i, j, k, primDensity_index) * (gamma_ - 1.0);
-      Pminus1 *= primVar(i - 1, j, k, primDensity_index) * (gamma_ - 1.0);
-      Pminus2 *= primVar(i - 2, j, k, primDensity_index) * (gamma_ - 1.0);
-    }
+    amrex::Real Pplus2 = NAN;
+    amrex::Real Pplus1 = NAN;
+    amrex::Real P = NAN;
+    amrex::Real Pminus1 = NAN;
+    amrex::Real Pminus2 = NAN;
 
     if constexpr (is_eos_isothermal()) {
+      // the primitive variables carry no pressure lane; P = rho c_s^2
       const amrex::Real cs_sq = cs_iso_ * cs_iso_;
       Pplus2 = primVar(i + 2, j, k, primDensity_index) * cs_sq;
       Pplus1 = primVar(i + 1, j, k, primDensity_index) * cs_sq;
       P = primVar(i, j, k, primDensity_index) * cs_sq;
       Pminus1 = primVar(i - 1, j, k, primDensity_index) * cs_sq;
       Pminus2 = primVar(i - 2, j, k, primDensity_index) * cs_sq;
+    } else {
+      Pplus2 = primVar(i + 2, j, k, pressure_index);
+      Pplus1 = primVar(i + 1, j, k, pressure_index);
+      P = primVar(i, j, k, pressure_index);
+      Pminus1 = primVar(i - 1, j, k, pressure_index);
+      Pminus2 = primVar(i - 2, j, k, pressure_index);
+
+      if constexpr (reconstruct_eint) {
+        // compute (rho e) (gamma - 1)
+        Pplus2 *= primVar(i + 2, j, k, primDensity_index) * (gamma_ - 1.0);
+        Pplus1 *= primVar(i + 1, j, k, primDensity_index) * (gamma_ - 1.0);
+        P *= primVar(i, j, k, primDensity_index) * (gamma_ - 1.0);
+        Pminus1 *= primVar(i - 1, j, k, primDensity_index) * (gamma_ - 1.0);
+        Pminus2 *= primVar(i - 2, j, k, primDensity_index) * (gamma_ - 1.0);
+      }
     }
 
     // beta is a measure of shock resolution (Eq. 74 of Miller & Colella 2002)
@@ -578,6 +971,97 @@ void HydroSystem<problem_t>::FlattenShocks(
       });
 }
 
+// fused alternative to ReconstructStatesPPM + FlattenShocks: for each
+// interface, reconstruct the parabolae of the two adjacent cells in registers,
+// apply shock flattening, and write only the final interface states. the
+// separate kernels each write and re-read the full left/right state arrays
+// from global memory; recomputing each cell's parabola once per adjacent
+// interface trades a little arithmetic for that bandwidth, which is a large
+// net win on GPUs.
+template <typename problem_t>
+template <FluxDir DIR, typename T>
+void HydroSystem<problem_t>::ReconstructFlattenedStatesPPM(
+    amrex::Array4<const T> const &q_in,
+    amrex::Array4<const amrex::Real> const &x1Chi_in,
+    amrex::Array4<const amrex::Real> const &x2Chi_in,
+    amrex::Array4<const amrex::Real> const &x3Chi_in, array_t &x1LeftState_in,
+    array_t &x1RightState_in, amrex::Box const &interfaceRange,
+    const int nvars) {
+  BL_PROFILE("HydroSystem::ReconstructFlattenedStatesPPM()");
+
+  quokka::Array4View<const T, DIR> q(q_in);
+  quokka::Array4View<amrex::Real, DIR> x1LeftState(x1LeftState_in);
+  quokka::Array4View<amrex::Real, DIR> x1RightState(x1RightState_in);
+
+  // interface-centered kernel (launched with the problem's tuned launch
+  // bound -- see gpu_launch_max_threads)
+  amrex::ParallelFor<max_gpu_threads_>(
+      interfaceRange, nvars,
+      [=] AMREX_GPU_DEVICE(int i_in, int j_in, int k_in, int n) {
+        // permute array indices according to dir
+        auto [i, j, k] = quokka::reorderMultiIndex<DIR>(i_in, j_in, k_in);
+
+        // flattening coefficient of the cell at *unpermuted* indices
+        // (ci, cj, ck): the minimum over the adjacent cells along each axis
+        // (Eq. 86 of Miller & Colella 2001; Eq. 78 of Miller & Colella 2002)
+        auto flatteningCoeff = [&](int ci, int cj, int ck) {
+          return std::min({
+            x1Chi_in(ci - 1, cj, ck), x1Chi_in(ci, cj, ck),
+                x1Chi_in(ci + 1, cj, ck),
+#if (AMREX_SPACEDIM >= 2)
+                x2Chi_in(ci, cj - 1, ck), x2Chi_in(ci, cj, ck),
+                x2Chi_in(ci, cj + 1, ck),
+#endif
+#if (AMREX_SPACEDIM == 3)
+                x3Chi_in(ci, cj, ck - 1), x3Chi_in(ci, cj, ck),
+                x3Chi_in(ci, cj, ck + 1),
+#endif
+          });
+        };
+
+        // cell i lies to the right of this interface and has unpermuted
+        // indices (i_in, j_in, k_in); cell (i - 1) lies to the left
+        int li = i_in;
+        int lj = j_in;
+        int lk = k_in;
+        if constexpr (DIR == FluxDir::X1) {
+          li -= 1;
+        } else if constexpr (DIR == FluxDir::X2) {
+          lj -= 1;
+        } else if constexpr (DIR == FluxDir::X3) {
+          lk -= 1;
+        }
+
+        // right side of the interface: left edge of cell i
+        {
+          const std::pair<double, double> bounds =
+              std::minmax({q(i, j, k, n), q(i - 1, j, k, n), q(i + 1, j, k, n)});
+          const double a_minus =
+              HyperbolicSystem<problem_t>::template ReconstructCellPPM<DIR>(
+                  q, i, j, k, n, bounds)
+                  .first;
+          const double chi = flatteningCoeff(i_in, j_in, k_in);
+          const double a_mean = q(i, j, k, n);
+          // Eq. 70a of Miller & Colella 2002
+          x1RightState(i, j, k, n) = chi * a_minus + (1. - chi) * a_mean;
+        }
+
+        // left side of the interface: right edge of cell (i - 1)
+        {
+          const std::pair<double, double> bounds = std::minmax(
+              {q(i - 1, j, k, n), q(i - 2, j, k, n), q(i, j, k, n)});
+          const double a_plus =
+              HyperbolicSystem<problem_t>::template ReconstructCellPPM<DIR>(
+                  q, i - 1, j, k, n, bounds)
+                  .second;
+          const double chi = flatteningCoeff(li, lj, lk);
+          const double a_mean = q(i - 1, j, k, n);
+          // Eq. 70b of Miller & Colella 2002
+          x1LeftState(i, j, k, n) = chi * a_plus + (1. - chi) * a_mean;
+        }
+      });
+}
+
 template <typename problem_t>
 template <FluxDir DIR>
 void HydroSystem<problem_t>::ComputeFluxes(
@@ -597,236 +1081,348 @@ void HydroSystem<problem_t>::ComputeFluxes(
 
   // Indexing note: There are (nx + 1) interfaces for nx zones.
 
-  amrex::ParallelFor(indexRange, [=] AMREX_GPU_DEVICE(int i_in, int j_in,
-                                                      int k_in) {
+  // launched with the problem's tuned launch bound (see
+  // gpu_launch_max_threads): the HLLC lambda is register-heavy
+  amrex::ParallelFor<max_gpu_threads_>(
+      indexRange, [=] AMREX_GPU_DEVICE(int i_in, int j_in, int k_in) {
     auto [i, j, k] = quokka::reorderMultiIndex<DIR>(i_in, j_in, k_in);
 
-    // HLLC solver following Toro (1998) and Balsara (2017).
-    // [Carbuncle correction:
-    //  Minoshima & Miyoshi, "A low-dissipation HLLD approximate Riemann solver
-    //  	for a very wide range of Mach numbers," JCP (2021).]
-
     // gather left- and right- state variables
+    quokka::valarray<double, nvar_> primL{};
+    quokka::valarray<double, nvar_> primR{};
+    for (int n = 0; n < nvar_; ++n) {
+      primL[n] = x1LeftState(i, j, k, n);
+      primR[n] = x1RightState(i, j, k, n);
+    }
 
-    const double rho_L = x1LeftState(i, j, k, primDensity_index);
-    const double rho_R = x1RightState(i, j, k, primDensity_index);
+    const quokka::valarray<double, nvar_> F =
+        ComputeHLLCFlux<DIR>(primL, primR, q, i, j, k);
 
-    const double vx_L = x1LeftState(i, j, k, x1Velocity_index);
-    const double vx_R = x1RightState(i, j, k, x1Velocity_index);
+    x1Flux(i, j, k, density_index) = F[0];
+    x1Flux(i, j, k, x1Momentum_index) = F[1];
+    x1Flux(i, j, k, x2Momentum_index) = F[2];
+    x1Flux(i, j, k, x3Momentum_index) = F[3];
+    if constexpr (!is_eos_isothermal()) {
+      x1Flux(i, j, k, energy_index) = F[energy_index];
+    }
+    if constexpr (dual_energy_) {
+      x1Flux(i, j, k, auxInternalEnergy_index) = F[auxInternalEnergy_index];
+    }
+    for (int s = 0; s < nscalars_; ++s) {
+      x1Flux(i, j, k, scalar0_index + s) = F[scalar0_index + s];
+    }
+  });
+}
 
-    const double vy_L = x1LeftState(i, j, k, x2Velocity_index);
-    const double vy_R = x1RightState(i, j, k, x2Velocity_index);
+template <typename problem_t>
+template <FluxDir DIR>
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE auto HydroSystem<problem_t>::ComputeHLLCFlux(
+    quokka::valarray<double, nvar_> const &primL,
+    quokka::valarray<double, nvar_> const &primR,
+    quokka::Array4View<const amrex::Real, DIR> const &q, int i, int j, int k)
+    -> quokka::valarray<double, nvar_> {
+  // HLLC solver following Toro (1998) and Balsara (2017).
+  // [Carbuncle correction:
+  //  Minoshima & Miyoshi, "A low-dissipation HLLD approximate Riemann solver
+  //  	for a very wide range of Mach numbers," JCP (2021).]
 
-    const double vz_L = x1LeftState(i, j, k, x3Velocity_index);
-    const double vz_R = x1RightState(i, j, k, x3Velocity_index);
+  const double rho_L = primL[primDensity_index];
+  const double rho_R = primR[primDensity_index];
 
-    const double ke_L = 0.5 * rho_L * (vx_L * vx_L + vy_L * vy_L + vz_L * vz_L);
-    const double ke_R = 0.5 * rho_R * (vx_R * vx_R + vy_R * vy_R + vz_R * vz_R);
+  const double vx_L = primL[x1Velocity_index];
+  const double vx_R = primR[x1Velocity_index];
 
-    double P_L = NAN;
-    double P_R = NAN;
+  const double vy_L = primL[x2Velocity_index];
+  const double vy_R = primR[x2Velocity_index];
 
-    double E_L = NAN;
-    double E_R = NAN;
+  const double vz_L = primL[x3Velocity_index];
+  const double vz_R = primR[x3Velocity_index];
 
-    double cs_L = NAN;
-    double cs_R = NAN;
+  const double ke_L = 0.5 * rho_L * (vx_L * vx_L + vy_L * vy_L + vz_L * vz_L);
+  const double ke_R = 0.5 * rho_R * (vx_R * vx_R + vy_R * vy_R + vz_R * vz_R);
 
-    if constexpr (is_eos_isothermal()) {
-      P_L = rho_L * (cs_iso_ * cs_iso_);
-      P_R = rho_R * (cs_iso_ * cs_iso_);
+  double P_L = NAN;
+  double P_R = NAN;
 
-      cs_L = cs_iso_;
-      cs_R = cs_iso_;
-    } else {
-      if constexpr (reconstruct_eint) { // pressure_index is actually eint
-        // compute pressure from specific internal energy
-        const double eint_L = x1LeftState(i, j, k, pressure_index);
-        const double eint_R = x1RightState(i, j, k, pressure_index);
+  double E_L = NAN;
+  double E_R = NAN;
 
-        P_L = rho_L * eint_L * (gamma_ - 1.0);
-        P_R = rho_R * eint_R * (gamma_ - 1.0);
+  double cs_L = NAN;
+  double cs_R = NAN;
 
-      } else { // pressure_index is actually pressure
-        P_L = x1LeftState(i, j, k, pressure_index);
-        P_R = x1RightState(i, j, k, pressure_index);
-      }
+  if constexpr (is_eos_isothermal()) {
+    P_L = rho_L * (cs_iso_ * cs_iso_);
+    P_R = rho_R * (cs_iso_ * cs_iso_);
 
-      cs_L = std::sqrt(gamma_ * P_L / rho_L);
-      cs_R = std::sqrt(gamma_ * P_R / rho_R);
+    cs_L = cs_iso_;
+    cs_R = cs_iso_;
+  } else {
+    if constexpr (reconstruct_eint) { // pressure_index is actually eint
+      // compute pressure from specific internal energy
+      const double eint_L = primL[pressure_index];
+      const double eint_R = primR[pressure_index];
 
-      E_L = P_L / (gamma_ - 1.0) + ke_L;
-      E_R = P_R / (gamma_ - 1.0) + ke_R;
-    }
+      P_L = rho_L * eint_L * (gamma_ - 1.0);
+      P_R = rho_R * eint_R * (gamma_ - 1.0);
 
-    AMREX_ASSERT(cs_L > 0.0);
-    AMREX_ASSERT(cs_R > 0.0);
+    } else { // pressure_index is actually pressure
+      P_L = primL[pressure_index];
+      P_R = primR[pressure_index];
+    }
 
-    // assign normal component of velocity according to DIR
+    cs_L = std::sqrt(gamma_ * P_L / rho_L);
+    cs_R = std::sqrt(gamma_ * P_R / rho_R);
 
-    double u_L = NAN;
-    double u_R = NAN;
-    int velN_index = x1Velocity_index;
-    int velV_index = x2Velocity_index;
-    int velW_index = x3Velocity_index;
+    E_L = P_L / (gamma_ - 1.0) + ke_L;
+    E_R = P_R / (gamma_ - 1.0) + ke_R;
+  }
 
-    if constexpr (DIR == FluxDir::X1) {
-      u_L = vx_L;
-      u_R = vx_R;
-      velN_index = x1Velocity_index;
-      velV_index = x2Velocity_index;
-      velW_index = x3Velocity_index;
-    } else if constexpr (DIR == FluxDir::X2) {
-      u_L = vy_L;
-      u_R = vy_R;
-      if constexpr (AMREX_SPACEDIM == 2) {
-        velN_index = x2Velocity_index;
-        velV_index = x1Velocity_index;
-        velW_index = x3Velocity_index; // unchanged in 2D
-      } else if constexpr (AMREX_SPACEDIM == 3) {
-        velN_index = x2Velocity_index;
-        velV_index = x3Velocity_index;
-        velW_index = x1Velocity_index;
-      }
-    } else if constexpr (DIR == FluxDir::X3) {
-      u_L = vz_L;
-      u_R = vz_R;
-      velN_index = x3Velocity_index;
+  AMREX_ASSERT(cs_L > 0.0);
+  AMREX_ASSERT(cs_R > 0.0);
+
+  // assign normal component of velocity according to DIR
+
+  double u_L = NAN;
+  double u_R = NAN;
+  int velN_index = x1Velocity_index;
+  int velV_index = x2Velocity_index;
+  int velW_index = x3Velocity_index;
+
+  if constexpr (DIR == FluxDir::X1) {
+    u_L = vx_L;
+    u_R = vx_R;
+    velN_index = x1Velocity_index;
+    velV_index = x2Velocity_index;
+    velW_index = x3Velocity_index;
+  } else if constexpr (DIR == FluxDir::X2) {
+    u_L = vy_L;
+    u_R = vy_R;
+    if constexpr (AMREX_SPACEDIM == 2) {
+      velN_index = x2Velocity_index;
       velV_index = x1Velocity_index;
-      velW_index = x2Velocity_index;
+      velW_index = x3Velocity_index; // unchanged in 2D
+    } else if constexpr (AMREX_SPACEDIM == 3) {
+      velN_index = x2Velocity_index;
+      velV_index = x3Velocity_index;
+      velW_index = x1Velocity_index;
     }
+  } else if constexpr (DIR == FluxDir::X3) {
+    u_L = vz_L;
+    u_R = vz_R;
+    velN_index = x3Velocity_index;
+    velV_index = x1Velocity_index;
+    velW_index = x2Velocity_index;
+  }
 
-    // compute PVRS states (Toro 10.5.2)
+  // compute PVRS states (Toro 10.5.2)
 
-    const double rho_bar = 0.5 * (rho_L + rho_R);
-    const double cs_bar = 0.5 * (cs_L + cs_R);
-    const double P_PVRS =
-        0.5 * (P_L + P_R) - 0.5 * (u_R - u_L) * (rho_bar * cs_bar);
-    const double P_star = std::max(P_PVRS, 0.0);
+  const double rho_bar = 0.5 * (rho_L + rho_R);
+  const double cs_bar = 0.5 * (cs_L + cs_R);
+  const double P_PVRS =
+      0.5 * (P_L + P_R) - 0.5 * (u_R - u_L) * (rho_bar * cs_bar);
+  const double P_star = std::max(P_PVRS, 0.0);
 
-    const double q_L = (P_star <= P_L)
-                           ? 1.0
-                           : std::sqrt(1.0 + ((gamma_ + 1.0) / (2.0 * gamma_)) *
-                                                 ((P_star / P_L) - 1.0));
+  const double q_L = (P_star <= P_L)
+                         ? 1.0
+                         : std::sqrt(1.0 + ((gamma_ + 1.0) / (2.0 * gamma_)) *
+                                               ((P_star / P_L) - 1.0));
 
-    const double q_R = (P_star <= P_R)
-                           ? 1.0
-                           : std::sqrt(1.0 + ((gamma_ + 1.0) / (2.0 * gamma_)) *
-                                                 ((P_star / P_R) - 1.0));
+  const double q_R = (P_star <= P_R)
+                         ? 1.0
+                         : std::sqrt(1.0 + ((gamma_ + 1.0) / (2.0 * gamma_)) *
+                                               ((P_star / P_R) - 1.0));
 
-    // compute wave speeds
+  // compute wave speeds
 
-    double S_L = u_L - q_L * cs_L;
-    double S_R = u_R + q_R * cs_R;
+  double S_L = u_L - q_L * cs_L;
+  double S_R = u_R + q_R * cs_R;
 
-    // carbuncle correction [Eq. 10 of Minoshima & Miyoshi (2021)]
-    const double cs_max = std::max(cs_L, cs_R);
-    // difference in normal velocity along normal axis
-    const double du = q(i, j, k, velN_index) - q(i - 1, j, k, velN_index);
-    // difference in transverse velocity
+  // carbuncle correction [Eq. 10 of Minoshima & Miyoshi (2021)]
+  const double cs_max = std::max(cs_L, cs_R);
+  // difference in normal velocity along normal axis
+  const double du = q(i, j, k, velN_index) - q(i - 1, j, k, velN_index);
+  // difference in transverse velocity
 #if AMREX_SPACEDIM == 1
-    const double dw = 0.;
+  const double dw = 0.;
 #else
-    amrex::Real dvl = std::min(q(i - 1, j + 1, k, velV_index) - q(i - 1, j, k, velV_index),
-                 q(i - 1, j, k, velV_index) - q(i - 1, j - 1, k, velV_index));
-    amrex::Real dvr = std::min(q(i, j + 1, k, velV_index) - q(i, j, k, velV_index),
-                 q(i, j, k, velV_index) - q(i, j - 1, k, velV_index));
-    double dw = std::min(dvl, dvr);
+  amrex::Real dvl = std::min(q(i - 1, j + 1, k, velV_index) - q(i - 1, j, k, velV_index),
+               q(i - 1, j, k, velV_index) - q(i - 1, j - 1, k, velV_index));
+  amrex::Real dvr = std::min(q(i, j + 1, k, velV_index) - q(i, j, k, velV_index),
+               q(i, j, k, velV_index) - q(i, j - 1, k, velV_index));
+  double dw = std::min(dvl, dvr);
 #endif
 #if AMREX_SPACEDIM == 3
-    amrex::Real dwl = std::min(q(i - 1, j, k + 1, velW_index) - q(i - 1, j, k, velW_index),
-                 q(i - 1, j, k, velW_index) - q(i - 1, j, k - 1, velW_index));
-    amrex::Real dwr = std::min(q(i, j, k + 1, velW_index) - q(i, j, k, velW_index),
-                 q(i, j, k, velW_index) - q(i, j, k - 1, velW_index));
-    dw = std::min(std::min(dwl, dwr), dw);
+  amrex::Real dwl = std::min(q(i - 1, j, k + 1, velW_index) - q(i - 1, j, k, velW_index),
+               q(i - 1, j, k, velW_index) - q(i - 1, j, k - 1, velW_index));
+  amrex::Real dwr = std::min(q(i, j, k + 1, velW_index) - q(i, j, k, velW_index),
+               q(i, j, k, velW_index) - q(i, j, k - 1, velW_index));
+  dw = std::min(std::min(dwl, dwr), dw);
 #endif
-    const double tp =
-        std::min(1., (cs_max - std::min(du, 0.)) / (cs_max - std::min(dw, 0.)));
-    const double theta = tp * tp * tp * tp;
-    // const double theta = 1.0;
-
-    const double S_star = (theta * (P_R - P_L) + (rho_L * u_L * (S_L - u_L) -
-                                                  rho_R * u_R * (S_R - u_R))) /
-                          (rho_L * (S_L - u_L) - rho_R * (S_R - u_R));
-
-    // Low-dissipation pressure correction 'phi' [Eq. 23 of Minoshima & Miyoshi]
-    const double vmag_L = std::sqrt(vx_L * vx_L + vy_L * vy_L + vz_L * vz_L);
-    const double vmag_R = std::sqrt(vx_R * vx_R + vy_R * vy_R + vz_R * vz_R);
-    const double chi = std::min(1., std::max(vmag_L, vmag_R) / cs_max);
-    const double phi = chi * (2. - chi);
-    // const double phi = 1.0;
-
-    const double P_LR =
-        0.5 * (P_L + P_R) + 0.5 * phi *
-                                (rho_L * (S_L - u_L) * (S_star - u_L) +
-                                 rho_R * (S_R - u_R) * (S_star - u_R));
-
-    // compute fluxes
-    constexpr int fluxdim = nvar_;
-
-    quokka::valarray<double, fluxdim> D_L{};
-    quokka::valarray<double, fluxdim> D_R{};
-    quokka::valarray<double, fluxdim> D_star{};
-
-    if constexpr (DIR == FluxDir::X1) {
-      D_L = {0., 1., 0., 0., u_L};
-      D_R = {0., 1., 0., 0., u_R};
-      D_star = {0., 1., 0., 0., S_star};
-    } else if constexpr (DIR == FluxDir::X2) {
-      D_L = {0., 0., 1., 0., u_L};
-      D_R = {0., 0., 1., 0., u_R};
-      D_star = {0., 0., 1., 0., S_star};
-    } else if constexpr (DIR == FluxDir::X3) {
-      D_L = {0., 0., 0., 1., u_L};
-      D_R = {0., 0., 0., 1., u_R};
-      D_star = {0., 0., 0., 1., S_star};
-    }
-
-    const quokka::valarray<double, fluxdim> U_L = {
-        rho_L, rho_L * vx_L, rho_L * vy_L, rho_L * vz_L, E_L};
-
-    const quokka::valarray<double, fluxdim> U_R = {
-        rho_R, rho_R * vx_R, rho_R * vy_R, rho_R * vz_R, E_R};
+  const double tp =
+      std::min(1., (cs_max - std::min(du, 0.)) / (cs_max - std::min(dw, 0.)));
+  const double theta = tp * tp * tp * tp;
+  // const double theta = 1.0;
+
+  const double S_star = (theta * (P_R - P_L) + (rho_L * u_L * (S_L - u_L) -
+                                                rho_R * u_R * (S_R - u_R))) /
+                        (rho_L * (S_L - u_L) - rho_R * (S_R - u_R));
+
+  // Low-dissipation pressure correction 'phi' [Eq. 23 of Minoshima & Miyoshi]
+  const double vmag_L = std::sqrt(vx_L * vx_L + vy_L * vy_L + vz_L * vz_L);
+  const double vmag_R = std::sqrt(vx_R * vx_R + vy_R * vy_R + vz_R * vz_R);
+  const double chi = std::min(1., std::max(vmag_L, vmag_R) / cs_max);
+  const double phi = chi * (2. - chi);
+  // const double phi = 1.0;
+
+  const double P_LR =
+      0.5 * (P_L + P_R) + 0.5 * phi *
+                              (rho_L * (S_L - u_L) * (S_star - u_L) +
+                               rho_R * (S_R - u_R) * (S_star - u_R));
+
+  // compute fluxes
+  // (for an isothermal EOS, nvar_ == 4 and the energy lane does not exist)
+  constexpr int fluxdim = nvar_;
+  constexpr int normalMomentum_index = (DIR == FluxDir::X1)   ? x1Momentum_index
+                                       : (DIR == FluxDir::X2) ? x2Momentum_index
+                                                              : x3Momentum_index;
+
+  quokka::valarray<double, fluxdim> D_L{};
+  quokka::valarray<double, fluxdim> D_R{};
+  quokka::valarray<double, fluxdim> D_star{};
+
+  D_L[normalMomentum_index] = 1.;
+  D_R[normalMomentum_index] = 1.;
+  D_star[normalMomentum_index] = 1.;
+
+  quokka::valarray<double, fluxdim> U_L{};
+  U_L[density_index] = rho_L;
+  U_L[x1Momentum_index] = rho_L * vx_L;
+  U_L[x2Momentum_index] = rho_L * vy_L;
+  U_L[x3Momentum_index] = rho_L * vz_L;
+
+  quokka::valarray<double, fluxdim> U_R{};
+  U_R[density_index] = rho_R;
+  U_R[x1Momentum_index] = rho_R * vx_R;
+  U_R[x2Momentum_index] = rho_R * vy_R;
+  U_R[x3Momentum_index] = rho_R * vz_R;
 
-    quokka::valarray<double, fluxdim> F_L = u_L * U_L + P_L * D_L;
-    quokka::valarray<double, fluxdim> F_R = u_R * U_R + P_R * D_R;
+  if constexpr (!is_eos_isothermal()) {
+    D_L[energy_index] = u_L;
+    D_R[energy_index] = u_R;
+    D_star[energy_index] = S_star;
+    U_L[energy_index] = E_L;
+    U_R[energy_index] = E_R;
+  }
 
-    const quokka::valarray<double, fluxdim> F_starL =
-        (S_star * (S_L * U_L - F_L) + S_L * P_LR * D_star) / (S_L - S_star);
+  if constexpr (dual_energy_) {
+    // the auxiliary internal energy advects with the contact discontinuity
+    // like a passive scalar; with its D/D_star lanes left zero, the star-state
+    // formula below reduces to the standard upwinded scalar flux
+    U_L[auxInternalEnergy_index] = rho_L * primL[primAuxEint_index];
+    U_R[auxInternalEnergy_index] = rho_R * primR[primAuxEint_index];
+  }
 
-    const quokka::valarray<double, fluxdim> F_starR =
-        (S_star * (S_R * U_R - F_R) + S_R * P_LR * D_star) / (S_R - S_star);
+  // passive scalars ride the contact discontinuity via the same mechanism
+  // (D/D_star lanes zero -> upwinded scalar flux)
+  for (int s = 0; s < nscalars_; ++s) {
+    U_L[scalar0_index + s] = rho_L * primL[primScalar0_index + s];
+    U_R[scalar0_index + s] = rho_R * primR[primScalar0_index + s];
+  }
 
-    // open the Riemann fan
-    quokka::valarray<double, fluxdim> F{};
+  // fused forms (see valarray.hpp): each evaluation is a single unrolled
+  // loop instead of a chain of per-operator temporaries
+  quokka::valarray<double, fluxdim> F_L = axpby(u_L, U_L, P_L, D_L);
+  quokka::valarray<double, fluxdim> F_R = axpby(u_R, U_R, P_R, D_R);
+
+  // F_star = (S_star * (S * U - F) + S * P_LR * D_star) / (S - S_star)
+  const quokka::valarray<double, fluxdim> F_starL =
+      starFlux(S_star, S_L, U_L, F_L, S_L * P_LR, D_star, S_L - S_star);
+
+  const quokka::valarray<double, fluxdim> F_starR =
+      starFlux(S_star, S_R, U_R, F_R, S_R * P_LR, D_star, S_R - S_star);
+
+  // open the Riemann fan
+  quokka::valarray<double, fluxdim> F{};
+
+  // HLLC flux
+  if (S_L > 0.0) {
+    F = F_L;
+  } else if ((S_star > 0.0) && (S_L <= 0.0)) {
+    F = F_starL;
+  } else if ((S_star <= 0.0) && (S_R >= 0.0)) {
+    F = F_starR;
+  } else { // S_R < 0.0
+    F = F_R;
+  }
 
-    // HLLC flux
-    if (S_L > 0.0) {
-      F = F_L;
-    } else if ((S_star > 0.0) && (S_L <= 0.0)) {
-      F = F_starL;
-    } else if ((S_star <= 0.0) && (S_R >= 0.0)) {
-      F = F_starR;
-    } else { // S_R < 0.0
-      F = F_R;
-    }
+  // check states are valid
+  AMREX_ASSERT(!std::isnan(F[0]));
+  AMREX_ASSERT(!std::isnan(F[1]));
+  AMREX_ASSERT(!std::isnan(F[2]));
+  AMREX_ASSERT(!std::isnan(F[3]));
+  if constexpr (!is_eos_isothermal()) {
+    AMREX_ASSERT(!std::isnan(F[energy_index]));
+  }
 
-    // check states are valid
-    AMREX_ASSERT(!std::isnan(F[0]));
-    AMREX_ASSERT(!std::isnan(F[1]));
-    AMREX_ASSERT(!std::isnan(F[2]));
-    AMREX_ASSERT(!std::isnan(F[3]));
+  return F;
+}
 
-    x1Flux(i, j, k, density_index) = F[0];
-    x1Flux(i, j, k, x1Momentum_index) = F[1];
-    x1Flux(i, j, k, x2Momentum_index) = F[2];
-    x1Flux(i, j, k, x3Momentum_index) = F[3];
-    if constexpr (!is_eos_isothermal()) {
-      AMREX_ASSERT(!std::isnan(F[4]));
-      x1Flux(i, j, k, energy_index) = F[4];
-    } else {
-      x1Flux(i, j, k, energy_index) = 0;
-    }
+// recompute first-order (piecewise-constant) fluxes on the faces of the cells
+// in cellList only, overwriting the corresponding entries of fluxArrays. the
+// flagged cells are typically a tiny fraction of the box, so this avoids the
+// full flux sweep the dense redo path paid on every affected FAB. adjacent
+// flagged cells may both write their shared face, but they write identical
+// values, so the race is benign.
+template <typename problem_t>
+void HydroSystem<problem_t>::ComputeFirstOrderFluxesSparse(
+    amrex::Array4<const amrex::Real> const &primVar,
+    std::array<amrex::Array4<amrex::Real>, AMREX_SPACEDIM> fluxArrays,
+    amrex::Dim3 const *cellList, const int ncells) {
+  BL_PROFILE("HydroSystem::ComputeFirstOrderFluxesSparse()");
+
+  amrex::ParallelFor(ncells, [=] AMREX_GPU_DEVICE(int idx) noexcept {
+    amrex::Dim3 const cell = cellList[idx];
+
+    // solve the Riemann problem on both faces of this cell along direction
+    // DIR, using the piecewise-constant states of the adjacent cells
+    auto redoDir = [&](auto dirTag, amrex::Array4<amrex::Real> const &fluxArr) {
+      constexpr FluxDir DIR = decltype(dirTag)::value;
+      quokka::Array4View<const amrex::Real, DIR> q(primVar);
+      quokka::Array4View<amrex::Real, DIR> flux(fluxArr);
+      auto [i, j, k] = quokka::reorderMultiIndex<DIR>(cell.x, cell.y, cell.z);
+
+      for (int face = 0; face < 2; ++face) {
+        const int fi = i + face;
+        quokka::valarray<double, nvar_> primL{};
+        quokka::valarray<double, nvar_> primR{};
+        for (int n = 0; n < nvar_; ++n) {
+          primL[n] = q(fi - 1, j, k, n);
+          primR[n] = q(fi, j, k, n);
+        }
+        const quokka::valarray<double, nvar_> F =
+            ComputeHLLCFlux<DIR>(primL, primR, q, fi, j, k);
+        flux(fi, j, k, density_index) = F[0];
+        flux(fi, j, k, x1Momentum_index) = F[1];
+        flux(fi, j, k, x2Momentum_index) = F[2];
+        flux(fi, j, k, x3Momentum_index) = F[3];
+        if constexpr (!is_eos_isothermal()) {
+          flux(fi, j, k, energy_index) = F[energy_index];
+        }
+        if constexpr (dual_energy_) {
+          flux(fi, j, k, auxInternalEnergy_index) = F[auxInternalEnergy_index];
+        }
+        for (int s = 0; s < nscalars_; ++s) {
+          flux(fi, j, k, scalar0_index + s) = F[scalar0_index + s];
+        }
+      }
+    };
+
+    AMREX_D_TERM(
+        redoDir(std::integral_constant<FluxDir, FluxDir::X1>{}, fluxArrays[0]);
+        , redoDir(std::integral_constant<FluxDir, FluxDir::X2>{},
+                  fluxArrays[1]);
+        , redoDir(std::integral_constant<FluxDir, FluxDir::X3>{},
+                  fluxArrays[2]);)
   });
 }
 
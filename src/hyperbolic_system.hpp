@@ -43,6 +43,32 @@ namespace quokka {
 using array_t = amrex::Array4<amrex::Real> const;
 using arrayconst_t = amrex::Array4<const amrex::Real> const;
 
+// this struct is specialized by the user application code
+//
+template <typename problem_t> struct Reconstruction_Traits {
+	// if true, use branchless (select-based) implementations of the slope
+	// limiter and the PPM monotonicity correction. these compute both sides of
+	// each data-dependent branch and blend with masked selects, which lets the
+	// compiler autovectorize the per-component reconstruction loops on CPUs.
+	static constexpr bool branchless = false;
+
+	// if true, PPM reconstruction sweeps whole pencils along the
+	// reconstruction axis with a sliding register window instead of launching
+	// one thread per cell (trades parallelism for ~5x fewer stencil loads;
+	// profitable on GPUs when there are enough transverse cells to fill the
+	// device)
+	static constexpr bool ppm_pencil = false;
+
+	// upper bound on the reconstruction order the problem will run
+	// (1 == donor cell, 2 == PLM, 3 == PPM). the conserved-state ghost width
+	// is sized from this at compile time (PPM+flattening needs 4 ghost cells,
+	// PLM only 2), so declaring max_order = 2 nearly halves ghost memory and
+	// exchange volume. the runtime reconstructionOrder_ may still select any
+	// order up to this bound. problems using PPM radiation reconstruction
+	// must keep the default.
+	static constexpr int max_order = 3;
+};
+
 /// Class for a hyperbolic system of conservation laws
 template <typename problem_t> class HyperbolicSystem
 {
@@ -50,9 +76,18 @@ template <typename problem_t> class HyperbolicSystem
 	[[nodiscard]] AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
 	static auto MC(double a, double b) -> double
 	{
-		return 0.5 * (sgn(a) + sgn(b)) *
-		       std::min(0.5 * std::abs(a + b),
-				std::min(2.0 * std::abs(a), 2.0 * std::abs(b)));
+		if constexpr (Reconstruction_Traits<problem_t>::branchless) {
+			// copysign compiles to bit operations, avoiding the
+			// int-valued sgn() and its conversions. when either slope is
+			// zero the min() term vanishes, so the results agree.
+			const double s = 0.5 * (std::copysign(1.0, a) + std::copysign(1.0, b));
+			return s * std::min(0.5 * std::abs(a + b),
+					    std::min(2.0 * std::abs(a), 2.0 * std::abs(b)));
+		} else {
+			return 0.5 * (sgn(a) + sgn(b)) *
+			       std::min(0.5 * std::abs(a + b),
+					std::min(2.0 * std::abs(a), 2.0 * std::abs(b)));
+		}
 	}
 
 	[[nodiscard]] AMREX_GPU_DEVICE AMREX_FORCE_INLINE
@@ -73,6 +108,34 @@ template <typename problem_t> class HyperbolicSystem
 					 amrex::Box const &cellRange,
 					 amrex::Box const &interfaceRange, int nvars);
 
+	// pencil-tiled variant: each thread sweeps a full row of cells along DIR,
+	// carrying the 5-point stencil in a sliding register window so each cell
+	// of the primitive array is loaded exactly once (the cell-centered kernel
+	// re-loads every cell ~5x from global memory). selected via
+	// Reconstruction_Traits<problem_t>::ppm_pencil.
+	template <FluxDir DIR>
+	static void ReconstructStatesPPMPencil(arrayconst_t &q, array_t &leftState,
+					       array_t &rightState, amrex::Box const &cellRange,
+					       int nvars);
+
+	// per-cell PPM parabola, callable from inside other kernels (see
+	// HydroSystem::ReconstructFlattenedStatesPPM). returns the
+	// (left-edge, right-edge) values of cell (i, j, k) in permuted indices.
+	// (T may be float for reduced-precision stencil storage; the parabola
+	// is always computed in double -- see ReconstructFlattenedStatesPPM)
+	template <FluxDir DIR, typename T = amrex::Real>
+	[[nodiscard]] AMREX_GPU_DEVICE AMREX_FORCE_INLINE static auto
+	ReconstructCellPPM(quokka::Array4View<const T, DIR> const &q, int i, int j,
+			   int k, int n, std::pair<double, double> bounds)
+	    -> std::pair<double, double>;
+
+	// as above, but operating on an explicit 5-point stencil already held in
+	// registers (used by the pencil-tiled reconstruction sweep)
+	[[nodiscard]] AMREX_GPU_DEVICE AMREX_FORCE_INLINE static auto
+	ReconstructCellPPM(double q_minus2, double q_minus1, double q0, double q_plus1,
+			   double q_plus2, std::pair<double, double> bounds)
+	    -> std::pair<double, double>;
+
 	template <typename F>
 	__attribute__ ((__target__ ("no-fma")))
 	static void AddFluxesRK2(array_t &U_new, arrayconst_t &U0, arrayconst_t &U1,
@@ -212,6 +275,12 @@ void HyperbolicSystem<problem_t>::ReconstructStatesPPM(arrayconst_t &q_in, array
 {
 	BL_PROFILE("HyperbolicSystem::ReconstructStatesPPM()");
 
+	if constexpr (Reconstruction_Traits<problem_t>::ppm_pencil) {
+		ReconstructStatesPPMPencil<DIR>(q_in, leftState_in, rightState_in, cellRange,
+						nvars);
+		return;
+	}
+
 	// construct ArrayViews for permuted indices
 	quokka::Array4View<amrex::Real const, DIR> q(q_in);
 	quokka::Array4View<amrex::Real, DIR> leftState(leftState_in);
@@ -245,73 +314,171 @@ void HyperbolicSystem<problem_t>::ReconstructStatesPPM(arrayconst_t &q_in, array
 				std::minmax({q(i, j, k, n), q(i - 1, j, k, n), q(i + 1, j, k, n)});
 #endif
 
-		    // get interfaces
-			// PPM reconstruction following Colella & Woodward (1984), with
-			// some modifications following Mignone (2014), as implemented in
-			// Athena++.
-
-			// (1.) Estimate the interface a_{i - 1/2}. Equivalent to step 1
-			// in Athena++ [ppm_simple.cpp].
-
-			// C&W Eq. (1.9) [parabola midpoint for the case of
-			// equally-spaced zones]: a_{j+1/2} = (7/12)(a_j + a_{j+1}) -
-			// (1/12)(a_{j+2} + a_{j-1}). Terms are grouped to preserve exact
-			// symmetry in floating-point arithmetic, following Athena++.
-			const double coef_1 = (7. / 12.);
-		    const double coef_2 = (-1. / 12.);
-		    const double a_minus = (coef_1 * q(i,     j, k, n) + coef_2 * q(i + 1, j, k, n)) +
-		       					   (coef_1 * q(i - 1, j, k, n) + coef_2 * q(i - 2, j, k, n)) ;
-		    const double a_plus  = (coef_1 * q(i + 1, j, k, n) + coef_2 * q(i + 2, j, k, n)) +
-		       					   (coef_1 * q(i    , j, k, n) + coef_2 * q(i - 1, j, k, n)) ;
-
-		    // left side of zone i
-		    double new_a_minus = clamp(a_minus, bounds.first, bounds.second);
+		    const auto [new_a_minus, new_a_plus] =
+			ReconstructCellPPM<DIR>(q, i, j, k, n, bounds);
 
-		    // right side of zone i
-		    double new_a_plus = clamp(a_plus, bounds.first, bounds.second);
-
-		    // (3.) Monotonicity correction, using Eq. (1.10) in PPM paper. Equivalent
-		    // to step 4b in Athena++ [ppm_simple.cpp].
+		    rightState(i, j, k, n) = new_a_minus;
+		    leftState(i + 1, j, k, n) = new_a_plus;
+	});
+}
 
-		    const double a = q(i, j, k, n);	// a_i in C&W
-		    const double dq_minus = (a - new_a_minus);
-		    const double dq_plus = (new_a_plus - a);
+template <typename problem_t>
+template <FluxDir DIR, typename T>
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE auto HyperbolicSystem<problem_t>::ReconstructCellPPM(
+    quokka::Array4View<const T, DIR> const &q, int i, int j, int k, int n,
+    std::pair<double, double> bounds) -> std::pair<double, double>
+{
+	return ReconstructCellPPM(q(i - 2, j, k, n), q(i - 1, j, k, n), q(i, j, k, n),
+				  q(i + 1, j, k, n), q(i + 2, j, k, n), bounds);
+}
 
-		    const double qa = dq_plus * dq_minus; // interface extrema
+template <typename problem_t>
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE auto HyperbolicSystem<problem_t>::ReconstructCellPPM(
+    const double q_minus2, const double q_minus1, const double q0, const double q_plus1,
+    const double q_plus2, std::pair<double, double> bounds) -> std::pair<double, double>
+{
+	// get interfaces
+	// PPM reconstruction following Colella & Woodward (1984), with
+	// some modifications following Mignone (2014), as implemented in
+	// Athena++.
+
+	// (1.) Estimate the interface a_{i - 1/2}. Equivalent to step 1
+	// in Athena++ [ppm_simple.cpp].
+
+	// C&W Eq. (1.9) [parabola midpoint for the case of
+	// equally-spaced zones]: a_{j+1/2} = (7/12)(a_j + a_{j+1}) -
+	// (1/12)(a_{j+2} + a_{j-1}). Terms are grouped to preserve exact
+	// symmetry in floating-point arithmetic, following Athena++.
+	const double coef_1 = (7. / 12.);
+	const double coef_2 = (-1. / 12.);
+	const double a_minus = (coef_1 * q0       + coef_2 * q_plus1) +
+			       (coef_1 * q_minus1 + coef_2 * q_minus2) ;
+	const double a_plus  = (coef_1 * q_plus1  + coef_2 * q_plus2) +
+			       (coef_1 * q0       + coef_2 * q_minus1) ;
+
+	// left side of zone i
+	double new_a_minus = clamp(a_minus, bounds.first, bounds.second);
+
+	// right side of zone i
+	double new_a_plus = clamp(a_plus, bounds.first, bounds.second);
+
+	// (3.) Monotonicity correction, using Eq. (1.10) in PPM paper. Equivalent
+	// to step 4b in Athena++ [ppm_simple.cpp].
+
+	const double a = q0;	// a_i in C&W
+	const double dq_minus = (a - new_a_minus);
+	const double dq_plus = (new_a_plus - a);
+
+	const double qa = dq_plus * dq_minus; // interface extrema
+
+	if constexpr (Reconstruction_Traits<problem_t>::branchless) {
+		// compute both the extremum and overshoot corrections
+		// unconditionally and blend with selects (these compile to
+		// cmov/vector blends, so the loop vectorizes)
+		const double dq0 = MC(q_plus1 - q0, q0 - q_minus1);
+
+		// parabola overshoot corrections (Eq. 1.10 of C&W)
+		const double a_minus_mono =
+		    (std::abs(dq_minus) >= 2.0 * std::abs(dq_plus)) ? (a - 2.0 * dq_plus)
+								    : new_a_minus;
+		const double a_plus_mono =
+		    (std::abs(dq_plus) >= 2.0 * std::abs(dq_minus)) ? (a + 2.0 * dq_minus)
+								    : new_a_plus;
+
+		// at a local extremum, fall back to MC-limited linear reconstruction
+		const bool extremum = (qa <= 0.0);
+		new_a_minus = extremum ? (a - 0.5 * dq0) : a_minus_mono;
+		new_a_plus = extremum ? (a + 0.5 * dq0) : a_plus_mono;
+
+	} else if (qa <= 0.0) { // local extremum
+
+		// Causes subtle, but very weird, oscillations in the Shu-Osher test
+		// problem. However, it is necessary to get a reasonable solution
+		// for the sawtooth advection problem.
+		const double dq0 = MC(q_plus1 - q0, q0 - q_minus1);
+
+		// use linear reconstruction, following Balsara (2017) [Living Rev
+		// Comput Astrophys (2017) 3:2]
+		new_a_minus = a - 0.5 * dq0;
+		new_a_plus = a + 0.5 * dq0;
+
+		// original C&W method for this case
+		// new_a_minus = a;
+		// new_a_plus = a;
+
+	} else { // no local extrema
+
+		// parabola overshoots near a_plus -> reset a_minus
+		if (std::abs(dq_minus) >= 2.0 * std::abs(dq_plus)) {
+			new_a_minus = a - 2.0 * dq_plus;
+		}
+
+		// parabola overshoots near a_minus -> reset a_plus
+		if (std::abs(dq_plus) >= 2.0 * std::abs(dq_minus)) {
+			new_a_plus = a + 2.0 * dq_minus;
+		}
+	}
 
-		    if (qa <= 0.0) { // local extremum
+	return {new_a_minus, new_a_plus};
+}
 
-			    // Causes subtle, but very weird, oscillations in the Shu-Osher test
-			    // problem. However, it is necessary to get a reasonable solution
-			    // for the sawtooth advection problem.
-			    const double dq0 = MC(q(i + 1, j, k, n) - q(i, j, k, n),
-						  q(i, j, k, n) - q(i - 1, j, k, n));
+template <typename problem_t>
+template <FluxDir DIR>
+void HyperbolicSystem<problem_t>::ReconstructStatesPPMPencil(arrayconst_t &q_in,
+							     array_t &leftState_in,
+							     array_t &rightState_in,
+							     amrex::Box const &cellRange,
+							     const int nvars)
+{
+	BL_PROFILE("HyperbolicSystem::ReconstructStatesPPMPencil()");
 
-			    // use linear reconstruction, following Balsara (2017) [Living Rev
-			    // Comput Astrophys (2017) 3:2]
-			    new_a_minus = a - 0.5 * dq0;
-			    new_a_plus = a + 0.5 * dq0;
+	// construct ArrayViews for permuted indices
+	quokka::Array4View<amrex::Real const, DIR> q(q_in);
+	quokka::Array4View<amrex::Real, DIR> leftState(leftState_in);
+	quokka::Array4View<amrex::Real, DIR> rightState(rightState_in);
 
-			    // original C&W method for this case
-			    // new_a_minus = a;
-			    // new_a_plus = a;
+	constexpr int dir = static_cast<int>(DIR);
+	const int pencilLength = cellRange.length(dir);
 
-		    } else { // no local extrema
+	// one thread per pencil: flatten the reconstruction axis to a single cell
+	amrex::Box plane(cellRange);
+	plane.setRange(dir, cellRange.smallEnd(dir), 1);
 
-			    // parabola overshoots near a_plus -> reset a_minus
-			    if (std::abs(dq_minus) >= 2.0 * std::abs(dq_plus)) {
-				    new_a_minus = a - 2.0 * dq_plus;
-			    }
+	amrex::ParallelFor(
+	    plane, nvars, [=] AMREX_GPU_DEVICE(int i_in, int j_in, int k_in, int n) noexcept {
+		    // permute array indices according to dir
+		    // (i is the pencil start along the reconstruction axis)
+		    auto [i, j, k] = quokka::reorderMultiIndex<DIR>(i_in, j_in, k_in);
 
-			    // parabola overshoots near a_minus -> reset a_plus
-			    if (std::abs(dq_plus) >= 2.0 * std::abs(dq_minus)) {
-				    new_a_plus = a + 2.0 * dq_minus;
-			    }
+		    // prime the 5-point sliding window
+		    double q_minus2 = q(i - 2, j, k, n);
+		    double q_minus1 = q(i - 1, j, k, n);
+		    double q0 = q(i, j, k, n);
+		    double q_plus1 = q(i + 1, j, k, n);
+
+		    for (int m = i; m < i + pencilLength; ++m) {
+			    // each cell of q is loaded exactly once per pencil
+			    const double q_plus2 = q(m + 2, j, k, n);
+
+			    // N.B.: the multidimensional extrema check (see
+			    // MULTIDIM_EXTREMA_CHECK) is not supported here; bounds
+			    // are computed from the axis neighbors in the window
+			    const std::pair<double, double> bounds =
+				std::minmax({q0, q_minus1, q_plus1});
+
+			    const auto [new_a_minus, new_a_plus] = ReconstructCellPPM(
+				q_minus2, q_minus1, q0, q_plus1, q_plus2, bounds);
+
+			    rightState(m, j, k, n) = new_a_minus;
+			    leftState(m + 1, j, k, n) = new_a_plus;
+
+			    // shift the window
+			    q_minus2 = q_minus1;
+			    q_minus1 = q0;
+			    q0 = q_plus1;
+			    q_plus1 = q_plus2;
 		    }
-
-		    rightState(i, j, k, n) = new_a_minus;
-		    leftState(i + 1, j, k, n) = new_a_plus;
-	});
+	    });
 }
 
 template <typename problem_t>
@@ -7,37 +7,69 @@
 /// \brief The main() function for simulations.
 ///
 
+#include <string>
+#include <vector>
+
 #include "AMReX.H"
 #include "AMReX_ParallelDescriptor.H"
 #include "AMReX_ParmParse.H"
 #include "AMReX_Print.H"
 #include "AMReX_REAL.H"
 
+#if defined(AMREX_USE_MPI) && defined(AMREX_USE_GPU) && defined(OPEN_MPI)
+#include <mpi-ext.h> // for MPIX_Query_cuda_support
+#endif
+
 #include "main.hpp"
 
-auto main(int argc, char **argv) -> int {
-  // Initialization (copied from ExaWind)
-
-  amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, []() {
-    amrex::ParmParse pp("amrex");
-    // Set the defaults so that we throw an exception instead of attempting
-    // to generate backtrace files. However, if the user has explicitly set
-    // these options in their input files respect those settings.
-    if (!pp.contains("throw_exception")) {
-      pp.add("throw_exception", 1);
-    }
-    if (!pp.contains("signal_handling")) {
-      pp.add("signal_handling", 0);
-    }
+namespace {
+// defaults applied on top of each (re)initialized ParmParse table
+// (copied from ExaWind)
+void setParmParseDefaults() {
+  amrex::ParmParse pp("amrex");
+  // Set the defaults so that we throw an exception instead of attempting
+  // to generate backtrace files. However, if the user has explicitly set
+  // these options in their input files respect those settings.
+  if (!pp.contains("throw_exception")) {
+    pp.add("throw_exception", 1);
+  }
+  if (!pp.contains("signal_handling")) {
+    pp.add("signal_handling", 0);
+  }
+
+  // Set GPU memory handling defaults:
+  // since performance is terrible if we have to swap pages between device and
+  // host memory due to exceeding the size of device memory, we crash the code
+  // if this happens, allowing the user to restart with more nodes.
+  if (!pp.contains("abort_on_out_of_gpu_memory")) {
+    pp.add("abort_on_out_of_gpu_memory", 1);
+  }
 
-    // Set GPU memory handling defaults:
-    // since performance is terrible if we have to swap pages between device and
-    // host memory due to exceeding the size of device memory, we crash the code
-    // if this happens, allowing the user to restart with more nodes.
-    if (!pp.contains("abort_on_out_of_gpu_memory")) {
-      pp.add("abort_on_out_of_gpu_memory", 1);
+  // Enable GPU-aware MPI by default when the MPI library reports GPU
+  // support. This activates AMReX's direct device-to-device ghost exchange
+  // path: pack/unpack kernels fused over all copy tags per message, with
+  // sends and receives posted from device buffers (GPUDirect RDMA on
+  // capable fabrics) instead of staging every FillBoundary/FillPatch
+  // message through pinned host memory. AMReX defaults this off because a
+  // non-GPU-aware MPI crashes when handed device pointers, so we only flip
+  // it where the library advertises support; users can still override it
+  // in their input files either way.
+  if (!pp.contains("use_gpu_aware_mpi")) {
+    int gpu_aware = 0;
+#if defined(MPIX_CUDA_AWARE_SUPPORT)
+    gpu_aware = MPIX_Query_cuda_support();
+#elif defined(MPIX_ROCM_AWARE_SUPPORT)
+    gpu_aware = MPIX_Query_rocm_support();
+#endif
+    if (gpu_aware == 1) {
+      pp.add("use_gpu_aware_mpi", 1);
     }
-  });
+  }
+}
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, setParmParseDefaults);
 
   amrex::Real start_time = amrex::ParallelDescriptor::second();
 
@@ -45,7 +77,48 @@ auto main(int argc, char **argv) -> int {
   { // objects must be destroyed before amrex::finalize, so enter new
     // scope here to do that automatically
 
-    result = problem_main();
+    // batch mode: one process executes a list of input files back-to-back,
+    // paying AMReX/MPI initialization, the GPU allocator pool warmup, and
+    // any cached table loads (see the cloudy_data cache in
+    // GrackleDataReader) only once instead of once per run -- useful for
+    // resolution and CFL sweeps. each entry replaces the ParmParse table
+    // wholesale, so the listed input files must be self-contained
+    // (command-line overrides only apply to the first run).
+    std::vector<std::string> batchInputs;
+    {
+      amrex::ParmParse pp("batch");
+      pp.queryarr("inputs", batchInputs);
+    }
+
+    if (batchInputs.empty()) {
+      result = problem_main();
+    } else {
+      const int nruns = static_cast<int>(batchInputs.size());
+      for (int i = 0; i < nruns; ++i) {
+        amrex::Print() << "=== batch run " << (i + 1) << "/" << nruns << ": "
+                       << batchInputs[i] << " ===\n";
+        // replace the ParmParse table with the contents of this input file
+        // (plus the defaults above)
+        amrex::ParmParse::Finalize();
+        amrex::ParmParse::Initialize(0, nullptr, batchInputs[i].c_str());
+        setParmParseDefaults();
+
+        amrex::Real run_start = amrex::ParallelDescriptor::second();
+        const int run_result = problem_main();
+        amrex::Real run_elapsed =
+            amrex::ParallelDescriptor::second() - run_start;
+        amrex::ParallelDescriptor::ReduceRealMax(
+            run_elapsed, amrex::ParallelDescriptor::IOProcessorNumber());
+        amrex::Print() << "=== batch run " << (i + 1) << " elapsed time: "
+                       << run_elapsed << " seconds ===\n\n";
+
+        // report the first failing run, but keep going so the rest of the
+        // sweep still completes
+        if (run_result != 0 && result == 0) {
+          result = run_result;
+        }
+      }
+    }
 
   } // destructors must be called before amrex::Finalize()
 
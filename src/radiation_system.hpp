@@ -13,12 +13,14 @@
 #include <array>
 #include <cmath>
 #include <iostream>
+#include <type_traits>
 #include <vector>
 
 // library headers
 #include "AMReX.H"
 #include "AMReX_Array.H"
 #include "AMReX_BLassert.H"
+#include "AMReX_GpuAtomic.H"
 #include "AMReX_GpuQualifiers.H"
 #include "AMReX_REAL.H"
 
@@ -48,6 +50,68 @@ template <typename problem_t> struct RadSystem_Traits {
   static constexpr bool compute_v_over_c_terms = true;
 };
 
+// opt-in trait: problems whose opacities ignore their Tgas argument may add
+//   static constexpr bool temperature_independent_opacity = true;
+// to their RadSystem_Traits specialization. the matter-coupling Newton solve
+// then evaluates the opacity once per cell instead of once per iteration
+// (specializations that omit the member keep the conservative default of
+// re-evaluating every iteration).
+namespace detail {
+template <typename problem_t, typename = void>
+struct opacity_is_temperature_independent : std::false_type {};
+template <typename problem_t>
+struct opacity_is_temperature_independent<
+    problem_t, std::void_t<decltype(RadSystem_Traits<
+                                    problem_t>::temperature_independent_opacity)>>
+    : std::bool_constant<
+          RadSystem_Traits<problem_t>::temperature_independent_opacity> {};
+
+// opt-in trait: problems that tolerate ~5e-5 relative error in the Eddington
+// factor may add
+//   static constexpr bool fast_closure = true;
+// to their RadSystem_Traits specialization. the closure is then evaluated
+// from a rational fit (no square root) and the flux-normalization and
+// wavespeed square roots are computed via the hardware reciprocal square
+// root. this is aimed at RSLA runs, where radiation subcycling multiplies
+// the per-interface closure cost by the substep count.
+template <typename problem_t, typename = void>
+struct use_fast_closure : std::false_type {};
+template <typename problem_t>
+struct use_fast_closure<
+    problem_t, std::void_t<decltype(RadSystem_Traits<problem_t>::fast_closure)>>
+    : std::bool_constant<RadSystem_Traits<problem_t>::fast_closure> {};
+
+// opt-in trait: problems whose SetRadEnergySource ignores its time argument
+// may add
+//   static constexpr bool time_independent_rad_source = true;
+// to their RadSystem_Traits specialization. the source field is then filled
+// once per level per grid change and reused across all radiation substeps,
+// instead of being cleared and re-evaluated every substep.
+template <typename problem_t, typename = void>
+struct rad_source_is_time_independent : std::false_type {};
+template <typename problem_t>
+struct rad_source_is_time_independent<
+    problem_t, std::void_t<decltype(RadSystem_Traits<
+                                    problem_t>::time_independent_rad_source)>>
+    : std::bool_constant<
+          RadSystem_Traits<problem_t>::time_independent_rad_source> {};
+
+// opt-in trait: time-dependent problems whose SetRadEnergySource assigns
+// every cell of the box (rather than accumulating into it) may add
+//   static constexpr bool incremental_rad_source = true;
+// to their RadSystem_Traits specialization. the persistent source scratch is
+// then no longer zero-filled before each substep's evaluation, so the hook
+// updates the previous substep's field in place.
+template <typename problem_t, typename = void>
+struct rad_source_is_incremental : std::false_type {};
+template <typename problem_t>
+struct rad_source_is_incremental<
+    problem_t,
+    std::void_t<decltype(RadSystem_Traits<problem_t>::incremental_rad_source)>>
+    : std::bool_constant<RadSystem_Traits<problem_t>::incremental_rad_source> {
+};
+} // namespace detail
+
 /// Class for the radiation moment equations
 ///
 template <typename problem_t>
@@ -91,12 +155,20 @@ public:
   static constexpr double Erad_floor_ = RadSystem_Traits<problem_t>::Erad_floor;
   static constexpr bool compute_v_over_c_terms_ =
       RadSystem_Traits<problem_t>::compute_v_over_c_terms;
+  static constexpr bool opacity_is_temperature_independent_ =
+      detail::opacity_is_temperature_independent<problem_t>::value;
+  static constexpr bool fast_closure_ =
+      detail::use_fast_closure<problem_t>::value;
+  static constexpr bool time_independent_rad_source_ =
+      detail::rad_source_is_time_independent<problem_t>::value;
+  static constexpr bool incremental_rad_source_ =
+      detail::rad_source_is_incremental<problem_t>::value;
 
   // static functions
 
-  static void
+  static auto
   ComputeMaxSignalSpeed(amrex::Array4<const amrex::Real> const &cons,
-                        array_t &maxSignal, amrex::Box const &indexRange);
+                        amrex::Box const &indexRange) -> amrex::Real;
   static void ConservedToPrimitive(amrex::Array4<const amrex::Real> const &cons,
                                    array_t &primVar,
                                    amrex::Box const &indexRange);
@@ -115,13 +187,32 @@ public:
                double dt_in, amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx_in,
                amrex::Box const &indexRange, int nvars);
 
+  // 'chat' is the reduced speed of light to use for this level; it defaults
+  // to the compile-time trait value, but may be overridden at runtime (e.g.
+  // to run fine AMR levels with a smaller c_hat)
   template <FluxDir DIR>
   static void
   ComputeFluxes(array_t &x1Flux_in, array_t &x1FluxDiffusive_in,
                 amrex::Array4<const amrex::Real> const &x1LeftState_in,
                 amrex::Array4<const amrex::Real> const &x1RightState_in,
                 amrex::Box const &indexRange, arrayconst_t &consVar_in,
-                amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx);
+                amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx,
+                double chat = c_hat_);
+
+  // fused variant of the PPM radiation sweep: converts conserved to
+  // primitive variables and reconstructs the interface states inline from
+  // registers (no staged primitive/interface FABs), then evaluates the HLL
+  // flux -- including the Eddington factor and the cell optical depth -- in
+  // the same kernel. this halves the number of global-memory passes over the
+  // radiation state per direction.
+  // [N.B.: like the pencil reconstruction sweep, this path does not support
+  //  MULTIDIM_EXTREMA_CHECK.]
+  template <FluxDir DIR>
+  static void
+  ComputeFusedFluxesPPM(array_t &x1Flux_in, array_t &x1FluxDiffusive_in,
+                        amrex::Box const &indexRange, arrayconst_t &consVar_in,
+                        amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx,
+                        double chat = c_hat_);
 
   static void SetRadEnergySource(
       array_t &radEnergySource, amrex::Box const &indexRange,
@@ -130,9 +221,15 @@ public:
       amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &prob_hi,
       amrex::Real time);
 
+  // 'newtonDeltaCache' stores the converged (Egas, Erad) increments from the
+  // previous radiation substep and is used to warm-start the Newton iteration;
+  // the number of iterations performed is atomically accumulated into
+  // '*p_iterCount' (a device pointer)
   static void AddSourceTerms(array_t &consVar, arrayconst_t &radEnergySource,
                              arrayconst_t &advectionFluxes,
-                             amrex::Box const &indexRange, amrex::Real dt);
+                             array_t &newtonDeltaCache,
+                             amrex::Box const &indexRange, amrex::Real dt,
+                             amrex::Long *p_iterCount, double chat = c_hat_);
   static void ComputeSourceTermsExplicit(arrayconst_t &consPrev,
                                          arrayconst_t &radEnergySource,
                                          array_t &src,
@@ -140,6 +237,13 @@ public:
                                          amrex::Real dt);
 
   AMREX_GPU_HOST_DEVICE static auto ComputeEddingtonFactor(double f) -> double;
+  // norm of the reduced-flux vector and its reciprocal (the reciprocal is
+  // zero when the norm is zero, so the direction terms drop out). in the
+  // fast-closure mode both come from one reciprocal square root instead of
+  // a sqrt plus per-component divides.
+  AMREX_GPU_HOST_DEVICE static void ComputeReducedFluxNorm(double fx, double fy,
+                                                           double fz, double &f,
+                                                           double &finv);
   AMREX_GPU_HOST_DEVICE static auto ComputePlanckOpacity(double rho,
                                                          double Tgas) -> double;
   AMREX_GPU_HOST_DEVICE static auto
@@ -167,8 +271,31 @@ public:
       amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx, int i, int j, int k)
       -> double;
 
+  // single-interface HLL solve, callable from inside other kernels (shared by
+  // the staged and fused flux kernels). takes the left/right primitive
+  // interface states and computes the Eddington factors, the optical-depth
+  // correction, and the HLL and diffusive fluxes for interface (i, j, k) in
+  // permuted indices.
+  template <FluxDir DIR>
+  AMREX_GPU_DEVICE AMREX_FORCE_INLINE static void ComputeHLLRadFlux(
+      double erad_L, double erad_R, double fx_L, double fx_R, double fy_L,
+      double fy_R, double fz_L, double fz_R,
+      quokka::Array4View<const amrex::Real, DIR> const &consVar,
+      amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx, double chat, int i,
+      int j, int k, quokka::valarray<double, nvarHyperbolic_> &F_out,
+      quokka::valarray<double, nvarHyperbolic_> &diffusiveF_out);
+
   AMREX_GPU_DEVICE static auto
   isStateValid(std::array<amrex::Real, nvarHyperbolic_> &cons) -> bool;
+
+  // returns true if cell (i, j, k) is radiatively quiescent to within 'tol':
+  // the radiation flux and the local radiation energy gradients are
+  // negligible, and (if the gas is coupled through a nonzero opacity) matter
+  // and radiation are in equilibrium. in such cells both the flux sweep and
+  // the implicit matter-coupling solve are no-ops.
+  AMREX_GPU_DEVICE static auto
+  IsRadiationQuiescent(amrex::Array4<const amrex::Real> const &cons, int i,
+                       int j, int k, amrex::Real tol) -> bool;
 };
 
 template <typename problem_t>
@@ -210,14 +337,11 @@ void RadSystem<problem_t>::ConservedToPrimitive(
 }
 
 template <typename problem_t>
-void RadSystem<problem_t>::ComputeMaxSignalSpeed(
-    amrex::Array4<const amrex::Real> const & /*cons*/, array_t &maxSignal,
-    amrex::Box const &indexRange) {
-  // cell-centered kernel
-  amrex::ParallelFor(indexRange, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-    const double signal_max = c_hat_;
-    maxSignal(i, j, k) = signal_max;
-  });
+auto RadSystem<problem_t>::ComputeMaxSignalSpeed(
+    amrex::Array4<const amrex::Real> const & /*cons*/,
+    amrex::Box const & /*indexRange*/) -> amrex::Real {
+  // the radiation signal speed is always the reduced speed of light
+  return c_hat_;
 }
 
 template <typename problem_t>
@@ -237,6 +361,68 @@ AMREX_GPU_DEVICE auto RadSystem<problem_t>::isStateValid(
   return (isNonNegative && isFluxCausal);
 }
 
+template <typename problem_t>
+AMREX_GPU_DEVICE auto RadSystem<problem_t>::IsRadiationQuiescent(
+    amrex::Array4<const amrex::Real> const &cons, int i, int j, int k,
+    const amrex::Real tol) -> bool {
+  const double Erad = cons(i, j, k, radEnergy_index);
+
+  // the radiation flux must be negligible compared to the free-streaming flux
+  const double Fx = cons(i, j, k, x1RadFlux_index);
+  const double Fy = cons(i, j, k, x2RadFlux_index);
+  const double Fz = cons(i, j, k, x3RadFlux_index);
+  const double Fnorm = std::sqrt(Fx * Fx + Fy * Fy + Fz * Fz);
+  if (Fnorm > tol * (c_light_ * Erad)) {
+    return false;
+  }
+
+  // the radiation energy gradients must be negligible (so the HLL fluxes
+  // cancel between neighbouring interfaces)
+  double maxAbsDiff =
+      std::max(std::abs(cons(i + 1, j, k, radEnergy_index) - Erad),
+               std::abs(cons(i - 1, j, k, radEnergy_index) - Erad));
+#if (AMREX_SPACEDIM >= 2)
+  maxAbsDiff =
+      std::max(maxAbsDiff,
+               std::max(std::abs(cons(i, j + 1, k, radEnergy_index) - Erad),
+                        std::abs(cons(i, j - 1, k, radEnergy_index) - Erad)));
+#endif
+#if (AMREX_SPACEDIM == 3)
+  maxAbsDiff =
+      std::max(maxAbsDiff,
+               std::max(std::abs(cons(i, j, k + 1, radEnergy_index) - Erad),
+                        std::abs(cons(i, j, k - 1, radEnergy_index) - Erad)));
+#endif
+  if (maxAbsDiff > tol * Erad) {
+    return false;
+  }
+
+  // if the gas is coupled through a nonzero opacity, matter and radiation
+  // must also be in equilibrium (otherwise the implicit solve would move
+  // energy between them)
+  if constexpr (gamma_ != 1.0) {
+    const double rho = cons(i, j, k, gasDensity_index);
+    const double x1GasMom = cons(i, j, k, x1GasMomentum_index);
+    const double x2GasMom = cons(i, j, k, x2GasMomentum_index);
+    const double x3GasMom = cons(i, j, k, x3GasMomentum_index);
+    const double Egastot = cons(i, j, k, gasEnergy_index);
+
+    const double Egas =
+        ComputeEintFromEgas(rho, x1GasMom, x2GasMom, x3GasMom, Egastot);
+    const double T_gas = ComputeTgasFromEgas(rho, Egas);
+    const double kappa = ComputePlanckOpacity(rho, T_gas);
+
+    if (kappa > 0.) {
+      const double Erad_eq = radiation_constant_ * std::pow(T_gas, 4);
+      if (std::abs(Erad_eq - Erad) > tol * Erad) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 template <typename problem_t>
 void RadSystem<problem_t>::PredictStep(
     arrayconst_t &consVarOld, array_t &consVarNew,
@@ -379,6 +565,19 @@ void RadSystem<problem_t>::AddFluxesRK2(
   });
 }
 
+template <typename problem_t>
+AMREX_GPU_HOST_DEVICE void RadSystem<problem_t>::ComputeReducedFluxNorm(
+    double fx, double fy, double fz, double &f, double &finv) {
+  const double s = fx * fx + fy * fy + fz * fz;
+  if constexpr (fast_closure_) {
+    finv = (s > 0.) ? reciprocal_sqrt(s) : 0.;
+    f = s * finv;
+  } else {
+    f = std::sqrt(s);
+    finv = (f > 0.) ? 1.0 / f : 0.;
+  }
+}
+
 template <typename problem_t>
 AMREX_GPU_HOST_DEVICE auto RadSystem<problem_t>::ComputeEddingtonFactor(double f_in)
     -> double {
@@ -386,6 +585,17 @@ AMREX_GPU_HOST_DEVICE auto RadSystem<problem_t>::ComputeEddingtonFactor(double f
   // compute Levermore (1984) closure [Eq. 25]
   // the is the M1 closure that is derived from Lorentz invariance
   const double f = clamp(f_in, 0., 1.); // restrict f to be within [0, 1]
+
+  if constexpr (fast_closure_) {
+    // (2,2) rational least-squares fit to the Levermore closure in s = f^2,
+    // constrained to be exact in the diffusion (chi = 1/3) and
+    // free-streaming (chi = 1) limits; the relative error is < 4.8e-5 in
+    // between and the fit stays within [1/3, 1]. avoids the square root.
+    const double s = f * f;
+    return (1. / 3. + s * (0.26465010822234 + s * (-0.23376762000818))) /
+           (1.0 + s * (-0.70520245640519 + s * 0.06941827795268));
+  }
+
   const double f_fac = std::sqrt(4.0 - 3.0 * (f * f));
   const double chi = (3.0 + 4.0 * (f * f)) / (5.0 + 2.0 * f_fac);
 
@@ -459,6 +669,260 @@ AMREX_GPU_DEVICE auto RadSystem<problem_t>::ComputeCellOpticalDepth(
   // return 0.5*(tau_L + tau_R); // arithmetic mean
 }
 
+template <typename problem_t>
+template <FluxDir DIR>
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE void RadSystem<problem_t>::ComputeHLLRadFlux(
+    double erad_L, double erad_R, double fx_L, double fx_R, double fy_L,
+    double fy_R, double fz_L, double fz_R,
+    quokka::Array4View<const amrex::Real, DIR> const &consVar,
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx, const double chat,
+    int i, int j, int k, quokka::valarray<double, nvarHyperbolic_> &F_out,
+    quokka::valarray<double, nvarHyperbolic_> &diffusiveF_out) {
+  // HLL solver following Toro (1998) and Balsara (2017).
+  // Radiation eigenvalues from Skinner & Ostriker (2013).
+
+  // compute scalar reduced flux f (and its reciprocal, for the direction
+  // normalization below)
+  double f_L = NAN;
+  double f_R = NAN;
+  double finv_L = NAN;
+  double finv_R = NAN;
+  ComputeReducedFluxNorm(fx_L, fy_L, fz_L, f_L, finv_L);
+  ComputeReducedFluxNorm(fx_R, fy_R, fz_R, f_R, finv_R);
+
+  // Compute "un-reduced" Fx, Fy, Fz
+  double Fx_L = fx_L * (c_light_ * erad_L);
+  double Fx_R = fx_R * (c_light_ * erad_R);
+
+  double Fy_L = fy_L * (c_light_ * erad_L);
+  double Fy_R = fy_R * (c_light_ * erad_R);
+
+  double Fz_L = fz_L * (c_light_ * erad_L);
+  double Fz_R = fz_R * (c_light_ * erad_R);
+
+  // check that states are physically admissible; if not, use first-order
+  // reconstruction
+  if (!((erad_L > 0.) && (erad_R > 0.) && (f_L < 1.) && (f_R < 1.))) {
+    erad_L = consVar(i - 1, j, k, radEnergy_index);
+    erad_R = consVar(i, j, k, radEnergy_index);
+
+    Fx_L = consVar(i - 1, j, k, x1RadFlux_index);
+    Fx_R = consVar(i, j, k, x1RadFlux_index);
+
+    Fy_L = consVar(i - 1, j, k, x2RadFlux_index);
+    Fy_R = consVar(i, j, k, x2RadFlux_index);
+
+    Fz_L = consVar(i - 1, j, k, x3RadFlux_index);
+    Fz_R = consVar(i, j, k, x3RadFlux_index);
+
+    // compute primitive variables
+    fx_L = Fx_L / (c_light_ * erad_L);
+    fx_R = Fx_R / (c_light_ * erad_R);
+
+    fy_L = Fy_L / (c_light_ * erad_L);
+    fy_R = Fy_R / (c_light_ * erad_R);
+
+    fz_L = Fz_L / (c_light_ * erad_L);
+    fz_R = Fz_R / (c_light_ * erad_R);
+
+    ComputeReducedFluxNorm(fx_L, fy_L, fz_L, f_L, finv_L);
+    ComputeReducedFluxNorm(fx_R, fy_R, fz_R, f_R, finv_R);
+  }
+
+  // check that states are physically admissible
+  AMREX_ASSERT(erad_L > 0.0);
+  AMREX_ASSERT(erad_R > 0.0);
+  // AMREX_ASSERT(f_L < 1.0); // there is sometimes a small (<1%) flux
+  // limiting violation when using P1 AMREX_ASSERT(f_R < 1.0);
+
+  std::array<amrex::Real, 3> fvec_L = {fx_L, fy_L, fz_L};
+  std::array<amrex::Real, 3> fvec_R = {fx_R, fy_R, fz_R};
+
+  // angle between interface and radiation flux \hat{n}
+  // If direction is undefined, just drop direction-dependent
+  // terms.
+  std::array<amrex::Real, 3> n_L{};
+  std::array<amrex::Real, 3> n_R{};
+
+  for (int i = 0; i < 3; ++i) {
+    n_L[i] = fvec_L[i] * finv_L;
+    n_R[i] = fvec_R[i] * finv_R;
+  }
+
+  // compute radiation pressure tensors
+  const double chi_L = RadSystem<problem_t>::ComputeEddingtonFactor(f_L);
+  const double chi_R = RadSystem<problem_t>::ComputeEddingtonFactor(f_R);
+
+  AMREX_ASSERT((chi_L >= 1. / 3.) && (chi_L <= 1.0)); // NOLINT
+  AMREX_ASSERT((chi_R >= 1. / 3.) && (chi_R <= 1.0)); // NOLINT
+
+  // diagonal term of Eddington tensor
+  const double Tdiag_L = (1.0 - chi_L) / 2.0;
+  const double Tdiag_R = (1.0 - chi_R) / 2.0;
+
+  // anisotropic term of Eddington tensor (in the direction of the
+  // rad. flux)
+  const double Tf_L = (3.0 * chi_L - 1.0) / 2.0;
+  const double Tf_R = (3.0 * chi_R - 1.0) / 2.0;
+
+  // assemble Eddington tensor
+  double T_L[3][3];
+  double T_R[3][3];
+  double P_L[3][3];
+  double P_R[3][3];
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      const double delta_ij = (i == j) ? 1 : 0;
+      T_L[i][j] = Tdiag_L * delta_ij + Tf_L * (n_L[i] * n_L[j]);
+      T_R[i][j] = Tdiag_R * delta_ij + Tf_R * (n_R[i] * n_R[j]);
+      // compute the elements of the total radiation pressure
+      // tensor
+      P_L[i][j] = T_L[i][j] * erad_L;
+      P_R[i][j] = T_R[i][j] * erad_R;
+    }
+  }
+
+  // frozen Eddington tensor approximation, following Balsara
+  // (1999) [JQSRT Vol. 61, No. 5, pp. 617–627, 1999], Eq. 46.
+  double Tnormal_L = NAN;
+  double Tnormal_R = NAN;
+  if constexpr (DIR == FluxDir::X1) {
+    Tnormal_L = T_L[0][0];
+    Tnormal_R = T_R[0][0];
+  } else if constexpr (DIR == FluxDir::X2) {
+    Tnormal_L = T_L[1][1];
+    Tnormal_R = T_R[1][1];
+  } else if constexpr (DIR == FluxDir::X3) {
+    Tnormal_L = T_L[2][2];
+    Tnormal_R = T_R[2][2];
+  }
+
+  // compute fluxes F_L, F_R
+  // P_nx, P_ny, P_nz indicate components where 'n' is the direction of the
+  // face normal F_n is the radiation flux component in the direction of the
+  // face normal
+  double Fn_L = NAN;
+  double Fn_R = NAN;
+  double Pnx_L = NAN;
+  double Pnx_R = NAN;
+  double Pny_L = NAN;
+  double Pny_R = NAN;
+  double Pnz_L = NAN;
+  double Pnz_R = NAN;
+
+  if constexpr (DIR == FluxDir::X1) {
+    Fn_L = Fx_L;
+    Fn_R = Fx_R;
+
+    Pnx_L = P_L[0][0];
+    Pny_L = P_L[0][1];
+    Pnz_L = P_L[0][2];
+
+    Pnx_R = P_R[0][0];
+    Pny_R = P_R[0][1];
+    Pnz_R = P_R[0][2];
+  } else if constexpr (DIR == FluxDir::X2) {
+    Fn_L = Fy_L;
+    Fn_R = Fy_R;
+
+    Pnx_L = P_L[1][0];
+    Pny_L = P_L[1][1];
+    Pnz_L = P_L[1][2];
+
+    Pnx_R = P_R[1][0];
+    Pny_R = P_R[1][1];
+    Pnz_R = P_R[1][2];
+  } else if constexpr (DIR == FluxDir::X3) {
+    Fn_L = Fz_L;
+    Fn_R = Fz_R;
+
+    Pnx_L = P_L[2][0];
+    Pny_L = P_L[2][1];
+    Pnz_L = P_L[2][2];
+
+    Pnx_R = P_R[2][0];
+    Pny_R = P_R[2][1];
+    Pnz_R = P_R[2][2];
+  }
+
+  AMREX_ASSERT(Fn_L != NAN);
+  AMREX_ASSERT(Fn_R != NAN);
+  AMREX_ASSERT(Pnx_L != NAN);
+  AMREX_ASSERT(Pnx_R != NAN);
+  AMREX_ASSERT(Pny_L != NAN);
+  AMREX_ASSERT(Pny_R != NAN);
+  AMREX_ASSERT(Pnz_L != NAN);
+  AMREX_ASSERT(Pnz_R != NAN);
+
+  const quokka::valarray<double, nvarHyperbolic_> F_L = {
+      (chat / c_light_) * Fn_L, (chat * c_light_) * Pnx_L,
+      (chat * c_light_) * Pny_L, (chat * c_light_) * Pnz_L};
+
+  const quokka::valarray<double, nvarHyperbolic_> F_R = {
+      (chat / c_light_) * Fn_R, (chat * c_light_) * Pnx_R,
+      (chat * c_light_) * Pny_R, (chat * c_light_) * Pnz_R};
+
+  const quokka::valarray<double, nvarHyperbolic_> U_L = {erad_L, Fx_L, Fy_L,
+                                                         Fz_L};
+  const quokka::valarray<double, nvarHyperbolic_> U_R = {erad_R, Fx_R, Fy_R,
+                                                         Fz_R};
+
+  // asymptotic-preserving flux correction
+  // [Similar to Skinner et al. (2019), but tau^-2 instead of tau^-1, which
+  // does not appear to be asymptotic-preserving with PLM+SDC2.]
+  const double tau_cell = ComputeCellOpticalDepth<DIR>(consVar, dx, i, j, k);
+
+  // ensures that signal speed -> c \sqrt{f_xx} / tau_cell in the diffusion
+  // limit [see Appendix of Jiang et al. ApJ 767:148 (2013)]
+  // const double S_corr = std::sqrt(1.0 - std::exp(-tau_cell * tau_cell)) /
+  //		      tau_cell; // Jiang et al. (2013)
+  const double S_corr = std::min(1.0, 1.0 / tau_cell); // Skinner et al.
+
+  // adjust the wavespeeds
+  // (this factor cancels out except for the last term in the HLL flux)
+  // const quokka::valarray<double, nvarHyperbolic_> epsilon = {
+  //    S_corr, 1.0, 1.0, 1.0}; // Skinner et al. (2019)
+  // const quokka::valarray<double, nvarHyperbolic_> epsilon = {S_corr,
+  // S_corr,
+  //    S_corr, S_corr}; // Jiang et al. (2013)
+  const quokka::valarray<double, nvarHyperbolic_> epsilon = {
+      S_corr * S_corr, S_corr, S_corr, S_corr}; // this code
+
+  // compute the norm of the wavespeed vector
+  double sqrt_Tn_L = NAN;
+  double sqrt_Tn_R = NAN;
+  if constexpr (fast_closure_) {
+    // sqrt(x) == x * rsqrt(x) (with the x == 0 case guarded)
+    sqrt_Tn_L = (Tnormal_L > 0.) ? Tnormal_L * reciprocal_sqrt(Tnormal_L) : 0.;
+    sqrt_Tn_R = (Tnormal_R > 0.) ? Tnormal_R * reciprocal_sqrt(Tnormal_R) : 0.;
+  } else {
+    sqrt_Tn_L = std::sqrt(Tnormal_L);
+    sqrt_Tn_R = std::sqrt(Tnormal_R);
+  }
+  const double S_L = std::min(-0.1 * chat, -chat * sqrt_Tn_L);
+  const double S_R = std::max(0.1 * chat, chat * sqrt_Tn_R);
+
+  AMREX_ASSERT(std::abs(S_L) <= chat); // NOLINT
+  AMREX_ASSERT(std::abs(S_R) <= chat); // NOLINT
+
+  // in the frozen Eddington tensor approximation, we are always
+  // in the star region, so F = F_star
+  const quokka::valarray<double, nvarHyperbolic_> F =
+      (S_R / (S_R - S_L)) * F_L - (S_L / (S_R - S_L)) * F_R +
+      epsilon * (S_R * S_L / (S_R - S_L)) * (U_R - U_L);
+
+  // check states are valid
+  AMREX_ASSERT(!std::isnan(F[0])); // NOLINT
+  AMREX_ASSERT(!std::isnan(F[1])); // NOLINT
+  AMREX_ASSERT(!std::isnan(F[2])); // NOLINT
+  AMREX_ASSERT(!std::isnan(F[3])); // NOLINT
+
+  F_out = F;
+  diffusiveF_out = (S_R / (S_R - S_L)) * F_L - (S_L / (S_R - S_L)) * F_R +
+                   (S_R * S_L / (S_R - S_L)) * (U_R - U_L);
+}
+
 template <typename problem_t>
 template <FluxDir DIR>
 void RadSystem<problem_t>::ComputeFluxes(
@@ -466,7 +930,7 @@ void RadSystem<problem_t>::ComputeFluxes(
     amrex::Array4<const amrex::Real> const &x1LeftState_in,
     amrex::Array4<const amrex::Real> const &x1RightState_in,
     amrex::Box const &indexRange, arrayconst_t &consVar_in,
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx) {
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx, const double chat) {
   quokka::Array4View<const amrex::Real, DIR> x1LeftState(x1LeftState_in);
   quokka::Array4View<const amrex::Real, DIR> x1RightState(x1RightState_in);
   quokka::Array4View<amrex::Real, DIR> x1Flux(x1Flux_in);
@@ -484,253 +948,104 @@ void RadSystem<problem_t>::ComputeFluxes(
                                                       int k_in) {
     auto [i, j, k] = quokka::reorderMultiIndex<DIR>(i_in, j_in, k_in);
 
-    // HLL solver following Toro (1998) and Balsara (2017).
-    // Radiation eigenvalues from Skinner & Ostriker (2013).
-
-    // gather left- and right- state variables
-    double erad_L = x1LeftState(i, j, k, primRadEnergy_index);
-    double erad_R = x1RightState(i, j, k, primRadEnergy_index);
-
-    double fx_L = x1LeftState(i, j, k, x1ReducedFlux_index);
-    double fx_R = x1RightState(i, j, k, x1ReducedFlux_index);
-
-    double fy_L = x1LeftState(i, j, k, x2ReducedFlux_index);
-    double fy_R = x1RightState(i, j, k, x2ReducedFlux_index);
-
-    double fz_L = x1LeftState(i, j, k, x3ReducedFlux_index);
-    double fz_R = x1RightState(i, j, k, x3ReducedFlux_index);
+    // gather the left- and right- interface states from the staging arrays
+    const double erad_L = x1LeftState(i, j, k, primRadEnergy_index);
+    const double erad_R = x1RightState(i, j, k, primRadEnergy_index);
 
-    // compute scalar reduced flux f
-    double f_L = std::sqrt(fx_L * fx_L + fy_L * fy_L + fz_L * fz_L);
-    double f_R = std::sqrt(fx_R * fx_R + fy_R * fy_R + fz_R * fz_R);
+    const double fx_L = x1LeftState(i, j, k, x1ReducedFlux_index);
+    const double fx_R = x1RightState(i, j, k, x1ReducedFlux_index);
 
-    // Compute "un-reduced" Fx, Fy, Fz
-    double Fx_L = fx_L * (c_light_ * erad_L);
-    double Fx_R = fx_R * (c_light_ * erad_R);
+    const double fy_L = x1LeftState(i, j, k, x2ReducedFlux_index);
+    const double fy_R = x1RightState(i, j, k, x2ReducedFlux_index);
 
-    double Fy_L = fy_L * (c_light_ * erad_L);
-    double Fy_R = fy_R * (c_light_ * erad_R);
+    const double fz_L = x1LeftState(i, j, k, x3ReducedFlux_index);
+    const double fz_R = x1RightState(i, j, k, x3ReducedFlux_index);
 
-    double Fz_L = fz_L * (c_light_ * erad_L);
-    double Fz_R = fz_R * (c_light_ * erad_R);
+    quokka::valarray<double, nvarHyperbolic_> F{};
+    quokka::valarray<double, nvarHyperbolic_> diffusiveF{};
+    ComputeHLLRadFlux<DIR>(erad_L, erad_R, fx_L, fx_R, fy_L, fy_R, fz_L, fz_R,
+                           consVar, dx, chat, i, j, k, F, diffusiveF);
 
-    // check that states are physically admissible; if not, use first-order
-    // reconstruction
-    if (!((erad_L > 0.) && (erad_R > 0.) && (f_L < 1.) && (f_R < 1.))) {
-      erad_L = consVar(i - 1, j, k, radEnergy_index);
-      erad_R = consVar(i, j, k, radEnergy_index);
-
-      Fx_L = consVar(i - 1, j, k, x1RadFlux_index);
-      Fx_R = consVar(i, j, k, x1RadFlux_index);
-
-      Fy_L = consVar(i - 1, j, k, x2RadFlux_index);
-      Fy_R = consVar(i, j, k, x2RadFlux_index);
-
-      Fz_L = consVar(i - 1, j, k, x3RadFlux_index);
-      Fz_R = consVar(i, j, k, x3RadFlux_index);
-
-      // compute primitive variables
-      fx_L = Fx_L / (c_light_ * erad_L);
-      fx_R = Fx_R / (c_light_ * erad_R);
-
-      fy_L = Fy_L / (c_light_ * erad_L);
-      fy_R = Fy_R / (c_light_ * erad_R);
-
-      fz_L = Fz_L / (c_light_ * erad_L);
-      fz_R = Fz_R / (c_light_ * erad_R);
-
-      f_L = std::sqrt(fx_L * fx_L + fy_L * fy_L + fz_L * fz_L);
-      f_R = std::sqrt(fx_R * fx_R + fy_R * fy_R + fz_R * fz_R);
-    }
-
-    // check that states are physically admissible
-    AMREX_ASSERT(erad_L > 0.0);
-    AMREX_ASSERT(erad_R > 0.0);
-    // AMREX_ASSERT(f_L < 1.0); // there is sometimes a small (<1%) flux
-    // limiting violation when using P1 AMREX_ASSERT(f_R < 1.0);
+    x1Flux(i, j, k, radEnergy_index - nstartHyperbolic_) = F[0];
+    x1Flux(i, j, k, x1RadFlux_index - nstartHyperbolic_) = F[1];
+    x1Flux(i, j, k, x2RadFlux_index - nstartHyperbolic_) = F[2];
+    x1Flux(i, j, k, x3RadFlux_index - nstartHyperbolic_) = F[3];
 
-    std::array<amrex::Real, 3> fvec_L = {fx_L, fy_L, fz_L};
-    std::array<amrex::Real, 3> fvec_R = {fx_R, fy_R, fz_R};
+    x1FluxDiffusive(i, j, k, radEnergy_index - nstartHyperbolic_) =
+        diffusiveF[0];
+    x1FluxDiffusive(i, j, k, x1RadFlux_index - nstartHyperbolic_) =
+        diffusiveF[1];
+    x1FluxDiffusive(i, j, k, x2RadFlux_index - nstartHyperbolic_) =
+        diffusiveF[2];
+    x1FluxDiffusive(i, j, k, x3RadFlux_index - nstartHyperbolic_) =
+        diffusiveF[3];
+  });
+}
 
-    // angle between interface and radiation flux \hat{n}
-    // If direction is undefined, just drop direction-dependent
-    // terms.
-    std::array<amrex::Real, 3> n_L{};
-    std::array<amrex::Real, 3> n_R{};
+template <typename problem_t>
+template <FluxDir DIR>
+void RadSystem<problem_t>::ComputeFusedFluxesPPM(
+    array_t &x1Flux_in, array_t &x1FluxDiffusive_in,
+    amrex::Box const &indexRange, arrayconst_t &consVar_in,
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx, const double chat) {
+  quokka::Array4View<amrex::Real, DIR> x1Flux(x1Flux_in);
+  quokka::Array4View<amrex::Real, DIR> x1FluxDiffusive(x1FluxDiffusive_in);
+  quokka::Array4View<const amrex::Real, DIR> consVar(consVar_in);
 
-    for (int i = 0; i < 3; ++i) {
-      n_L[i] = (f_L > 0.) ? (fvec_L[i] / f_L) : 0.;
-      n_R[i] = (f_R > 0.) ? (fvec_R[i] / f_R) : 0.;
-    }
+  // By convention, the interfaces are defined on the left edge of each
+  // zone, i.e. xinterface_(i) is the solution to the Riemann problem at
+  // the left edge of zone i.
 
-    // compute radiation pressure tensors
-    const double chi_L = RadSystem<problem_t>::ComputeEddingtonFactor(f_L);
-    const double chi_R = RadSystem<problem_t>::ComputeEddingtonFactor(f_R);
-
-    AMREX_ASSERT((chi_L >= 1. / 3.) && (chi_L <= 1.0)); // NOLINT
-    AMREX_ASSERT((chi_R >= 1. / 3.) && (chi_R <= 1.0)); // NOLINT
-
-    // diagonal term of Eddington tensor
-    const double Tdiag_L = (1.0 - chi_L) / 2.0;
-    const double Tdiag_R = (1.0 - chi_R) / 2.0;
-
-    // anisotropic term of Eddington tensor (in the direction of the
-    // rad. flux)
-    const double Tf_L = (3.0 * chi_L - 1.0) / 2.0;
-    const double Tf_R = (3.0 * chi_R - 1.0) / 2.0;
-
-    // assemble Eddington tensor
-    double T_L[3][3];
-    double T_R[3][3];
-    double P_L[3][3];
-    double P_R[3][3];
-
-    for (int i = 0; i < 3; ++i) {
-      for (int j = 0; j < 3; ++j) {
-        const double delta_ij = (i == j) ? 1 : 0;
-        T_L[i][j] = Tdiag_L * delta_ij + Tf_L * (n_L[i] * n_L[j]);
-        T_R[i][j] = Tdiag_R * delta_ij + Tf_R * (n_R[i] * n_R[j]);
-        // compute the elements of the total radiation pressure
-        // tensor
-        P_L[i][j] = T_L[i][j] * erad_L;
-        P_R[i][j] = T_R[i][j] * erad_R;
-      }
-    }
+  // interface-centered kernel
+  amrex::ParallelFor(indexRange, [=] AMREX_GPU_DEVICE(int i_in, int j_in,
+                                                      int k_in) {
+    auto [i, j, k] = quokka::reorderMultiIndex<DIR>(i_in, j_in, k_in);
 
-    // frozen Eddington tensor approximation, following Balsara
-    // (1999) [JQSRT Vol. 61, No. 5, pp. 617–627, 1999], Eq. 46.
-    double Tnormal_L = NAN;
-    double Tnormal_R = NAN;
-    if constexpr (DIR == FluxDir::X1) {
-      Tnormal_L = T_L[0][0];
-      Tnormal_R = T_R[0][0];
-    } else if constexpr (DIR == FluxDir::X2) {
-      Tnormal_L = T_L[1][1];
-      Tnormal_R = T_R[1][1];
-    } else if constexpr (DIR == FluxDir::X3) {
-      Tnormal_L = T_L[2][2];
-      Tnormal_R = T_R[2][2];
+    // convert conserved to primitive variables for the 6-cell stencil
+    // covering the PPM parabolae of the two cells adjacent to this interface
+    // (this re-derives the reduced flux from registers instead of staging a
+    // primitive FAB through global memory)
+    double q[nvarHyperbolic_][6]; // NOLINT
+    for (int m = 0; m < 6; ++m) {
+      const double E_r = consVar(i - 3 + m, j, k, radEnergy_index);
+      AMREX_ASSERT(E_r > 0.0); // NOLINT
+      q[0][m] = E_r;
+      q[1][m] = consVar(i - 3 + m, j, k, x1RadFlux_index) / (c_light_ * E_r);
+      q[2][m] = consVar(i - 3 + m, j, k, x2RadFlux_index) / (c_light_ * E_r);
+      q[3][m] = consVar(i - 3 + m, j, k, x3RadFlux_index) / (c_light_ * E_r);
     }
 
-    // compute fluxes F_L, F_R
-    // P_nx, P_ny, P_nz indicate components where 'n' is the direction of the
-    // face normal F_n is the radiation flux component in the direction of the
-    // face normal
-    double Fn_L = NAN;
-    double Fn_R = NAN;
-    double Pnx_L = NAN;
-    double Pnx_R = NAN;
-    double Pny_L = NAN;
-    double Pny_R = NAN;
-    double Pnz_L = NAN;
-    double Pnz_R = NAN;
-
-    if constexpr (DIR == FluxDir::X1) {
-      Fn_L = Fx_L;
-      Fn_R = Fx_R;
-
-      Pnx_L = P_L[0][0];
-      Pny_L = P_L[0][1];
-      Pnz_L = P_L[0][2];
-
-      Pnx_R = P_R[0][0];
-      Pny_R = P_R[0][1];
-      Pnz_R = P_R[0][2];
-    } else if constexpr (DIR == FluxDir::X2) {
-      Fn_L = Fy_L;
-      Fn_R = Fy_R;
-
-      Pnx_L = P_L[1][0];
-      Pny_L = P_L[1][1];
-      Pnz_L = P_L[1][2];
-
-      Pnx_R = P_R[1][0];
-      Pny_R = P_R[1][1];
-      Pnz_R = P_R[1][2];
-    } else if constexpr (DIR == FluxDir::X3) {
-      Fn_L = Fz_L;
-      Fn_R = Fz_R;
-
-      Pnx_L = P_L[2][0];
-      Pny_L = P_L[2][1];
-      Pnz_L = P_L[2][2];
-
-      Pnx_R = P_R[2][0];
-      Pny_R = P_R[2][1];
-      Pnz_R = P_R[2][2];
+    // reconstruct the interface states: the left state is the right-edge
+    // value of cell (i-1), the right state is the left-edge value of cell i
+    double s_L[nvarHyperbolic_]; // NOLINT
+    double s_R[nvarHyperbolic_]; // NOLINT
+    for (int n = 0; n < nvarHyperbolic_; ++n) {
+      const std::pair<double, double> bounds_L =
+          std::minmax({q[n][2], q[n][1], q[n][3]});
+      const std::pair<double, double> bounds_R =
+          std::minmax({q[n][3], q[n][2], q[n][4]});
+
+      s_L[n] = RadSystem<problem_t>::ReconstructCellPPM(
+                   q[n][0], q[n][1], q[n][2], q[n][3], q[n][4], bounds_L)
+                   .second; // right-edge value of cell (i-1)
+      s_R[n] = RadSystem<problem_t>::ReconstructCellPPM(
+                   q[n][1], q[n][2], q[n][3], q[n][4], q[n][5], bounds_R)
+                   .first; // left-edge value of cell i
     }
 
-    AMREX_ASSERT(Fn_L != NAN);
-    AMREX_ASSERT(Fn_R != NAN);
-    AMREX_ASSERT(Pnx_L != NAN);
-    AMREX_ASSERT(Pnx_R != NAN);
-    AMREX_ASSERT(Pny_L != NAN);
-    AMREX_ASSERT(Pny_R != NAN);
-    AMREX_ASSERT(Pnz_L != NAN);
-    AMREX_ASSERT(Pnz_R != NAN);
-
-    const quokka::valarray<double, nvarHyperbolic_> F_L = {
-        (c_hat_ / c_light_) * Fn_L, (c_hat_ * c_light_) * Pnx_L,
-        (c_hat_ * c_light_) * Pny_L, (c_hat_ * c_light_) * Pnz_L};
-
-    const quokka::valarray<double, nvarHyperbolic_> F_R = {
-        (c_hat_ / c_light_) * Fn_R, (c_hat_ * c_light_) * Pnx_R,
-        (c_hat_ * c_light_) * Pny_R, (c_hat_ * c_light_) * Pnz_R};
-
-    const quokka::valarray<double, nvarHyperbolic_> U_L = {erad_L, Fx_L, Fy_L,
-                                                           Fz_L};
-    const quokka::valarray<double, nvarHyperbolic_> U_R = {erad_R, Fx_R, Fy_R,
-                                                           Fz_R};
-
-    // asymptotic-preserving flux correction
-    // [Similar to Skinner et al. (2019), but tau^-2 instead of tau^-1, which
-    // does not appear to be asymptotic-preserving with PLM+SDC2.]
-    const double tau_cell = ComputeCellOpticalDepth<DIR>(consVar, dx, i, j, k);
-
-    // ensures that signal speed -> c \sqrt{f_xx} / tau_cell in the diffusion
-    // limit [see Appendix of Jiang et al. ApJ 767:148 (2013)]
-    // const double S_corr = std::sqrt(1.0 - std::exp(-tau_cell * tau_cell)) /
-    //		      tau_cell; // Jiang et al. (2013)
-    const double S_corr = std::min(1.0, 1.0 / tau_cell); // Skinner et al.
-
-    // adjust the wavespeeds
-    // (this factor cancels out except for the last term in the HLL flux)
-    // const quokka::valarray<double, nvarHyperbolic_> epsilon = {
-    //    S_corr, 1.0, 1.0, 1.0}; // Skinner et al. (2019)
-    // const quokka::valarray<double, nvarHyperbolic_> epsilon = {S_corr,
-    // S_corr,
-    //    S_corr, S_corr}; // Jiang et al. (2013)
-    const quokka::valarray<double, nvarHyperbolic_> epsilon = {
-        S_corr * S_corr, S_corr, S_corr, S_corr}; // this code
-
-    // compute the norm of the wavespeed vector
-    const double S_L = std::min(-0.1 * c_hat_, -c_hat_ * std::sqrt(Tnormal_L));
-    const double S_R = std::max(0.1 * c_hat_, c_hat_ * std::sqrt(Tnormal_R));
-
-    AMREX_ASSERT(std::abs(S_L) <= c_hat_); // NOLINT
-    AMREX_ASSERT(std::abs(S_R) <= c_hat_); // NOLINT
-
-    // in the frozen Eddington tensor approximation, we are always
-    // in the star region, so F = F_star
-    const quokka::valarray<double, nvarHyperbolic_> F =
-        (S_R / (S_R - S_L)) * F_L - (S_L / (S_R - S_L)) * F_R +
-        epsilon * (S_R * S_L / (S_R - S_L)) * (U_R - U_L);
-
-    // check states are valid
-    AMREX_ASSERT(!std::isnan(F[0])); // NOLINT
-    AMREX_ASSERT(!std::isnan(F[1])); // NOLINT
-    AMREX_ASSERT(!std::isnan(F[2])); // NOLINT
-    AMREX_ASSERT(!std::isnan(F[3])); // NOLINT
+    quokka::valarray<double, nvarHyperbolic_> F{};
+    quokka::valarray<double, nvarHyperbolic_> diffusiveF{};
+    ComputeHLLRadFlux<DIR>(s_L[primRadEnergy_index], s_R[primRadEnergy_index],
+                           s_L[x1ReducedFlux_index], s_R[x1ReducedFlux_index],
+                           s_L[x2ReducedFlux_index], s_R[x2ReducedFlux_index],
+                           s_L[x3ReducedFlux_index], s_R[x3ReducedFlux_index],
+                           consVar, dx, chat, i, j, k, F, diffusiveF);
 
     x1Flux(i, j, k, radEnergy_index - nstartHyperbolic_) = F[0];
     x1Flux(i, j, k, x1RadFlux_index - nstartHyperbolic_) = F[1];
     x1Flux(i, j, k, x2RadFlux_index - nstartHyperbolic_) = F[2];
     x1Flux(i, j, k, x3RadFlux_index - nstartHyperbolic_) = F[3];
 
-    const quokka::valarray<double, nvarHyperbolic_> diffusiveF =
-        (S_R / (S_R - S_L)) * F_L - (S_L / (S_R - S_L)) * F_R +
-        (S_R * S_L / (S_R - S_L)) * (U_R - U_L);
-
     x1FluxDiffusive(i, j, k, radEnergy_index - nstartHyperbolic_) =
         diffusiveF[0];
     x1FluxDiffusive(i, j, k, x1RadFlux_index - nstartHyperbolic_) =
@@ -830,8 +1145,11 @@ template <typename problem_t>
 void RadSystem<problem_t>::AddSourceTerms(array_t &consVar,
                                           arrayconst_t &radEnergySource,
                                           arrayconst_t &advectionFluxes,
+                                          array_t &newtonDeltaCache,
                                           amrex::Box const &indexRange,
-                                          amrex::Real dt) {
+                                          amrex::Real dt,
+                                          amrex::Long *p_iterCount,
+                                          const double chat_in) {
   arrayconst_t &consPrev = consVar; // make read-only
   array_t &consNew = consVar;
 
@@ -843,7 +1161,7 @@ void RadSystem<problem_t>::AddSourceTerms(array_t &consVar,
   // cell-centered kernel
   amrex::ParallelFor(indexRange, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
     const double c = c_light_;
-    const double chat = c_hat_;
+    const double chat = chat_in;
 
     // load fluid properties
     const double rho = consPrev(i, j, k, gasDensity_index);
@@ -877,14 +1195,24 @@ void RadSystem<problem_t>::AddSourceTerms(array_t &consVar,
       const double Etot0 = Egas0 + (c / chat) * (Erad0 + Src);
 
       // BEGIN NEWTON-RAPHSON LOOP
-      Egas_guess = Egas0;
-      Erad_guess = Erad0;
+      // warm-start from the converged increments of the previous substep
+      // (the cache is zero-initialized, so the first substep is a cold start;
+      //  for a smooth solution the increments change slowly between substeps,
+      //  so the warm-started guess converges in far fewer iterations)
+      Egas_guess = Egas0 + newtonDeltaCache(i, j, k, 0);
+      Erad_guess = Erad0 + newtonDeltaCache(i, j, k, 1);
+      if (!((Egas_guess > 0.0) && (Erad_guess > 0.0))) {
+        // extrapolated guess is unphysical -- fall back to a cold start
+        Egas_guess = Egas0;
+        Erad_guess = Erad0;
+      }
 
       const double a_rad = radiation_constant_;
       double F_G = NAN;
       double F_R = NAN;
       double rhs = NAN;
       double kappa = NAN;
+      double dkappa_dTgas = NAN;
       double fourPiB = NAN;
       double drhs_dEgas = NAN;
       double dFG_dEgas = NAN;
@@ -905,15 +1233,19 @@ void RadSystem<problem_t>::AddSourceTerms(array_t &consVar,
         AMREX_ASSERT(T_gas >= 0.);
 
         // compute opacity, emissivity
-        kappa = RadSystem<problem_t>::ComputePlanckOpacity(rho, T_gas);
+        // (temperature-independent opacities only need to be evaluated on the
+        //  first iteration; see RadSystem_Traits)
+        if ((n == 0) || !opacity_is_temperature_independent_) {
+          kappa = RadSystem<problem_t>::ComputePlanckOpacity(rho, T_gas);
+          dkappa_dTgas =
+              RadSystem<problem_t>::ComputePlanckOpacityTempDerivative(rho,
+                                                                       T_gas);
+        }
         AMREX_ASSERT(kappa >= 0.);
         fourPiB = chat * a_rad * std::pow(T_gas, 4);
 
         // compute derivatives w/r/t T_gas
         const double dB_dTgas = (4.0 * fourPiB) / T_gas;
-        const double dkappa_dTgas =
-            RadSystem<problem_t>::ComputePlanckOpacityTempDerivative(rho,
-                                                                     T_gas);
 
         // compute residuals
         rhs = dt * (rho * kappa) * (fourPiB - chat * Erad_guess);
@@ -970,6 +1302,12 @@ void RadSystem<problem_t>::AddSourceTerms(array_t &consVar,
 
       AMREX_ALWAYS_ASSERT(Erad_guess > 0.0);
       AMREX_ALWAYS_ASSERT(Egas_guess > 0.0);
+
+      // save the converged increments to warm-start the next substep,
+      // and accumulate the iteration count for solver statistics
+      newtonDeltaCache(i, j, k, 0) = Egas_guess - Egas0;
+      newtonDeltaCache(i, j, k, 1) = Erad_guess - Erad0;
+      amrex::Gpu::Atomic::Add(p_iterCount, static_cast<amrex::Long>(n));
     } // endif gamma != 1.0
 
     // 2. Compute radiation flux update
@@ -1021,7 +1359,7 @@ void RadSystem<problem_t>::AddSourceTerms(array_t &consVar,
         amrex::Real const Ekin1 = Egastot1 - Egas_guess;
         amrex::Real const dEkin_work = Ekin1 - Ekin0;
         // compute loss of radiation energy to gas kinetic energy
-        dErad_work = -(c_hat_ / c_light_) * dEkin_work;
+        dErad_work = -(chat / c) * dEkin_work;
       } else {
         // do not subtract radiation work in new radiation energy
         dErad_work = 0.;
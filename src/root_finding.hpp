@@ -6,12 +6,15 @@
 #ifndef ROOT_FINDING_HPP_
 #define ROOT_FINDING_HPP_
 
+#include <cmath>
 #include <limits>
 
 #include "AMReX_BLassert.H"
 #include "AMReX_GpuQualifiers.H"
 #include "AMReX_REAL.H"
 
+#include "valarray.hpp"
+
 #define BOOST_MATH_STD_USING_CORE                                              \
   using std::abs;                                                              \
   using std::acos;                                                             \
@@ -462,6 +465,74 @@ toms748_solve(F f, const T &ax, const T &bx, Tol tol, int &max_iter) {
   return r;
 }
 
+//
+// Solve N independent bracketed root-finding problems in lockstep.
+//
+// Unlike toms748_solve, whose data-dependent control flow serializes GPU
+// warps and defeats CPU autovectorization when adjacent cells take different
+// paths, every lane here executes the same instruction sequence each sweep:
+// the candidate point is a false-position step demoted to the bisection
+// midpoint by predicated selects when the secant degenerates or leaves the
+// bracket, with the Illinois weighting to guarantee bracket shrinkage under
+// one-sided convergence. 'f' evaluates all N residuals at once
+// (quokka::valarray in, quokka::valarray out), so callers can fuse table
+// lookups across the batch. Each input bracket [a_n, b_n] must straddle a
+// sign change. Returns the midpoints of the final brackets.
+//
+template <class F, class T, int N>
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE auto
+bracket_solve_batch(F f, quokka::valarray<T, N> a, quokka::valarray<T, N> b,
+                    eps_tolerance<T> tol, int max_iter)
+    -> quokka::valarray<T, N> {
+  quokka::valarray<T, N> fa = f(a);
+  quokka::valarray<T, N> fb = f(b);
+  quokka::valarray<T, N> side{}; // +1: 'a' was replaced last sweep; -1: 'b'
+
+  for (int iter = 0; iter < max_iter; ++iter) {
+    bool all_converged = true;
+    for (int n = 0; n < N; ++n) {
+      all_converged = all_converged && tol(a[n], b[n]);
+    }
+    if (all_converged) { // uniform across the batch, so no divergence
+      break;
+    }
+
+    quokka::valarray<T, N> c{};
+    for (int n = 0; n < N; ++n) {
+      const T mid = a[n] + T(0.5) * (b[n] - a[n]);
+      const T denom = fb[n] - fa[n];
+      const T secant =
+          (denom != T(0)) ? (b[n] - fb[n] * (b[n] - a[n]) / denom) : mid;
+      const bool inside = (secant > (std::min)(a[n], b[n])) &&
+                          (secant < (std::max)(a[n], b[n]));
+      // converged lanes idle at their (stationary) midpoint
+      c[n] = (inside && !tol(a[n], b[n])) ? secant : mid;
+    }
+
+    const quokka::valarray<T, N> fc = f(c);
+
+    for (int n = 0; n < N; ++n) {
+      // keep the sub-interval that still straddles the sign change
+      const bool left = (std::signbit(fc[n]) == std::signbit(fa[n]));
+      const T a_new = left ? c[n] : a[n];
+      const T fa_new = left ? fc[n] : fa[n];
+      const T b_new = left ? b[n] : c[n];
+      const T fb_new = left ? fb[n] : fc[n];
+      // Illinois weighting: when the same endpoint is replaced twice in a
+      // row, halve the residual of the stale retained endpoint
+      const bool same_side = (left && (side[n] > T(0))) ||
+                             (!left && (side[n] < T(0)));
+      a[n] = a_new;
+      b[n] = b_new;
+      fa[n] = (!left && same_side) ? T(0.5) * fa_new : fa_new;
+      fb[n] = (left && same_side) ? T(0.5) * fb_new : fb_new;
+      side[n] = left ? T(1) : T(-1);
+    }
+  }
+
+  return a + T(0.5) * (b - a);
+}
+
 } // namespace quokka::math
 
 #endif // ROOT_FINDING_HPP_
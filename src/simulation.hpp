@@ -10,15 +10,23 @@
 /// timestepping, solving, and I/O of a simulation.
 
 // c++ headers
+#include <algorithm>
+#include <cmath>
 #include <csignal>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <limits>
+#include <map>
 #include <memory>
 #include <ostream>
+#include <thread>
 #include <tuple>
+#include <type_traits>
 
 // library headers
 #include "AMReX.H"
@@ -29,19 +37,28 @@
 #include "AMReX_BCRec.H"
 #include "AMReX_BC_TYPES.H"
 #include "AMReX_BLassert.H"
+#include "AMReX_BaseFab.H"
 #include "AMReX_Config.H"
 #include "AMReX_DistributionMapping.H"
 #include "AMReX_Extension.H"
 #include "AMReX_FArrayBox.H"
+#include "AMReX_FabArray.H"
 #include "AMReX_FillPatchUtil.H"
+#include "AMReX_FillPatcher.H"
 #include "AMReX_FluxRegister.H"
+#include "AMReX_GpuBuffer.H"
+#include "AMReX_GpuContainers.H"
+#include "AMReX_GpuDevice.H"
 #include "AMReX_GpuQualifiers.H"
 #include "AMReX_INT.H"
 #include "AMReX_IndexType.H"
 #include "AMReX_IntVect.H"
 #include "AMReX_LayoutData.H"
+#include "AMReX_InterpBase.H"
+#include "AMReX_Interpolater.H"
 #include "AMReX_MFInterpolater.H"
 #include "AMReX_MultiFabUtil.H"
+#include "AMReX_Orientation.H"
 #include "AMReX_ParallelContext.H"
 #include "AMReX_ParallelDescriptor.H"
 #include "AMReX_REAL.H"
@@ -49,6 +66,7 @@
 #include "AMReX_Vector.H"
 #include "AMReX_VisMF.H"
 #include "AMReX_YAFluxRegister.H"
+#include "AMReX_iMultiFab.H"
 #include <AMReX_Geometry.H>
 #include <AMReX_MultiFab.H>
 #include <AMReX_ParmParse.H>
@@ -64,15 +82,160 @@
 
 // internal headers
 #include "CheckNaN.hpp"
+#include "ProfilerRanges.hpp"
 #include "math_impl.hpp"
 
 #define USE_YAFLUXREGISTER
 
+// flag set by the termination-signal handler (SIGTERM/SIGUSR1). a plain
+// flag assignment is all that is safe inside a signal handler; evolve()
+// polls the flag once per coarse step.
+namespace detail {
+inline volatile std::sig_atomic_t signal_received = 0; // NOLINT
+inline void signalHandler(int signum) { signal_received = signum; }
+} // namespace detail
+
+// specialized by the problem generator (defined in hyperbolic_system.hpp)
+template <typename problem_t> struct Reconstruction_Traits;
+
+namespace detail {
+// ghost width required by the problem's compile-time reconstruction bound:
+// PPM+flattening needs 4 ghost cells, PLM needs only 2, donor cell 1. read
+// via SFINAE so Reconstruction_Traits specializations that do not declare
+// max_order keep the PPM-sized default.
+template <typename problem_t, typename = void>
+struct reconstruction_ghost_width : std::integral_constant<int, 4> {};
+
+template <typename problem_t>
+struct reconstruction_ghost_width<
+    problem_t,
+    std::void_t<decltype(Reconstruction_Traits<problem_t>::max_order)>>
+    : std::integral_constant<
+          int, (Reconstruction_Traits<problem_t>::max_order >= 3)
+                   ? 4
+                   : ((Reconstruction_Traits<problem_t>::max_order == 2) ? 2
+                                                                         : 1)> {
+};
+} // namespace detail
+
 #ifdef AMREX_USE_ASCENT
 using namespace conduit;
 using namespace ascent;
 #endif
 
+namespace quokka {
+// Device-side refinement criteria for ErrorEst implementations, evaluated
+// directly on the conserved state in a single fused ParallelFor with no
+// derived-variable scratch MultiFab (see AMRSimulation::tagCellsByCriteria).
+// Each criterion is a POD functor returning true if cell (i, j, k) should be
+// tagged; problem generators can mix the canned criteria below with their own
+// device functors of the same signature.
+
+// tag cells where the relative undivided gradient of component 'comp' exceeds
+// 'eta_threshold'. when 'q_min' is set, it both floors the denominator and
+// suppresses tagging of cells with q <= q_min (low-amplitude noise).
+struct RefineGradient {
+  int comp;
+  amrex::Real eta_threshold;
+  amrex::Real q_min = 0.;
+
+  [[nodiscard]] AMREX_GPU_DEVICE auto
+  operator()(amrex::Array4<const amrex::Real> const &state, int i, int j,
+             int k) const noexcept -> bool {
+    amrex::Real const q = state(i, j, k, comp);
+
+    amrex::Real const del_x = std::max(std::abs(state(i + 1, j, k, comp) - q),
+                                       std::abs(q - state(i - 1, j, k, comp)));
+#if (AMREX_SPACEDIM >= 2)
+    amrex::Real const del_y = std::max(std::abs(state(i, j + 1, k, comp) - q),
+                                       std::abs(q - state(i, j - 1, k, comp)));
+#endif
+#if (AMREX_SPACEDIM == 3)
+    amrex::Real const del_z = std::max(std::abs(state(i, j, k + 1, comp) - q),
+                                       std::abs(q - state(i, j, k - 1, comp)));
+#endif
+    amrex::Real const del = AMREX_D_PICK(del_x, std::max(del_x, del_y),
+                                         std::max({del_x, del_y, del_z}));
+
+    amrex::Real const gradient_indicator = del / std::max(q, q_min);
+    return (gradient_indicator > eta_threshold) && (q > q_min);
+  }
+};
+
+// tag cells where the Lohner (1987) second-derivative error estimator of
+// component 'comp' exceeds 'threshold'. 'filter' damps the estimator where
+// the solution is nearly linear (ripple rejection); 0.01-0.05 is typical.
+struct RefineSecondDeriv {
+  int comp;
+  amrex::Real threshold;
+  amrex::Real filter = 0.02;
+
+  [[nodiscard]] AMREX_GPU_DEVICE auto
+  operator()(amrex::Array4<const amrex::Real> const &state, int i, int j,
+             int k) const noexcept -> bool {
+    auto estimator = [&](amrex::Real q_minus, amrex::Real q0,
+                         amrex::Real q_plus) {
+      amrex::Real const num = std::abs(q_plus - 2. * q0 + q_minus);
+      amrex::Real const denom =
+          std::abs(q_plus - q0) + std::abs(q0 - q_minus) +
+          filter * (std::abs(q_plus) + 2. * std::abs(q0) + std::abs(q_minus));
+      return num / std::max(denom, std::numeric_limits<amrex::Real>::min());
+    };
+
+    amrex::Real const err_x = estimator(
+        state(i - 1, j, k, comp), state(i, j, k, comp), state(i + 1, j, k, comp));
+#if (AMREX_SPACEDIM >= 2)
+    amrex::Real const err_y = estimator(
+        state(i, j - 1, k, comp), state(i, j, k, comp), state(i, j + 1, k, comp));
+#endif
+#if (AMREX_SPACEDIM == 3)
+    amrex::Real const err_z = estimator(
+        state(i, j, k - 1, comp), state(i, j, k, comp), state(i, j, k + 1, comp));
+#endif
+    amrex::Real const err = AMREX_D_PICK(err_x, std::max(err_x, err_y),
+                                         std::max({err_x, err_y, err_z}));
+    return err > threshold;
+  }
+};
+
+// tag cells where component 'comp' exceeds 'threshold'
+struct RefineValue {
+  int comp;
+  amrex::Real threshold;
+
+  [[nodiscard]] AMREX_GPU_DEVICE auto
+  operator()(amrex::Array4<const amrex::Real> const &state, int i, int j,
+             int k) const noexcept -> bool {
+    return state(i, j, k, comp) > threshold;
+  }
+};
+
+// tag cells whose cooling time is shorter than 'max_tcool'. 'coolingTime' is
+// a device-callable functor 't_cool(state, i, j, k)' (e.g. one evaluating the
+// Cloudy GPU tables via cloudy_tables::const_tables()).
+template <typename F> struct RefineCoolingTime {
+  F coolingTime;
+  amrex::Real max_tcool;
+
+  [[nodiscard]] AMREX_GPU_DEVICE auto
+  operator()(amrex::Array4<const amrex::Real> const &state, int i, int j,
+             int k) const noexcept -> bool {
+    return coolingTime(state, i, j, k) < max_tcool;
+  }
+};
+// per-component norms of (state - exact) on level 0, plus the norms of the
+// exact solution itself (for relative errors). filled by
+// AMRSimulation::computeErrorNorms. all norms are unweighted cell sums over
+// the valid region, like MultiFab::norm1/norm2.
+struct ErrorNorms {
+  amrex::Vector<amrex::Real> L1;     // sum |err|
+  amrex::Vector<amrex::Real> L2;     // sqrt(sum err^2)
+  amrex::Vector<amrex::Real> Linf;   // max |err|
+  amrex::Vector<amrex::Real> sol_L1; // sum |exact|
+  amrex::Vector<amrex::Real> sol_L2; // sqrt(sum exact^2)
+};
+} // namespace quokka
+
 // Main simulation class; solvers should inherit from this
 template <typename problem_t> class AMRSimulation : public amrex::AmrCore {
 public:
@@ -82,6 +245,8 @@ public:
       std::numeric_limits<double>::max(); // no limit by default
   amrex::Real constantDt_ = 0.0;
   amrex::Vector<int> istep;         // which step?
+  amrex::Vector<int> lastRegridStep_; // step at which each level was last
+                                      // regridded (sized on first use)
   amrex::Vector<int> nsubsteps;     // how many substeps on each level?
   amrex::Vector<amrex::Real> tNew_; // for state_new_
   amrex::Vector<amrex::Real> tOld_; // for state_old_
@@ -93,6 +258,33 @@ public:
   amrex::Long maxWalltime_ = 0;    // default: no limit
   int plotfileInterval_ = 10;      // -1 == no output
   int checkpointInterval_ = -1;    // -1 == no output
+  // simulation-time-based output cadence, active alongside the step-count
+  // intervals above (<= 0 == disabled; also settable from the inputs file).
+  // log spacing emits plotfiles at t_k = plotLogTimeStart_ *
+  // plotLogTimeFactor_^k, which keeps a collapse run useful without emitting
+  // thousands of dumps as dt shrinks.
+  amrex::Real plotTimeInterval_ = -1.;   // fixed simulation-time spacing
+  amrex::Real plotLogTimeFactor_ = -1.;  // multiplicative spacing factor (> 1)
+  amrex::Real plotLogTimeStart_ = -1.;   // first log-spaced output time (> 0)
+  amrex::Real checkpointTimeInterval_ = -1.;
+  // auto-tuned checkpoint cadence: re-choose checkpointInterval_ after every
+  // write so the measured write cost stays below this percentage of the
+  // measured compute time between checkpoints; the work at risk between
+  // checkpoints is then bounded at (100 / pct) times the write cost. the
+  // interval follows AMR growth, which changes both costs. 0 == fixed
+  // interval.
+  amrex::Real checkpointOverheadPct_ = 0.;
+  amrex::Real stepWalltimeEwma_ = NAN; // smoothed per-coarse-step compute time (s)
+  // event-driven plotfiles: when set by the problem driver, evaluated once
+  // per coarse step after the update; each false -> true transition forces a
+  // plotfile (e.g. a registered reduction such as the max density crossing a
+  // collapse threshold)
+  std::function<bool()> plotfileTriggerFn_;
+  int asyncCheckpoint_ = 0;        // 1 == write checkpoints from a background thread
+  int chkCoarseInterval_ = 1;      // > 1 == incremental checkpoints (see WriteCheckpointFile)
+  int checkpointStripeCount_ = 0;  // > 0 == Lustre stripe count applied to new checkpoint dirs (see ApplyCheckpointStriping)
+  int checkpointStripeSizeMB_ = 0; // > 0 == Lustre stripe size in MiB (only used with checkpointStripeCount_)
+  int asyncAscent_ = 0;            // 1 == run Ascent renders from a helper thread
 
   // constructors
 
@@ -108,6 +300,14 @@ public:
     initialize(boundaryConditions);
   }
 
+  // an asynchronous checkpoint or AsyncOut plotfile write may still be in
+  // flight when the simulation object goes out of scope; both read data
+  // owned by this object, so they must complete before it is destroyed
+  ~AMRSimulation() override {
+    FinishCheckpoint();
+    FinishAsyncPlotfile();
+  }
+
   void initialize(amrex::Vector<amrex::BCRec> &boundaryConditions);
   void PerformanceHints();
   void readParameters();
@@ -115,8 +315,29 @@ public:
   void evolve();
   void computeTimestep();
 
-  virtual void computeMaxSignalLocal(int level) = 0;
+  // cost-based load balancing
+  // (per-box cost timers are used inside MFIter loops by derived classes)
+  [[nodiscard]] auto startCostTimer() const -> amrex::Real;
+  void stopCostTimer(int lev, amrex::MFIter &mfi, amrex::Real t_start);
+  void resetLevelCosts(int lev);
+  void rebuildDistributionMaps();
+  void applyMortonBoxOrder(int lev);
+  void autotuneLevel0MaxGridSize();
+
+  // topology-aware box placement: cluster spatially adjacent boxes on the
+  // same node when ranks_per_node is set (see the definition below)
+  [[nodiscard]] auto MakeDistributionMap(int lev, amrex::BoxArray const &ba)
+      -> amrex::DistributionMapping override;
+
+  // returns the maximum signal speed on the local grids of 'level'
+  virtual auto computeMaxSignalLocal(int level) -> amrex::Real = 0;
   virtual void setInitialConditionsAtLevel(int level) = 0;
+  // device-lambda initialization helper for setInitialConditionsAtLevel
+  // implementations: runs 'f(i, j, k, state, geomData)' in a GPU kernel over
+  // every valid cell of the level and sets areInitialConditionsDefined_.
+  // any tabulated data the functor reads must live in device-accessible
+  // memory (e.g. amrex::Gpu::DeviceVector -- see Interpolate1D.hpp).
+  template <typename F> void setInitialConditionsOnDevice(int lev, F const &f);
   virtual void advanceSingleTimestepAtLevel(int lev, amrex::Real time,
                                             amrex::Real dt_lev, int iteration,
                                             int ncycle) = 0;
@@ -128,13 +349,26 @@ public:
                                  amrex::MultiFab &mf, int ncomp) const = 0;
 
   // fix-up any unphysical states created by AMR operations
-  // (e.g., caused by the flux register or from interpolation)
-  virtual void FixupState(int level) = 0;
+  // (e.g., caused by the flux register or from interpolation).
+  // when newStateOnly is true, only the valid region of the new state needs
+  // fixing (reflux and averaging do not touch the old state or ghost zones).
+  // when syncRegion is non-null, only cells inside it were modified and the
+  // scan may be restricted to it (see SyncTouchedRegion)
+  virtual void FixupState(int level, bool newStateOnly,
+                          amrex::BoxArray const *syncRegion) = 0;
 
   // tag cells for refinement
   void ErrorEst(int lev, amrex::TagBoxArray &tags, amrex::Real time,
                 int ngrow) override = 0;
 
+  // helper for ErrorEst implementations: evaluates one or more device-side
+  // criteria (quokka::RefineGradient et al., or user device functors with the
+  // same signature) in a single fused pass directly over state_new_[lev],
+  // tagging cells where any criterion fires
+  template <typename... Criteria>
+  void tagCellsByCriteria(int lev, amrex::TagBoxArray &tags,
+                          Criteria const &...criteria);
+
   // Make a new level using provided BoxArray and DistributionMapping
   void MakeNewLevelFromCoarse(int lev, amrex::Real time,
                               const amrex::BoxArray &ba,
@@ -154,8 +388,36 @@ public:
                                const amrex::DistributionMapping &dm) override;
 
   // AMR utility functions
+  // icomp/ncomp select the component range to fill (ncomp == -1 fills all
+  // components). Partial fills exchange proportionally less ghost-cell data,
+  // e.g. radiation subcycles only need the radiation components.
   void fillBoundaryConditions(amrex::MultiFab &S_filled, amrex::MultiFab &state,
-                              int lev, amrex::Real time);
+                              int lev, amrex::Real time, int icomp = 0,
+                              int ncomp = -1);
+  // split ghost-cell fill for communication/computation overlap.
+  // Begin posts the asynchronous MPI exchange (local copies and physical
+  // boundaries are filled immediately); End completes it. Multi-level fills
+  // interpolate from the coarse level and cannot be split, so on refined
+  // levels Begin performs the full blocking fill and End is a no-op.
+  void fillBoundaryConditionsBegin(amrex::MultiFab &S_filled,
+                                   amrex::MultiFab &state, int lev,
+                                   amrex::Real time);
+  void fillBoundaryConditionsEnd(amrex::MultiFab &S_filled,
+                                 amrex::MultiFab &state, int lev);
+  // single-precision ghost exchange (see float_ghost_exchange): the valid-cell
+  // shell is demoted into a float shadow FabArray, FillBoundary runs on the
+  // shadow (halving the message volume), and the received ghosts are promoted
+  // back into the double state
+  auto getFloatGhostBuffer(int lev, amrex::MultiFab const &state)
+      -> amrex::FabArray<amrex::BaseFab<float>> &;
+  void floatFillBoundaryPack(amrex::MultiFab const &state, int lev, int icomp,
+                             int ncomp);
+  void floatFillBoundaryUnpack(amrex::MultiFab &state, int lev, int icomp,
+                               int ncomp);
+  // flag the boxes whose ghost zones can be filled without MPI messages
+  // (i.e., entirely from FABs owned by this rank or the physical boundary)
+  [[nodiscard]] auto computeCommFreeBoxes(int lev) const
+      -> amrex::LayoutData<int>;
   void FillPatchWithData(int lev, amrex::Real time, amrex::MultiFab &mf,
                          amrex::Vector<amrex::MultiFab *> &coarseData,
                          amrex::Vector<amrex::Real> &coarseTime,
@@ -164,14 +426,96 @@ public:
                          int ncomp);
   void FillPatch(int lev, amrex::Real time, amrex::MultiFab &mf, int icomp,
                  int ncomp);
+  [[nodiscard]] auto getFillPatcher(amrex::MultiFab const &mf, int lev,
+                                    int icomp, int ncomp)
+      -> amrex::FillPatcher<amrex::MultiFab> *;
+  [[nodiscard]] auto getFillPatchInterpolater() const -> amrex::InterpBase *;
+  void invalidateFillPatcher(int lev);
   void FillCoarsePatch(int lev, amrex::Real time, amrex::MultiFab &mf,
                        int icomp, int ncomp);
   void GetData(int lev, amrex::Real time,
                amrex::Vector<amrex::MultiFab *> &data,
                amrex::Vector<amrex::Real> &datatime);
+  void getCoarseDataForFill(int lev, amrex::Real time,
+                            amrex::Vector<amrex::MultiFab *> &data,
+                            amrex::Vector<amrex::Real> &datatime);
   void AverageDown();
   void AverageDownTo(int crse_lev);
+  void BoundaryAverageDownTo(int crse_lev);
+  void FlushDeferredAverageDown();
+  [[nodiscard]] auto boundaryShellWidth(int crse_lev) const -> int;
+  [[nodiscard]] auto SyncTouchedRegion(int crse_lev) const -> amrex::BoxArray;
+  void checkStatesForNaNSampled(int step);
+
+  // sum every component of mf in a single pass and a single MPI reduction
+  [[nodiscard]] static auto MultiComponentSum(amrex::MultiFab const &mf)
+      -> amrex::Vector<amrex::Real>;
+
+  // device-side error-norm engine for test problems with an analytic
+  // reference: a single fused pass over the level-0 state accumulates the
+  // L1/L2/Linf error norms and the L1/L2 norms of the exact solution per
+  // component, with one vector MPI reduction per reduction op -- no
+  // reference or residual MultiFab, no host gather, and no per-cell host
+  // loop. 'exact' must be device-callable with the signature
+  //   (int i, int j, int k, int n) -> amrex::Real
+  // returning the exact value of component n at cell (i, j, k) (capture the
+  // level-0 dx / prob_lo to compute cell-center coordinates).
+  template <typename F>
+  [[nodiscard]] auto computeErrorNorms(F const &exact, int ncomp)
+      -> quokka::ErrorNorms;
+  // the same fused pass, but against a precomputed reference state (used by
+  // the computeReferenceSolution_ path of the derived classes)
+  [[nodiscard]] auto computeErrorNorms(amrex::MultiFab const &ref)
+      -> quokka::ErrorNorms;
+
+  // in-situ reduction engine: accumulate weighted histograms and phase
+  // diagrams over all uncovered cells on all levels (e.g. from
+  // computeAfterTimestep), so that time-resolved statistics do not require
+  // a high plotfile cadence. the binning functors must be device-callable
+  // with the signature
+  //   (amrex::Array4<const amrex::Real> const &state, int i, int j, int k)
+  //     -> amrex::Real
+  // and are evaluated on the conserved state of each level.
+  template <typename FX, typename FW>
+  [[nodiscard]] auto computeVolumeHistogram(int nx, amrex::Real xmin,
+                                            amrex::Real xmax, FX const &xvalue,
+                                            FW const &weight)
+      -> amrex::Vector<amrex::Real>;
+  template <typename FX, typename FY, typename FW>
+  [[nodiscard]] auto
+  computePhaseHistogram(int nx, amrex::Real xmin, amrex::Real xmax, int ny,
+                        amrex::Real ymin, amrex::Real ymax, FX const &xvalue,
+                        FY const &yvalue, FW const &weight)
+      -> amrex::Vector<amrex::Real>;
+  void appendDiagnosticSeries(std::string const &filename,
+                              amrex::Vector<amrex::Real> const &values) const;
+
+  // structured per-phase timing (enabled via the phase_timing_file option)
+  [[nodiscard]] auto phaseTimingEnabled() const -> bool {
+    return !phaseTimingFile_.empty();
+  }
+  [[nodiscard]] auto startPhaseTimer() const -> amrex::Real;
+  void stopPhaseTimer(std::string const &phase, int lev,
+                      amrex::Real t_start) const;
+  void WritePhaseTimings() const;
+
+  // host<->device transfer audit (enabled via the transfer_audit_file option)
+  [[nodiscard]] auto transferAuditEnabled() const -> bool {
+    return !transferAuditFile_.empty();
+  }
+  // global (all-rank) payload of a MultiFab, for the transfer audit
+  [[nodiscard]] static auto globalBytes(amrex::MultiFab const &mf)
+      -> amrex::Long {
+    return static_cast<amrex::Long>(mf.boxArray().numPts()) * mf.nComp() *
+           static_cast<amrex::Long>(sizeof(amrex::Real));
+  }
+  void recordTransfer(std::string const &phase, amrex::Long bytes) const;
+  void WriteTransferAudit() const;
+
   void timeStepWithSubcycling(int lev, amrex::Real time, int iteration);
+  [[nodiscard]] auto regridIsDue(int lev, amrex::Real time) -> bool;
+  [[nodiscard]] auto regridFitsInMemory(int lev, amrex::Real time) -> bool;
+  [[nodiscard]] auto getLevelStateBytes(int lev) const -> amrex::Long;
 
   void incrementFluxRegisters(
       amrex::MFIter &mfi, amrex::YAFluxRegister *fr_as_crse,
@@ -179,6 +523,18 @@ public:
       std::array<amrex::FArrayBox, AMREX_SPACEDIM> &fluxArrays, int lev,
       amrex::Real dt_lev);
 
+  // accumulate 'scale' times this box's stage fluxes into 'accum' (allocated
+  // on first use, with the flux components written at 'nstart'), so that the
+  // flux registers can be incremented once per box with the summed stage
+  // fluxes instead of once per stage. boxes away from any coarse-fine
+  // boundary are skipped entirely.
+  void accumulateFluxesForReflux(
+      amrex::MFIter &mfi, amrex::YAFluxRegister *fr_as_crse,
+      amrex::YAFluxRegister *fr_as_fine,
+      std::array<amrex::FArrayBox, AMREX_SPACEDIM> const &fluxArrays,
+      int nstart, int lev, std::array<amrex::FArrayBox, AMREX_SPACEDIM> &accum,
+      amrex::Real scale);
+
   // boundary condition
   AMREX_GPU_DEVICE static void setCustomBoundaryConditions(
       const amrex::IntVect &iv, amrex::Array4<amrex::Real> const &dest,
@@ -186,25 +542,47 @@ public:
       const amrex::BCRec *bcr, int bcomp,
       int orig_comp); // template specialized by problem generator
 
+  // batched alternative to setCustomBoundaryConditions: called on the host
+  // once per box face overlapping an ext_dir domain boundary, so the problem
+  // can launch one coalesced kernel over the whole face and hoist any
+  // time-dependent source evaluations out of the per-cell path. enabled by
+  // setting customFaceBoundaryBatch_ = 1 in the problem driver.
+  static void setCustomBoundaryConditionsFaceBatch(
+      const amrex::Box &boundaryRange, amrex::Array4<amrex::Real> const &dest,
+      int dcomp, int numcomp, amrex::GeometryData const &geom, amrex::Real time,
+      amrex::Orientation face); // template specialized by problem generator
+  void fillCustomBoundaryFaces(amrex::MultiFab &state, int icomp, int ncomp,
+                               int lev, amrex::Real time);
+
   // I/O functions
   [[nodiscard]] auto PlotFileName(int lev) const -> std::string;
-  [[nodiscard]] auto PlotFileMF() const -> amrex::Vector<amrex::MultiFab>;
+  [[nodiscard]] auto PlotFileMF(int maxLevel) const
+      -> amrex::Vector<amrex::MultiFab>;
   [[nodiscard]] auto PlotFileMFAtLevel(int lev) const -> amrex::MultiFab;
+  [[nodiscard]] auto PlotFileMFAtLevelBoxStaged(int lev) const
+      -> amrex::MultiFab;
+  [[nodiscard]] auto PlotFileComponents() const -> amrex::Vector<int>;
   void WritePlotFile(); // cannot be const due to Ascent
+  void WriteStreamingOutput();
   void WriteCheckpointFile() const;
+  void retuneCheckpointInterval(amrex::Real chkSeconds);
+  void ApplyCheckpointStriping(std::string const &checkpointname,
+                               int nlevels) const;
+  void FinishCheckpoint() const; // wait for an in-flight async checkpoint
+  void FinishAsyncPlotfile();    // wait for in-flight AsyncOut plotfile writes
   void SetLastCheckpointSymlink(std::string const &checkpointname) const;
   void ReadCheckpointFile();
   auto getWalltime() -> amrex::Real;
 #ifdef AMREX_USE_ASCENT
+  void EnsureAscentOpen(); // lazy open on the first render
   void AscentCustomRender(conduit::Node const &blueprintMesh,
                           std::string const &plotfilename);
+  void FinishAscentRender(); // wait for an in-flight async render
 #endif
 protected:
   amrex::Vector<amrex::BCRec> boundaryConditions_; // on level 0
   amrex::Vector<amrex::MultiFab> state_old_;
   amrex::Vector<amrex::MultiFab> state_new_;
-  amrex::Vector<amrex::MultiFab>
-      max_signal_speed_; // needed to compute CFL timestep
 
   // flux registers: store fluxes at coarse-fine interface for synchronization
   // this will be sized "nlevs_max+1"
@@ -214,34 +592,200 @@ protected:
   // the reflux operation
   amrex::Vector<std::unique_ptr<amrex::YAFluxRegister>> flux_reg_;
 
-  // Nghost = number of ghost cells for each array
-  int nghost_ = 4; // PPM needs nghost >= 3, PPM+flattening needs nghost >= 4
+  // Per-field ghost-width policy. Only the conserved state needs the full
+  // reconstruction stencil width; at nghost = 4 the ghost cells are the
+  // majority of a 32^3 box's footprint and all of them are exchanged in
+  // FillPatch/FillBoundary, so auxiliary fields must be allocated with the
+  // minimal width their access pattern actually requires (usually zero).
+  // conserved state: PPM+flattening needs nghost >= 4, PLM needs only 2. sized
+  // at compile time from Reconstruction_Traits<problem_t>::max_order (see
+  // detail::reconstruction_ghost_width), so PLM-only problems nearly halve
+  // their ghost memory and exchange volume
+  int nghost_ = detail::reconstruction_ghost_width<problem_t>::value;
+  static constexpr int nghostAuxStencil_ = 2; // auxiliary fields read through a +/-2 stencil (e.g. flattening coefficients)
+  static constexpr int nghostAuxMask_ = 1;    // per-box masks that need one layer of dilation via FillBoundary
+  static constexpr int nghostAuxLocal_ = 0;   // per-cell scratch with no neighbor access
   int ncomp_ = 0; // = number of components (conserved variables) for each array
   int ncompPrimitive_ = 0; // number of primitive variables
   amrex::Vector<std::string> componentNames_;
   amrex::Vector<std::string> derivedNames_;
+  amrex::Vector<std::string> plotfileVars_; // empty == write all components
   bool areInitialConditionsDefined_ = false;
 
   /// output parameters
   std::string plot_file{"plt"}; // plotfile prefix
   std::string chk_file{"chk"};  // checkpoint prefix
+  // HDF5 plotfile compression, e.g. "ZLIB@4" or "ZFP_ACCURACY@1.e-6"
+  // (ignored by the native plotfile path)
+  std::string plotfileCompression_{"None"};
+  // if nonzero, round plotfile data to float32 precision during assembly
+  int plotfileFloat32_ = 0;
+  // if >= 0, cap the finest level written to plotfiles
+  int plotfileMaxLevel_ = -1;
+  // if > 1, write a single uniformly-coarsened level-0 "preview" MultiFab
+  // (coarsened by this factor) instead of the level hierarchy
+  int plotfileCoarsen_ = 0;
+  // if nonzero, assemble the plotfile data directly in pinned host memory,
+  // one box at a time through a small device scratch buffer, instead of
+  // materializing a full device-side copy of the state plus derived fields
+  // (see PlotFileMFAtLevelBoxStaged)
+  int plotfileBoxStaging_ = 0;
+  // if non-empty, replace the per-dump plotfile directory trees with one
+  // append-only data file (plus index) per rank (see WriteStreamingOutput)
+  std::string streamingOutputFile_;
   /// input parameters (if >= 0 we restart from a checkpoint)
   std::string restart_chkfile;
 
   /// AMR-specific parameters
   int regrid_int = 2;  // regrid interval (number of coarse steps)
+  int adaptiveRegrid_ =
+      0; // 1 == skip regrids (stretching the interval, up to
+         // adaptiveRegridIntervalMax_) while the tag field is static; the
+         // interval snaps back to regrid_int as soon as tags move (see
+         // regridIsDue)
+  int adaptiveRegridIntervalMax_ = 64; // hard cap on the stretched interval
+  amrex::Real adaptiveRegridTagThreshold_ =
+      0.01; // tag-change fraction above which a regrid is forced
+  amrex::Vector<int> regridIntervalCur_; // per-level stretched interval
+  amrex::Vector<int> nextRegridStep_;    // per-level next candidate step
+  // tag bitmap captured at the last candidate step on each level
+  amrex::Vector<std::unique_ptr<amrex::iMultiFab>> regridTagSnapshot_;
+  // pre-flight regrid memory admission check (see regridFitsInMemory):
+  // 0 == disabled. when the projected post-regrid FAB footprint of the
+  // busiest rank exceeds the budget, the regrid is skipped (capping further
+  // hierarchy growth) or, with the abort flag set, the run writes a
+  // checkpoint and aborts cleanly instead of OOM-ing mid-advance.
+  amrex::Real memoryBudgetGB_ = 0.;
+  int memoryBudgetAbort_ = 0;
+  int deltaRegrid_ =
+      1; // 1 == RemakeLevel keeps boxes whose extent and owner are unchanged
+         // through a local copy (no communication) and fill-patches only the
+         // genuinely new regions; 0 == always rebuild the whole level
   int do_reflux = 1;   // 1 == reflux, 0 == no reflux
   int do_subcycle = 1; // 1 == subcycle, 0 == no subcyle
   int suppress_output =
       0; // 1 == show timestepping, 0 == do not output each timestep
+  int boundaryAverageDown_ =
+      0; // 1 == only average down coarse cells near coarse-fine boundaries at
+         // each sync; the interior covered cells are refreshed lazily before
+         // regrids and outputs (see FlushDeferredAverageDown)
+  bool averageDownDeferred_ = false; // interior covered cells are stale
+  int boundarySyncFixup_ =
+      1; // 1 == restrict the post-sync fixup scan to the coarse cells the
+         // reflux/average-down actually modified (a band around each
+         // coarse-fine boundary); 0 == scan the whole level
+  int nanCheckStride_ =
+      0; // > 0 == runtime NaN validation: every box is checked once every
+         // nanCheckStride_ coarse steps (1 == every box every step). works in
+         // Release builds, unlike the AMREX_ASSERT contains_nan checks.
+  int customFaceBoundaryBatch_ =
+      0; // 1 == the problem implements setCustomBoundaryConditionsFaceBatch
+         // (per-face kernels) instead of the per-cell
+         // setCustomBoundaryConditions functor
+  std::string fillPatchInterp_{
+      "cell_cons"}; // coarse->fine interpolation: "cell_cons" (conservative
+                    // linear), "quartic", or "pc" (piecewise constant, for
+                    // problems with sharp fields that linear interpolation
+                    // would over/undershoot); see getFillPatchInterpolater
 
   // performance metrics
   amrex::Long cellUpdates_ = 0;
   amrex::Vector<amrex::Long> cellUpdatesEachLevel_;
 
+  // load balancing
+  // (boxes are re-distributed according to the measured per-box update time,
+  // accumulated in costs_ by the startCostTimer()/stopCostTimer() pair)
+  int loadBalanceInterval_ = 0;          // 0 == use cell-count balancing only
+  std::string loadBalanceMethod_{"sfc"}; // "sfc" or "knapsack"
+  int ranksPerNode_ = 0;                 // > 0 == node-aware box placement
+  int mortonOrder_ = 0; // 1 == keep each level's box list in Morton order
+  int autotuneMaxGridSize_ =
+      0; // 1 == time a few trial advances of level 0 under candidate
+         // max_grid_size values at startup and keep the fastest (see
+         // autotuneLevel0MaxGridSize)
+  amrex::Vector<std::unique_ptr<amrex::LayoutData<amrex::Real>>> costs_;
+
+  // single-precision ghost exchange
+  int floatGhostExchange_ = 0; // 1 == transmit same-level ghost cells as
+                               // float32 (halves the exchange volume; ghost
+                               // data carries ~7 significant digits)
+  // per-level float shadow arrays for the demoted exchange, allocated lazily
+  // and rebuilt whenever the level's layout changes
+  amrex::Vector<std::unique_ptr<amrex::FabArray<amrex::BaseFab<float>>>>
+      floatGhostBuffer_;
+
+  // an asynchronous checkpoint's file writes are still queued on the
+  // AsyncOut background thread (see WriteCheckpointFile)
+  mutable bool asyncCheckpointInFlight_ = false;
+
+  // walltime the compute ranks spent stalled in the synchronous portion of
+  // output writes (staging + any non-offloaded VisMF/HDF5 work); used to
+  // report an I/O-excluded figure-of-merit at the end of evolve(), so steps
+  // overlapped with background writes are not miscounted
+  mutable amrex::Real outputStallSeconds_ = 0.;
+
+  // incremental checkpoint bookkeeping: the checkpoint directory that holds
+  // each level's most recently written data, and the BoxArray it was written
+  // with (a changed BoxArray forces a rewrite)
+  mutable int checkpointCount_ = 0;
+  mutable amrex::Vector<std::string> chkLevelLocation_;
+  mutable amrex::Vector<amrex::BoxArray> chkLevelBoxArray_;
+
+  // staging data for an in-flight AsyncOut plotfile write (the plotfile
+  // MultiFabs must outlive WritePlotFile; see comments there)
+  amrex::Vector<amrex::MultiFab> plotMFStaging_;
+
+  // cached fill-patch communication patterns, keyed on level (see
+  // getFillPatcher); rebuilt lazily after each regrid
+  amrex::Vector<std::unique_ptr<amrex::FillPatcher<amrex::MultiFab>>>
+      fillPatcher_;
+
+  // cached time-interpolated coarse data, keyed on the coarse level (see
+  // getCoarseDataForFill): each fine subcycle time point is filled several
+  // times (once per RK stage and again per radiation substep), and the linear
+  // time interpolation of the coarse states is identical for all of them
+  int cacheCoarseTimeInterp_ = 1; // 0 == re-interpolate inside every fill
+  amrex::Vector<amrex::MultiFab> coarseInterpData_;
+  amrex::Vector<amrex::Real> coarseInterpTime_; // fine time it holds (NaN == invalid)
+  amrex::Vector<std::pair<amrex::Real, amrex::Real>>
+      coarseInterpStateTimes_; // (tOld_, tNew_) of the coarse level when built
+
+  // structured phase timing: accumulated (call count, total seconds) per
+  // (phase name, level); level -1 is used for phases that span all levels
+  std::string phaseTimingFile_; // empty == disabled
+  mutable std::map<std::pair<std::string, int>,
+                   std::pair<amrex::Long, amrex::Real>>
+      phaseTimings_;
+
+  // host<->device transfer audit: accumulated (copy count, total bytes) per
+  // instrumented staging copy. the instrumented copies are collective and
+  // recorded with their global (all-rank) volume, so every rank holds
+  // identical totals. transfers made internally by AMReX (e.g. inside the
+  // communication layer) are not visible here and are not counted.
+  std::string transferAuditFile_; // empty == disabled
+  mutable std::map<std::string, std::pair<amrex::Long, amrex::Long>>
+      transferBytes_;
+
+  // startup timing (see the report printed by setInitialConditions)
+  amrex::Real startupInitializeTime_ = 0.;
+
   // external objects
 #ifdef AMREX_USE_ASCENT
   Ascent ascent_;
+  bool ascentOpened_ = false; // Ascent is opened lazily on the first render
+#ifdef AMREX_USE_MPI
+  // Ascent's private communicator, duplicated from the simulation's at open.
+  // the async render helper thread communicates on it concurrently with the
+  // main loop, so Ascent's traffic must not share the simulation
+  // communicator's message-tag sequence
+  MPI_Comm ascentComm_ = MPI_COMM_NULL;
+#endif
+  // in-flight asynchronous render (see WritePlotFile): the helper thread
+  // renders from the host staging copies wrapped by ascentMesh_, which must
+  // stay alive until the render is joined
+  std::thread ascentThread_;
+  amrex::Vector<amrex::MultiFab> ascentStaging_;
+  conduit::Node ascentMesh_;
 #endif
 };
 
@@ -250,8 +794,17 @@ void AMRSimulation<problem_t>::initialize(
     amrex::Vector<amrex::BCRec> &boundaryConditions) {
   BL_PROFILE("AMRSimulation::initialize()");
 
+  const amrex::Real start_time = amrex::second();
+
   readParameters();
 
+  // checkpoint-and-exit when the batch system sends SIGTERM (queue kill)
+  // or SIGUSR1 (commonly sent shortly before the walltime limit)
+  std::signal(SIGTERM, detail::signalHandler);
+#if !defined(_WIN32)
+  std::signal(SIGUSR1, detail::signalHandler);
+#endif
+
   // print derived vars
   if (!derivedNames_.empty()) {
     amrex::Print() << "Using derived variables:\n";
@@ -275,9 +828,16 @@ void AMRSimulation<problem_t>::initialize(
   dt_.resize(nlevs_max, 1.e100);
   state_new_.resize(nlevs_max);
   state_old_.resize(nlevs_max);
-  max_signal_speed_.resize(nlevs_max);
   flux_reg_.resize(nlevs_max + 1);
   cellUpdatesEachLevel_.resize(nlevs_max, 0);
+  costs_.resize(nlevs_max);
+  fillPatcher_.resize(nlevs_max);
+  coarseInterpData_.resize(nlevs_max);
+  coarseInterpTime_.resize(nlevs_max, NAN);
+  coarseInterpStateTimes_.resize(nlevs_max, {NAN, NAN});
+  regridIntervalCur_.resize(nlevs_max, regrid_int);
+  nextRegridStep_.resize(nlevs_max, 0);
+  regridTagSnapshot_.resize(nlevs_max);
 
   boundaryConditions_ = boundaryConditions;
 
@@ -302,13 +862,11 @@ void AMRSimulation<problem_t>::initialize(
     }
   }
 
-#ifdef AMREX_USE_ASCENT
-  // initialize Ascent
-  conduit::Node ascent_options;
-  ascent_options["mpi_comm"] =
-      MPI_Comm_c2f(amrex::ParallelContext::CommunicatorSub());
-  ascent_.open(ascent_options);
-#endif
+  // (Ascent is opened lazily on the first in-situ render -- see
+  // EnsureAscentOpen -- so short debugging runs do not pay its startup
+  // cost)
+
+  startupInitializeTime_ = amrex::second() - start_time;
 }
 
 template <typename problem_t>
@@ -390,12 +948,176 @@ template <typename problem_t> void AMRSimulation<problem_t>::readParameters() {
   // file
   pp.query("restartfile", restart_chkfile);
 
+  // overlap checkpoint file writes with the time loop by routing them
+  // through the AsyncOut background thread (requires amrex.async_out=1 for
+  // actual overlap; without it the writes complete synchronously)
+  pp.query("async_checkpoint", asyncCheckpoint_);
+
+  // incremental checkpoints: rewrite coarse levels only every N-th
+  // checkpoint (N == this value) and reference the previous dump for them
+  // in between; the finest level is always written. see WriteCheckpointFile
+  pp.query("checkpoint_coarse_interval", chkCoarseInterval_);
+
+  // Lustre striping applied to newly-created checkpoint directories
+  // (0 == leave the filesystem default; see ApplyCheckpointStriping)
+  pp.query("checkpoint_stripe_count", checkpointStripeCount_);
+  pp.query("checkpoint_stripe_size_mb", checkpointStripeSizeMB_);
+
+  // number of binary files written per level by VisMF (applies to both
+  // checkpoints and plotfiles): fewer, larger files reduce the per-dump
+  // metadata load on parallel filesystems at wide rank counts
+  int nOutFiles = 0;
+  pp.query("vismf_nfiles", nOutFiles);
+  if (nOutFiles > 0) {
+    amrex::VisMF::SetNOutFiles(nOutFiles);
+  }
+
+  // writer-rank I/O offload: funnel all VisMF data to this many writer
+  // ranks per node (requires ranks_per_node; 0 == disabled). the non-writer
+  // ranks only send their staged boxes to their set's writer, which -- in
+  // combination with async_checkpoint / amrex.async_out moving the writes
+  // off the compute thread -- lets the rest of the job continue evolve()
+  // while the writers drain to the filesystem. overrides vismf_nfiles.
+  int writersPerNode = 0;
+  pp.query("io_writers_per_node", writersPerNode);
+  if (writersPerNode > 0) {
+    pp.query("ranks_per_node", ranksPerNode_); // also read further below
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
+        ranksPerNode_ > 0,
+        "io_writers_per_node requires ranks_per_node to be set");
+    const int nnodes = std::max(
+        1, amrex::ParallelDescriptor::NProcs() / ranksPerNode_);
+    amrex::VisMF::SetNOutFiles(nnodes * writersPerNode);
+  }
+
+  // run Ascent in-situ renders from a helper thread so the raytrace
+  // overlaps the next simulation steps. the render pipeline issues MPI
+  // collectives from that thread while the main loop keeps communicating,
+  // so the MPI library must actually provide MPI_THREAD_MULTIPLE.
+  pp.query("async_ascent", asyncAscent_);
+#if defined(AMREX_USE_MPI) && defined(AMREX_USE_ASCENT)
+  if (asyncAscent_ != 0) {
+    int mpi_thread_level = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&mpi_thread_level);
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
+        mpi_thread_level >= MPI_THREAD_MULTIPLE,
+        "async_ascent requires MPI_THREAD_MULTIPLE (build AMReX with "
+        "AMReX_MPI_THREAD_MULTIPLE=ON)");
+  }
+#endif
+
   // Specify derived variables to save to plotfiles
   pp.queryarr("derived_vars", derivedNames_);
 
+  // Specify the subset of state components to save to plotfiles
+  // (empty == write all components)
+  pp.queryarr("plotfile_vars", plotfileVars_);
+
+  // HDF5 plotfile compression filter, "<FILTER>@<arg>" (e.g. "ZLIB@4",
+  // "ZFP_ACCURACY@1.e-6"; the filter must be enabled in the AMReX build).
+  // smooth fields compress 5-10x. datasets are chunked per box by the HDF5
+  // writer, so ranks compress their own chunks independently and parallel
+  // writes do not serialize on the filter pipeline.
+  pp.query("plotfile_compression", plotfileCompression_);
+
+  // round plotfile data to float32 precision while assembling the plot
+  // MultiFab. visualization and most post-processing need at most float32,
+  // and discarding the low mantissa bits lets plotfile_compression reach
+  // the full factor-of-two (or better) size reduction.
+  pp.query("plotfile_float32", plotfileFloat32_);
+
+  // lightweight monitoring outputs: cap the finest level written (>= 0), or
+  // write a single uniformly-coarsened preview of level 0 (factor > 1). a
+  // 2048^3 effective-resolution run monitored at 256^3 makes high-cadence
+  // dumps ~100x cheaper than full ones.
+  pp.query("plotfile_max_level", plotfileMaxLevel_);
+  pp.query("plotfile_coarsen", plotfileCoarsen_);
+
+  // assemble plotfile data in pinned host memory one box at a time, bounding
+  // the device-side transient to a single box plus one derived component
+  // (instead of a full copy of the state and derived fields)
+  pp.query("plotfile_box_staging", plotfileBoxStaging_);
+
+  // simulation-time-based output cadence, active alongside the step-count
+  // intervals (see the output scheduling in evolve)
+  pp.query("plottime_interval", plotTimeInterval_);
+  pp.query("plottime_log_factor", plotLogTimeFactor_);
+  pp.query("plottime_log_start", plotLogTimeStart_);
+  pp.query("checkpointtime_interval", checkpointTimeInterval_);
+
+  // auto-tuned checkpoint cadence (the percentage of compute time allowed to
+  // go to checkpoint I/O; 0 == keep the fixed step interval)
+  pp.query("checkpoint_overhead_percent", checkpointOverheadPct_);
+  if (checkpointOverheadPct_ > 0. && checkpointInterval_ <= 0) {
+    checkpointInterval_ = 10; // bootstrap; re-tuned after the first write
+  }
+
+  // streaming output engine: append every dump to a single data file (plus
+  // step index) per rank instead of creating a plotfile directory tree, so
+  // high-cadence output becomes sequential appends without per-dump
+  // metadata operations (see WriteStreamingOutput)
+  pp.query("streaming_output_file", streamingOutputFile_);
+
+  // Write per-phase, per-level timings to this file at the end of the run
+  // (".json" extension selects JSON output, anything else writes CSV)
+  pp.query("phase_timing_file", phaseTimingFile_);
+
+  // Write the host<->device transfer audit to this file at the end of the
+  // run (".json" extension selects JSON output, anything else writes CSV)
+  pp.query("transfer_audit_file", transferAuditFile_);
+
   // re-grid interval
   pp.query("regrid_interval", regrid_int);
 
+  // adaptive regrid interval (1 == skip regrids while the tag field is
+  // static, stretching the interval up to adaptive_regrid_interval_max)
+  pp.query("adaptive_regrid", adaptiveRegrid_);
+  pp.query("adaptive_regrid_interval_max", adaptiveRegridIntervalMax_);
+  pp.query("adaptive_regrid_tag_threshold", adaptiveRegridTagThreshold_);
+
+  // pre-flight regrid memory admission check (GiB of FAB allocations per
+  // rank; 0 == disabled)
+  pp.query("regrid_memory_budget_gb", memoryBudgetGB_);
+  pp.query("regrid_memory_budget_abort", memoryBudgetAbort_);
+
+  // intersection-aware level remake (see RemakeLevel)
+  pp.query("delta_regrid", deltaRegrid_);
+
+  // restrict the per-sync average-down to the coarse-fine boundary region
+  // (1 == enabled; the full average-down is deferred to regrid/output events)
+  pp.query("boundary_average_down", boundaryAverageDown_);
+
+  // restrict the post-sync fixup scan to the cells the sync actually modified
+  pp.query("boundary_sync_fixup", boundarySyncFixup_);
+
+  // sampled runtime NaN validation stride (0 == disabled; N == each box is
+  // checked once every N coarse steps, so N ~ 100 costs of order 1%)
+  pp.query("nan_check_stride", nanCheckStride_);
+
+  // cost-based load balance interval (0 == disabled)
+  pp.query("load_balance_interval", loadBalanceInterval_);
+
+  // load balance method ("sfc" or "knapsack")
+  pp.query("load_balance_method", loadBalanceMethod_);
+
+  // ranks per node, for topology-aware box placement (0 == disabled; set it
+  // to the MPI ranks-per-node value of the job script)
+  pp.query("ranks_per_node", ranksPerNode_);
+
+  // time candidate level-0 grid decompositions at startup (0 == disabled)
+  pp.query("autotune_max_grid_size", autotuneMaxGridSize_);
+
+  // keep each level's box list sorted along a Morton curve (improves cache
+  // locality of the box-by-box sweeps on many-core CPU nodes)
+  pp.query("morton_order", mortonOrder_);
+
+  // transmit same-level ghost cells in single precision (1 == enabled; the
+  // coarse-fine FillPatch interpolation path is unaffected and remains double)
+  pp.query("float_ghost_exchange", floatGhostExchange_);
+
+  // coarse->fine interpolation method ("cell_cons", "quartic", or "pc")
+  pp.query("fill_patch_interp", fillPatchInterp_);
+
   // specify maximum walltime in HH:MM:SS format
   std::string maxWalltimeInput;
   pp.query("max_walltime", maxWalltimeInput);
@@ -417,50 +1139,133 @@ template <typename problem_t>
 void AMRSimulation<problem_t>::setInitialConditions() {
   BL_PROFILE("AMRSimulation::setInitialConditions()");
 
+  // time each startup phase so slow cold starts can be diagnosed (the
+  // resulting report is printed below, next to PerformanceHints)
+  amrex::Real grid_time = 0.;
+  amrex::Real output_time = 0.;
+  amrex::Real t0 = amrex::second();
+
   if (restart_chkfile.empty()) {
     // start simulation from the beginning
     const amrex::Real time = 0.0;
     InitFromScratch(time);
     AverageDown();
+    grid_time = amrex::second() - t0;
 
     if (checkpointInterval_ > 0) {
+      t0 = amrex::second();
       WriteCheckpointFile();
+      output_time += amrex::second() - t0;
     }
   } else {
     // restart from a checkpoint
     ReadCheckpointFile();
+    grid_time = amrex::second() - t0;
   }
 
-  // abort if amrex.async_out=1, it is currently broken
-  if (amrex::AsyncOut::UseAsyncOut()) {
-    amrex::Print()
-        << "[ERROR] [FATAL] AsyncOut is currently broken! If you want to "
-           "run with AsyncOut anyway (THIS MAY CAUSE DATA CORRUPTION), comment "
-           "out this line in src/simulation.hpp. Aborting."
-        << std::endl;
-    amrex::Abort();
+  // establish the Morton iteration order before the first step (coarse to
+  // fine, so each flux register sees its final coarse layout)
+  if (mortonOrder_ != 0) {
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      applyMortonBoxOrder(lev);
+    }
   }
 
   if (plotfileInterval_ > 0) {
+    t0 = amrex::second();
     WritePlotFile();
+    output_time += amrex::second() - t0;
   }
 
   // ensure that there are enough boxes per MPI rank
   PerformanceHints();
+
+  // print the startup timing report (maximum over ranks, so rank-dependent
+  // costs such as table I/O and grid generation show up)
+  amrex::Real phases[3] = {startupInitializeTime_, grid_time, output_time};
+  amrex::ParallelDescriptor::ReduceRealMax(
+      phases, 3, amrex::ParallelDescriptor::IOProcessorNumber());
+  amrex::Print() << "Startup phase timing (max over ranks):\n"
+                 << "  parameter read + AMR setup: " << phases[0] << " s\n"
+                 << (restart_chkfile.empty()
+                         ? "  grid generation + problem init: "
+                         : "  checkpoint read: ")
+                 << phases[1] << " s\n"
+                 << "  initial checkpoint/plotfile writes: " << phases[2]
+                 << " s\n"
+                 << "  total time-to-first-step: "
+                 << (phases[0] + phases[1] + phases[2]) << " s\n\n";
+}
+
+template <typename problem_t>
+template <typename F>
+void AMRSimulation<problem_t>::setInitialConditionsOnDevice(int const lev,
+                                                            F const &f) {
+  BL_PROFILE("AMRSimulation::setInitialConditionsOnDevice()");
+
+  // capture the level geometry by value so the functor can compute
+  // cell-center coordinates from geomData.CellSize()/geomData.ProbLo()
+  amrex::GeometryData const geomData = geom[lev].data();
+
+  for (amrex::MFIter iter(state_new_[lev]); iter.isValid(); ++iter) {
+    const amrex::Box &indexRange = iter.validbox();
+    auto const &state = state_new_[lev].array(iter);
+
+    amrex::ParallelFor(indexRange, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+      f(i, j, k, state, geomData);
+    });
+  }
+
+  // the functor may read transient device tables owned by the caller, so do
+  // not return until the kernels have drained
+  amrex::Gpu::streamSynchronize();
+
+  // set flag
+  areInitialConditionsDefined_ = true;
+}
+
+template <typename problem_t>
+template <typename... Criteria>
+void AMRSimulation<problem_t>::tagCellsByCriteria(int lev,
+                                                  amrex::TagBoxArray &tags,
+                                                  Criteria const &...criteria) {
+  BL_PROFILE("AMRSimulation::tagCellsByCriteria()");
+
+  for (amrex::MFIter mfi(state_new_[lev]); mfi.isValid(); ++mfi) {
+    const amrex::Box &box = mfi.validbox();
+    const auto state = state_new_[lev].const_array(mfi);
+    const auto tag = tags.array(mfi);
+
+    amrex::ParallelFor(box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+      if ((criteria(state, i, j, k) || ...)) {
+        tag(i, j, k) = amrex::TagBox::SET;
+      }
+    });
+  }
 }
 
 template <typename problem_t> void AMRSimulation<problem_t>::computeTimestep() {
   BL_PROFILE("AMRSimulation::computeTimestep()");
+  const amrex::Real phase_start = startPhaseTimer();
+
+  // each rank reduces its local grids to a scalar per level on the fly;
+  // the per-level maxima are then combined in a single vector all-reduce,
+  // which also provides all of the synchronization the main loop needs
+  // (no standalone barrier is required before this)
+  amrex::Vector<amrex::Real> signal_max(finest_level + 1);
+  for (int level = 0; level <= finest_level; ++level) {
+    signal_max[level] = computeMaxSignalLocal(level);
+  }
+  amrex::ParallelDescriptor::ReduceRealMax(signal_max.data(),
+                                           finest_level + 1);
 
   amrex::Vector<amrex::Real> dt_tmp(finest_level + 1);
   for (int level = 0; level <= finest_level; ++level) {
-    computeMaxSignalLocal(level);
-    amrex::Real domain_signal_max = max_signal_speed_[level].norminf();
     amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &dx =
         geom[level].CellSizeArray();
 
     amrex::Real dx_min = std::min({AMREX_D_DECL(dx[0], dx[1], dx[2])});
-    dt_tmp[level] = cflNumber_ * (dx_min / domain_signal_max);
+    dt_tmp[level] = cflNumber_ * (dx_min / signal_max[level]);
   }
 
   constexpr amrex::Real change_max = 1.1;
@@ -492,6 +1297,294 @@ template <typename problem_t> void AMRSimulation<problem_t>::computeTimestep() {
   for (int level = 1; level <= finest_level; ++level) {
     dt_[level] = dt_[level - 1] / nsubsteps[level];
   }
+
+  stopPhaseTimer("computeTimestep", -1, phase_start);
+}
+
+// start a per-box cost timer. the kernels previously launched on the stream
+// must not be attributed to this box, so we synchronize first.
+template <typename problem_t>
+auto AMRSimulation<problem_t>::startCostTimer() const -> amrex::Real {
+  if (loadBalanceInterval_ <= 0) {
+    return 0.; // cost timing disabled
+  }
+  amrex::Gpu::streamSynchronize();
+  return amrex::second();
+}
+
+// accumulate the elapsed time for this box into costs_[lev]
+template <typename problem_t>
+void AMRSimulation<problem_t>::stopCostTimer(int lev, amrex::MFIter &mfi,
+                                             amrex::Real const t_start) {
+  if (loadBalanceInterval_ <= 0) {
+    return;
+  }
+  amrex::Gpu::streamSynchronize();
+  (*costs_[lev])[mfi] += amrex::second() - t_start;
+}
+
+// (re-)allocate the per-box cost counters for level 'lev' using the current
+// BoxArray and DistributionMapping, and reset them to zero
+template <typename problem_t>
+void AMRSimulation<problem_t>::resetLevelCosts(int lev) {
+  costs_[lev] = std::make_unique<amrex::LayoutData<amrex::Real>>(
+      boxArray(lev), DistributionMap(lev));
+  for (amrex::MFIter mfi(*costs_[lev]); mfi.isValid(); ++mfi) {
+    (*costs_[lev])[mfi] = 0.;
+  }
+}
+
+// re-distribute boxes on each level according to the measured per-box costs
+// (using either a space-filling curve or the knapsack algorithm)
+// build the DistributionMapping for new grids. when ranks_per_node is set,
+// the space-filling-curve ordering is dealt out hierarchically: the curve is
+// first split into one contiguous (and therefore spatially compact) segment
+// per node, and each node's segment is then split into contiguous chunks
+// over the node's local ranks. most ghost-zone exchanges then stay inside a
+// node (shared memory) instead of crossing the network. AMReX's FillBoundary
+// already packs all per-neighbor ghost messages into a single buffer per
+// destination rank, so fewer off-node neighbors translates directly into
+// fewer, larger network messages.
+template <typename problem_t>
+auto AMRSimulation<problem_t>::MakeDistributionMap(int lev,
+                                                   amrex::BoxArray const &ba)
+    -> amrex::DistributionMapping {
+  const int nprocs = amrex::ParallelDescriptor::NProcs();
+  if (ranksPerNode_ <= 1 || nprocs <= ranksPerNode_ ||
+      nprocs % ranksPerNode_ != 0) {
+    return amrex::AmrMesh::MakeDistributionMap(lev, ba);
+  }
+
+  const int nnodes = nprocs / ranksPerNode_;
+  auto const nodeLists =
+      amrex::DistributionMapping::makeSFC(ba, /*use_box_vol*/ true, nnodes);
+
+  amrex::Vector<int> pmap(static_cast<int>(ba.size()));
+  for (int node = 0; node < nnodes; ++node) {
+    // each node's boxes arrive in SFC order; deal them out in contiguous
+    // chunks so spatial adjacency survives at the rank level as well
+    auto const &boxes = nodeLists[node];
+    const int nlocal = static_cast<int>(boxes.size());
+    for (int m = 0; m < nlocal; ++m) {
+      const int localRank = (m * ranksPerNode_) / std::max(nlocal, 1);
+      pmap[boxes[m]] = node * ranksPerNode_ + localRank;
+    }
+  }
+  return amrex::DistributionMapping(std::move(pmap));
+}
+
+template <typename problem_t>
+void AMRSimulation<problem_t>::rebuildDistributionMaps() {
+  BL_PROFILE("AMRSimulation::rebuildDistributionMaps()");
+
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    amrex::Real currentEfficiency = NAN;
+    amrex::Real proposedEfficiency = NAN;
+    amrex::DistributionMapping newdm;
+
+    if (loadBalanceMethod_ == "knapsack") {
+      newdm = amrex::DistributionMapping::makeKnapSack(
+          *costs_[lev], currentEfficiency, proposedEfficiency);
+    } else if (loadBalanceMethod_ == "sfc") {
+      newdm = amrex::DistributionMapping::makeSFC(
+          *costs_[lev], currentEfficiency, proposedEfficiency);
+    } else {
+      amrex::Abort("Invalid load_balance_method specified!");
+    }
+
+    if (Verbose()) {
+      amrex::Print() << "[LoadBalance] level " << lev << ": efficiency "
+                     << currentEfficiency << " -> " << proposedEfficiency
+                     << "\n";
+    }
+
+    // only pay the cost of moving FABs if the new map is actually better
+    if (proposedEfficiency > currentEfficiency) {
+      SetDistributionMap(lev, newdm);
+      RemakeLevel(lev, tNew_[lev], boxArray(lev), newdm);
+    }
+
+    // reset measured costs for the next load balance interval
+    resetLevelCosts(lev);
+  }
+}
+
+// re-sort level 'lev''s global box list along a Morton (Z-order) curve,
+// keeping every box on its current rank. MFIter visits a rank's local boxes
+// in global-index order, and the lexicographic order produced by gridding
+// places consecutive local boxes far apart in space -- so the sweep working
+// sets (ghost zones shared between neighboring boxes) thrash the last-level
+// cache on many-core nodes. after the permutation, successive boxes are
+// spatial neighbors and their shared faces are usually still resident.
+// the level data are moved into the new layout through RemakeLevel, exactly
+// like a load-balance rebuild (all copies are rank-local since ownership is
+// unchanged).
+template <typename problem_t>
+void AMRSimulation<problem_t>::applyMortonBoxOrder(int lev) {
+  BL_PROFILE("AMRSimulation::applyMortonBoxOrder()");
+
+  amrex::BoxArray const &ba = boxArray(lev);
+  const auto nboxes = static_cast<int>(ba.size());
+  amrex::Vector<int> const &pmap = DistributionMap(lev).ProcessorMap();
+
+  // Morton key of each box's lower corner: interleave 21 bits per dimension
+  // into one 64-bit integer (box corners are non-negative cell indices)
+  amrex::Vector<std::uint64_t> keys(nboxes);
+  amrex::Vector<int> order(nboxes);
+  amrex::IntVect const domain_lo = Geom(lev).Domain().smallEnd();
+  for (int ibox = 0; ibox < nboxes; ++ibox) {
+    amrex::IntVect const lo = ba[ibox].smallEnd() - domain_lo;
+    std::uint64_t key = 0;
+    for (int bit = 0; bit < 21; ++bit) {
+      for (int dim = 0; dim < AMREX_SPACEDIM; ++dim) {
+        key |= ((static_cast<std::uint64_t>(lo[dim]) >> bit) & 1ULL)
+               << (AMREX_SPACEDIM * bit + dim);
+      }
+    }
+    keys[ibox] = key;
+    order[ibox] = ibox;
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&keys](int a, int b) { return keys[a] < keys[b]; });
+
+  bool isIdentity = true;
+  for (int ibox = 0; ibox < nboxes; ++ibox) {
+    if (order[ibox] != ibox) {
+      isIdentity = false;
+      break;
+    }
+  }
+  if (isIdentity) {
+    return; // already in Morton order; nothing to move
+  }
+
+  // permute the box list and the processor map identically, so only the
+  // global indices (and hence the local iteration order) change
+  amrex::BoxList sorted_bl;
+  amrex::Vector<int> sorted_pmap(nboxes);
+  for (int ibox = 0; ibox < nboxes; ++ibox) {
+    sorted_bl.push_back(ba[order[ibox]]);
+    sorted_pmap[ibox] = pmap[order[ibox]];
+  }
+  amrex::BoxArray const sorted_ba(std::move(sorted_bl));
+  amrex::DistributionMapping const sorted_dm(std::move(sorted_pmap));
+
+  SetBoxArray(lev, sorted_ba);
+  SetDistributionMap(lev, sorted_dm);
+  RemakeLevel(lev, tNew_[lev], sorted_ba, sorted_dm);
+
+  // the register between lev and lev+1 caches lev's layout on its coarse
+  // side; rebuild it against the permuted box list (register contents are
+  // dead between coarse steps, so nothing needs to be copied)
+  if (lev < finestLevel() && (do_reflux != 0) &&
+      flux_reg_[lev + 1] != nullptr) {
+    flux_reg_[lev + 1] = std::make_unique<amrex::YAFluxRegister>(
+        boxArray(lev + 1), sorted_ba, DistributionMap(lev + 1), sorted_dm,
+        Geom(lev + 1), Geom(lev), refRatio(lev), lev + 1,
+        state_new_[lev].nComp());
+  }
+}
+
+// time a few single-step advances of level 0 under candidate grid
+// decompositions and commit the fastest one before the run starts in
+// earnest. blocking_factor/max_grid_size swing GPU throughput by >2x
+// between machines, and PerformanceHints can only warn about obviously bad
+// values -- the actual optimum depends on the device, the interconnect, and
+// the problem's kernel mix, so measure it. all trial advances are made on a
+// copy-restored state, so the production run is bitwise independent of the
+// tuning. only the base-level decomposition is tuned: refined levels are
+// rebuilt continuously by the regridder and their box sizes are dominated
+// by the tagged regions rather than by max_grid_size.
+template <typename problem_t>
+void AMRSimulation<problem_t>::autotuneLevel0MaxGridSize() {
+  BL_PROFILE("AMRSimulation::autotuneLevel0MaxGridSize()");
+
+  // candidate values, mirroring the PerformanceHints recommendations for the
+  // build target, plus the user's current setting
+#ifdef AMREX_USE_GPU
+  amrex::Vector<int> candidates{64, 128, 256};
+#else
+  amrex::Vector<int> candidates{32, 64, 128};
+#endif
+  const int current = max_grid_size[0].min();
+  if (std::find(candidates.begin(), candidates.end(), current) ==
+      candidates.end()) {
+    candidates.push_back(current);
+  }
+
+  // preserve the pre-trial state: every candidate is timed on the same data,
+  // and the winner restarts from it exactly
+  amrex::MultiFab origState(boxArray(0), DistributionMap(0), ncomp_, nghost_);
+  amrex::MultiFab::Copy(origState, state_new_[0], 0, 0, ncomp_, nghost_);
+
+  computeTimestep(); // the trial advances need a CFL-valid dt_[0]
+
+  // rebuild level 0 under a given max_grid_size through the standard
+  // gridding path, then restore the pre-trial data. the flux register and
+  // fill patcher between levels 0 and 1 cache level 0's layout on their
+  // coarse side and must follow it (see applyMortonBoxOrder).
+  auto relayout = [this, &origState](int msize) -> amrex::BoxArray {
+    max_grid_size[0] = amrex::IntVect(msize);
+    const amrex::BoxArray ba = MakeBaseGrids();
+    const amrex::DistributionMapping dm(ba);
+    SetBoxArray(0, ba);
+    SetDistributionMap(0, dm);
+    RemakeLevel(0, tNew_[0], ba, dm);
+    state_new_[0].ParallelCopy(origState, 0, 0, ncomp_, nghost_, nghost_);
+    if (finestLevel() > 0 && (do_reflux != 0) && flux_reg_[1] != nullptr) {
+      flux_reg_[1] = std::make_unique<amrex::YAFluxRegister>(
+          boxArray(1), ba, DistributionMap(1), dm, Geom(1), Geom(0),
+          refRatio(0), 1, state_new_[0].nComp());
+    }
+    if (finestLevel() > 0) {
+      fillPatcher_[1].reset();
+    }
+    return ba;
+  };
+
+  const int bf = blocking_factor[0].max();
+  constexpr int warmupSteps = 1; // warms comm patterns and the arena pools
+  constexpr int timedSteps = 2;
+
+  int bestCandidate = current;
+  amrex::Real bestTime = std::numeric_limits<amrex::Real>::max();
+
+  for (const int candidate : candidates) {
+    if (candidate < bf || candidate % bf != 0) {
+      continue; // incompatible with the blocking factor
+    }
+
+    const amrex::BoxArray ba = relayout(candidate);
+
+    for (int i = 0; i < warmupSteps; ++i) {
+      advanceSingleTimestepAtLevel(0, tNew_[0], dt_[0], 1, 1);
+    }
+    amrex::ParallelDescriptor::Barrier();
+    const amrex::Real t_start = amrex::second();
+    for (int i = 0; i < timedSteps; ++i) {
+      advanceSingleTimestepAtLevel(0, tNew_[0], dt_[0], 1, 1);
+    }
+    amrex::Gpu::streamSynchronize();
+    amrex::Real elapsed = amrex::second() - t_start;
+    // the slowest rank decides, and the max-reduction keeps the choice
+    // identical on every rank (a collective-order requirement)
+    amrex::ParallelDescriptor::ReduceRealMax(elapsed);
+
+    if (Verbose() != 0) {
+      amrex::Print() << "[Autotune] max_grid_size " << candidate << ": "
+                     << elapsed / timedSteps << " s/step (" << ba.size()
+                     << " boxes)\n";
+    }
+    if (elapsed < bestTime) {
+      bestTime = elapsed;
+      bestCandidate = candidate;
+    }
+  }
+
+  // commit the winner and restore the pre-trial state
+  const amrex::BoxArray ba = relayout(bestCandidate);
+  amrex::Print() << "[Autotune] selected max_grid_size " << bestCandidate
+                 << " for level 0 (" << ba.size() << " boxes)\n";
 }
 
 template <typename problem_t>
@@ -514,17 +1607,44 @@ template <typename problem_t> void AMRSimulation<problem_t>::evolve() {
   amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const &dx0 =
       geom[0].CellSizeArray();
   amrex::Real const vol = AMREX_D_TERM(dx0[0], *dx0[1], *dx0[2]);
-  amrex::Vector<amrex::Real> init_sum_cons(ncomp_);
+  amrex::Vector<amrex::Real> init_sum_cons = MultiComponentSum(state_new_[0]);
   for (int n = 0; n < ncomp_; ++n) {
-    const int lev = 0;
-    init_sum_cons[n] = state_new_[lev].sum(n) * vol;
+    init_sum_cons[n] *= vol;
   }
 
   getWalltime(); // initialize start_time
 
+  if (autotuneMaxGridSize_ != 0 && istep[0] == 0) {
+    // pick the fastest level-0 grid decomposition before committing to the
+    // full run (skipped on restarts, which resume a tuned-or-chosen layout)
+    autotuneLevel0MaxGridSize();
+  }
+
+  // simulation-time-based output schedule: the first upcoming output times
+  // (restart-safe: computed from the current simulation time)
+  amrex::Real nextPlotTime = std::numeric_limits<amrex::Real>::max();
+  if (plotTimeInterval_ > 0.) {
+    nextPlotTime =
+        (std::floor(cur_time / plotTimeInterval_) + 1.) * plotTimeInterval_;
+  }
+  amrex::Real nextLogPlotTime = std::numeric_limits<amrex::Real>::max();
+  if (plotLogTimeFactor_ > 1. && plotLogTimeStart_ > 0.) {
+    nextLogPlotTime = plotLogTimeStart_;
+    while (nextLogPlotTime <= cur_time) {
+      nextLogPlotTime *= plotLogTimeFactor_;
+    }
+  }
+  amrex::Real nextChkTime = std::numeric_limits<amrex::Real>::max();
+  if (checkpointTimeInterval_ > 0.) {
+    nextChkTime = (std::floor(cur_time / checkpointTimeInterval_) + 1.) *
+                  checkpointTimeInterval_;
+  }
+  bool plotTriggerPrev = false;
+
   // Main time loop
   for (int step = istep[0]; step < maxTimesteps_ && cur_time < stopTime_;
        ++step) {
+    QUOKKA_PROFILE_RANGE("Quokka::coarseStep", -1, step);
 
     if (suppress_output == 0) {
       amrex::Print() << "\nCoarse STEP " << step + 1 << " at t = " << cur_time
@@ -532,7 +1652,8 @@ template <typename problem_t> void AMRSimulation<problem_t>::evolve() {
                      << std::endl;
     }
 
-    amrex::ParallelDescriptor::Barrier(); // synchronize all MPI ranks
+    const amrex::Real step_walltime_start = getWalltime();
+
     computeTimestep();
 
     int lev = 0;
@@ -543,19 +1664,87 @@ template <typename problem_t> void AMRSimulation<problem_t>::evolve() {
     ++cycleCount_;
     computeAfterTimestep();
 
+    // smoothed per-step compute time (excludes the output writes below);
+    // used by the checkpoint cadence auto-tuner
+    const amrex::Real step_seconds = getWalltime() - step_walltime_start;
+    stepWalltimeEwma_ = std::isnan(stepWalltimeEwma_)
+                            ? step_seconds
+                            : 0.75 * stepWalltimeEwma_ + 0.25 * step_seconds;
+
+    // sampled runtime NaN validation (a rotating subset of boxes per step)
+    checkStatesForNaNSampled(step);
+
     // sync up time (to avoid roundoff error)
     for (lev = 0; lev <= finest_level; ++lev) {
       tNew_[lev] = cur_time;
     }
 
-    if (plotfileInterval_ > 0 && (step + 1) % plotfileInterval_ == 0) {
+    // a termination signal arrived (queue kill or pre-walltime warning):
+    // write an immediate checkpoint and exit cleanly, instead of losing up
+    // to a full checkpoint interval of work. the flags are max-reduced so a
+    // signal delivered to any rank stops every rank (schedulers do not
+    // reliably forward signals to all ranks of a job).
+    int stopSignalled = (detail::signal_received != 0) ? 1 : 0;
+    amrex::ParallelDescriptor::ReduceIntMax(stopSignalled);
+    if (stopSignalled != 0) {
+      amrex::Print() << "Termination signal received; writing checkpoint "
+                     << "and exiting.\n";
+      last_chk_file_step = step + 1;
+      FlushDeferredAverageDown();
+      WriteCheckpointFile();
+      break;
+    }
+
+    // output scheduling: the step-count interval, the fixed and log-spaced
+    // simulation-time intervals, and the event trigger are OR-ed together
+    bool plotDue =
+        (plotfileInterval_ > 0 && (step + 1) % plotfileInterval_ == 0);
+    if (cur_time >= nextPlotTime) {
+      plotDue = true;
+      while (nextPlotTime <= cur_time) { // a large dt may cross several times
+        nextPlotTime += plotTimeInterval_;
+      }
+    }
+    if (cur_time >= nextLogPlotTime) {
+      plotDue = true;
+      while (nextLogPlotTime <= cur_time) {
+        nextLogPlotTime *= plotLogTimeFactor_;
+      }
+    }
+    if (plotfileTriggerFn_) {
+      const bool triggered = plotfileTriggerFn_();
+      if (triggered && !plotTriggerPrev) {
+        plotDue = true; // fire on each rising edge only
+      }
+      plotTriggerPrev = triggered;
+    }
+    if (plotDue) {
       last_plot_file_step = step + 1;
       WritePlotFile();
     }
 
-    if (checkpointInterval_ > 0 && (step + 1) % checkpointInterval_ == 0) {
+    // with a fixed interval the modulo test is kept for reproducibility;
+    // the auto-tuned interval changes over the run, so it counts steps
+    // since the last write instead
+    bool chkDue =
+        (checkpointInterval_ > 0 &&
+         ((checkpointOverheadPct_ > 0.)
+              ? (step + 1 - last_chk_file_step >= checkpointInterval_)
+              : ((step + 1) % checkpointInterval_ == 0)));
+    if (cur_time >= nextChkTime) {
+      chkDue = true;
+      while (nextChkTime <= cur_time) {
+        nextChkTime += checkpointTimeInterval_;
+      }
+    }
+    if (chkDue) {
       last_chk_file_step = step + 1;
+      FlushDeferredAverageDown();
+      const amrex::Real chk_start = getWalltime();
       WriteCheckpointFile();
+      if (checkpointOverheadPct_ > 0.) {
+        retuneCheckpointInterval(getWalltime() - chk_start);
+      }
     }
 
     if (cur_time >= stopTime_ - 1.e-6 * dt_[0]) {
@@ -571,12 +1760,18 @@ template <typename problem_t> void AMRSimulation<problem_t>::evolve() {
 
   amrex::Real elapsed_sec = getWalltime();
 
+  // complete any deferred average-down before the final diagnostics and
+  // outputs (the conservation sums below read the covered coarse cells)
+  FlushDeferredAverageDown();
+
   // compute reference solution (if it's a test problem)
   computeAfterEvolve(init_sum_cons);
 
   // compute conservation error
+  amrex::Vector<amrex::Real> const final_sum_cons =
+      MultiComponentSum(state_new_[0]);
   for (int n = 0; n < ncomp_; ++n) {
-    amrex::Real const final_sum = state_new_[0].sum(n) * vol;
+    amrex::Real const final_sum = final_sum_cons[n] * vol;
     amrex::Real const abs_err = (final_sum - init_sum_cons[n]);
     amrex::Print() << "Initial " << componentNames_[n] << " = "
                    << init_sum_cons[n] << std::endl;
@@ -598,54 +1793,293 @@ template <typename problem_t> void AMRSimulation<problem_t>::evolve() {
   amrex::Print() << "Performance figure-of-merit: " << microseconds_per_update
                  << " μs/zone-update [" << megaupdates_per_second
                  << " Mupdates/s]\n";
+
+  // the compute-only figure excludes the synchronous portion of the output
+  // writes (with writer-rank offload, the background write time overlaps
+  // steps and is correctly absent from both figures)
+  amrex::Real output_stall_sec = outputStallSeconds_;
+  amrex::ParallelDescriptor::ReduceRealMax(output_stall_sec, IOProc);
+  if (output_stall_sec > 0.) {
+    const double compute_sec = elapsed_sec - output_stall_sec;
+    amrex::Print() << "Performance figure-of-merit (excluding "
+                   << output_stall_sec << " s of output stalls): "
+                   << 1.0e6 * compute_sec / cellUpdates_
+                   << " μs/zone-update\n";
+  }
   for (int lev = 0; lev <= max_level; ++lev) {
     amrex::Print() << "Zone-updates on level " << lev << ": "
                    << cellUpdatesEachLevel_[lev] << "\n";
   }
   amrex::Print() << std::endl;
 
+  // memory accounting: per-level state footprint and the FAB high-water mark
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    amrex::Print() << "Level " << lev << " state memory: "
+                   << static_cast<double>(getLevelStateBytes(lev)) /
+                          (1 << 30)
+                   << " GiB (all ranks)\n";
+  }
+  auto fab_hwm = static_cast<amrex::Long>(amrex::TotalBytesAllocatedInFabsHWM());
+  amrex::ParallelDescriptor::ReduceLongMax(fab_hwm, IOProc);
+  amrex::Print() << "FAB memory high-water mark: "
+                 << static_cast<double>(fab_hwm) / (1 << 30)
+                 << " GiB (max over ranks)\n"
+                 << std::endl;
+
   // write final checkpoint
-  if (checkpointInterval_ > 0 && istep[0] > last_chk_file_step) {
+  if ((checkpointInterval_ > 0 || checkpointTimeInterval_ > 0.) &&
+      istep[0] > last_chk_file_step) {
     WriteCheckpointFile();
   }
 
   // write final plotfile
-  if (plotfileInterval_ > 0 && istep[0] > last_plot_file_step) {
+  if ((plotfileInterval_ > 0 || plotTimeInterval_ > 0. ||
+       plotLogTimeFactor_ > 1.) &&
+      istep[0] > last_plot_file_step) {
     WritePlotFile();
   }
 
+  // wait for an in-flight asynchronous checkpoint, and for any AsyncOut
+  // writes of the final plotfile (whose staged data plotMFStaging_ must
+  // stay alive until the background thread is done with it), before
+  // returning
+  FinishCheckpoint();
+  FinishAsyncPlotfile();
+
+  // emit the structured phase timings and transfer audit, if requested
+  WritePhaseTimings();
+  WriteTransferAudit();
+
 #ifdef AMREX_USE_ASCENT
-  // close Ascent
-  ascent_.close();
+  // wait for an in-flight asynchronous render, then close Ascent (if any
+  // render actually opened it)
+  FinishAscentRender();
+  if (ascentOpened_) {
+    ascent_.close();
+    ascentOpened_ = false;
+#ifdef AMREX_USE_MPI
+    MPI_Comm_free(&ascentComm_);
+#endif
+  }
 #endif
 }
 
+// decide whether the regrid scheduled at this candidate step should actually
+// run. with adaptive_regrid enabled, the current tags on 'lev' are compared
+// against a snapshot from the previous candidate step: while the tag-change
+// fraction stays below adaptiveRegridTagThreshold_, the regrid (ErrorEst on
+// all finer levels + MakeNewGrids clustering + RemakeLevel communication) is
+// skipped and the candidate interval doubles, up to
+// adaptiveRegridIntervalMax_ coarse steps; as soon as tags move, the interval
+// snaps back to regrid_int. the check itself costs one local tagging pass on
+// 'lev' plus a scalar reduction.
+template <typename problem_t>
+auto AMRSimulation<problem_t>::regridIsDue(int lev, amrex::Real time) -> bool {
+  if (adaptiveRegrid_ == 0) {
+    return true;
+  }
+
+  if (istep[lev] < nextRegridStep_[lev]) {
+    return false; // the interval was stretched at the last candidate step
+  }
+
+  // compute the current tags on this level only
+  amrex::TagBoxArray tags(grids[lev], dmap[lev]);
+  ErrorEst(lev, tags, time, 0);
+
+  // reduce to a bitmap of tagged cells
+  amrex::iMultiFab tagBits(grids[lev], dmap[lev], 1, 0);
+  for (amrex::MFIter mfi(tagBits); mfi.isValid(); ++mfi) {
+    const amrex::Box &box = mfi.validbox();
+    auto const &tag = tags.const_array(mfi);
+    auto const &bits = tagBits.array(mfi);
+    amrex::ParallelFor(box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+      bits(i, j, k) = (tag(i, j, k) == amrex::TagBox::SET) ? 1 : 0;
+    });
+  }
+
+  bool regridNow = true;
+  amrex::iMultiFab const *prev = regridTagSnapshot_[lev].get();
+
+  if (prev != nullptr && prev->boxArray() == grids[lev] &&
+      prev->DistributionMap() == dmap[lev]) {
+    // fraction of cells whose tag state changed, relative to the union of
+    // tagged cells (so a thin moving front registers as a large fraction)
+    amrex::Long counts[2] = {0, 0};
+    counts[0] = amrex::ReduceSum(
+        tagBits, *prev, 0,
+        [=] AMREX_GPU_DEVICE(amrex::Box const &bx,
+                             amrex::Array4<int const> const &cur,
+                             amrex::Array4<int const> const &old) -> int {
+          int n = 0;
+          amrex::Loop(bx, [&](int i, int j, int k) {
+            n += static_cast<int>(cur(i, j, k) != old(i, j, k));
+          });
+          return n;
+        });
+    counts[1] = amrex::ReduceSum(
+        tagBits, *prev, 0,
+        [=] AMREX_GPU_DEVICE(amrex::Box const &bx,
+                             amrex::Array4<int const> const &cur,
+                             amrex::Array4<int const> const &old) -> int {
+          int n = 0;
+          amrex::Loop(bx, [&](int i, int j, int k) {
+            n += static_cast<int>((cur(i, j, k) != 0) || (old(i, j, k) != 0));
+          });
+          return n;
+        });
+    amrex::ParallelAllReduce::Sum(counts, 2,
+                                  amrex::ParallelContext::CommunicatorSub());
+
+    const amrex::Real changedFraction =
+        static_cast<amrex::Real>(counts[0]) /
+        static_cast<amrex::Real>(std::max(counts[1], static_cast<amrex::Long>(1)));
+
+    if (changedFraction <= adaptiveRegridTagThreshold_) {
+      // the tag field is static: skip this regrid and stretch the interval
+      regridNow = false;
+      regridIntervalCur_[lev] =
+          std::min(2 * regridIntervalCur_[lev], adaptiveRegridIntervalMax_);
+    } else {
+      // fronts are moving: fall back to the short interval
+      regridIntervalCur_[lev] = regrid_int;
+    }
+  } else {
+    // no comparable snapshot (first candidate step, or this level was itself
+    // re-laid-out by a coarser regrid): regrid and start over
+    regridIntervalCur_[lev] = regrid_int;
+  }
+
+  regridTagSnapshot_[lev] = std::make_unique<amrex::iMultiFab>(std::move(tagBits));
+  nextRegridStep_[lev] = istep[lev] + regridIntervalCur_[lev];
+  return regridNow;
+}
+
+// approximate global memory footprint of a level's persistent state
+// (state_new_ + state_old_, including ghost zones), summed over all ranks
+template <typename problem_t>
+auto AMRSimulation<problem_t>::getLevelStateBytes(int lev) const
+    -> amrex::Long {
+  amrex::BoxArray const &ba = state_new_[lev].boxArray();
+  amrex::Long cells = 0;
+  for (amrex::Long i = 0; i < static_cast<amrex::Long>(ba.size()); ++i) {
+    cells += amrex::grow(ba[i], nghost_).numPts();
+  }
+  return cells * static_cast<amrex::Long>(2 * ncomp_) *
+         static_cast<amrex::Long>(sizeof(amrex::Real));
+}
+
+// pre-flight admission check for the regrid scheduled at this step: project
+// the post-regrid FAB footprint of the busiest rank and compare it against
+// the configured budget, so a regrid that would deepen the hierarchy past
+// available memory is caught *before* MakeNewLevelFromCoarse allocates --
+// not as a CUDA out-of-memory abort days into the run. over budget, the
+// regrid is skipped (capping hierarchy growth) or, with
+// regrid_memory_budget_abort, the run checkpoints and aborts cleanly.
+template <typename problem_t>
+auto AMRSimulation<problem_t>::regridFitsInMemory(int lev, amrex::Real time)
+    -> bool {
+  if (memoryBudgetGB_ <= 0.) {
+    return true;
+  }
+
+  // baseline: the current FAB footprint of the busiest rank (during a regrid
+  // the old and new fine-level allocations coexist while RemakeLevel copies,
+  // so the new levels are projected *on top of* the current total)
+  auto bytes = static_cast<amrex::Long>(amrex::TotalBytesAllocatedInFabs());
+  amrex::ParallelAllReduce::Max(bytes,
+                                amrex::ParallelContext::CommunicatorSub());
+
+  // project the levels this regrid may create or enlarge: tagged cells on
+  // level k refine into ~ refRatio^DIM / grid_eff cells on level k+1,
+  // distributed roughly evenly across ranks
+  const int nranks = amrex::ParallelDescriptor::NProcs();
+  for (int k = lev; k <= finest_level && k < max_level; ++k) {
+    amrex::TagBoxArray tags(grids[k], dmap[k]);
+    ErrorEst(k, tags, time, 0);
+
+    amrex::iMultiFab tagBits(grids[k], dmap[k], 1, 0);
+    for (amrex::MFIter mfi(tagBits); mfi.isValid(); ++mfi) {
+      const amrex::Box &box = mfi.validbox();
+      auto const &tag = tags.const_array(mfi);
+      auto const &bits = tagBits.array(mfi);
+      amrex::ParallelFor(box,
+                         [=] AMREX_GPU_DEVICE(int i, int j, int kk) noexcept {
+                           bits(i, j, kk) =
+                               (tag(i, j, kk) == amrex::TagBox::SET) ? 1 : 0;
+                         });
+    }
+    const amrex::Long nTagged = tagBits.sum(0); // collective
+
+    amrex::Long refFactor = 1;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+      refFactor *= refRatio(k)[d];
+    }
+    const auto newCells = static_cast<amrex::Long>(
+        static_cast<amrex::Real>(nTagged * refFactor) / grid_eff);
+
+    // bytes per fine cell: two state registers plus signal-speed and flux
+    // scratch, doubled again for ghost zones (conservative for 32^3 boxes)
+    const amrex::Long perCell =
+        static_cast<amrex::Long>(sizeof(amrex::Real)) * (2 * ncomp_ + 2) * 2;
+    bytes += (newCells * perCell) / nranks;
+  }
+
+  const auto budget =
+      static_cast<amrex::Long>(memoryBudgetGB_ * 1024. * 1024. * 1024.);
+  if (bytes <= budget) {
+    return true;
+  }
+
+  amrex::Print() << "[regrid] projected post-regrid footprint of the busiest "
+                 << "rank (" << static_cast<double>(bytes) / (1 << 30)
+                 << " GiB) exceeds the memory budget (" << memoryBudgetGB_
+                 << " GiB); skipping this regrid.\n";
+
+  if (memoryBudgetAbort_ != 0) {
+    FlushDeferredAverageDown();
+    WriteCheckpointFile();
+    amrex::Abort("regrid would exceed the memory budget; "
+                 "checkpoint written -- restart with more nodes or a "
+                 "smaller max_level");
+  }
+  return false;
+}
+
 // N.B.: This function actually works for subcycled or not subcycled, as long as
 // nsubsteps[lev] is set correctly.
 template <typename problem_t>
 void AMRSimulation<problem_t>::timeStepWithSubcycling(int lev, amrex::Real time,
                                                       int iteration) {
   BL_PROFILE("AMRSimulation::timeStepWithSubcycling()");
+  QUOKKA_PROFILE_RANGE("AMR::timeStep", lev, istep[lev]);
 
   if (regrid_int > 0) // regridding is possible
   {
     // help keep track of whether a level was already regridded
-    // from a coarser level call to regrid
-    static amrex::Vector<int> last_regrid_step(max_level + 1, 0);
+    // from a coarser level call to regrid (a member rather than a
+    // function-local static, so batch-mode runs in one process start fresh)
+    if (static_cast<int>(lastRegridStep_.size()) != max_level + 1) {
+      lastRegridStep_.assign(max_level + 1, 0);
+    }
 
     // regrid changes level "lev+1" so we don't regrid on max_level
     // also make sure we don't regrid fine levels again if
     // it was taken care of during a coarser regrid
-    if (lev < max_level && istep[lev] > last_regrid_step[lev]) {
-      if (istep[lev] % regrid_int == 0) {
+    if (lev < max_level && istep[lev] > lastRegridStep_[lev]) {
+      if (istep[lev] % regrid_int == 0 && regridIsDue(lev, time) &&
+          regridFitsInMemory(lev, time)) {
         // regrid could add newly refined levels (if finest_level < max_level)
         // so we save the previous finest level index
+        // (tagging and fill-from-coarse read covered coarse cells, so any
+        // deferred average-down must be completed first)
+        FlushDeferredAverageDown();
         int old_finest = finest_level;
         regrid(lev, time);
 
         // mark that we have regridded this level already
         for (int k = lev; k <= finest_level; ++k) {
-          last_regrid_step[k] = istep[k];
+          lastRegridStep_[k] = istep[k];
         }
 
         // if there are newly created levels, set the time step
@@ -659,10 +2093,25 @@ void AMRSimulation<problem_t>::timeStepWithSubcycling(int lev, amrex::Real time,
 
         // do fix-up on all levels that have been re-gridded
         for (int k = lev; k <= finest_level; ++k) {
-          FixupState(k);
+          FixupState(k, /*newStateOnly*/ false, /*syncRegion*/ nullptr);
+        }
+
+        // restore the Morton iteration order on the re-gridded levels (the
+        // new grids arrive in lexicographic order)
+        if (mortonOrder_ != 0) {
+          for (int k = lev + 1; k <= finest_level; ++k) {
+            applyMortonBoxOrder(k);
+          }
         }
       }
     }
+
+    // re-distribute boxes using the per-box costs measured since the last
+    // rebuild (must be done before the level advance begins)
+    if (loadBalanceInterval_ > 0 && lev == 0 && istep[0] > 0 &&
+        istep[0] % loadBalanceInterval_ == 0) {
+      rebuildDistributionMaps();
+    }
   }
 
   if (Verbose()) {
@@ -675,7 +2124,9 @@ void AMRSimulation<problem_t>::timeStepWithSubcycling(int lev, amrex::Real time,
   tOld_[lev] = tNew_[lev];
   tNew_[lev] += dt_[lev]; // critical that this is done *before* advanceAtLevel
 
+  const amrex::Real phase_start = startPhaseTimer();
   advanceSingleTimestepAtLevel(lev, time, dt_[lev], iteration, nsubsteps[lev]);
+  stopPhaseTimer("advance", lev, phase_start);
   ++istep[lev];
   cellUpdates_ += CountCells(lev); // keep track of total number of cell updates
   cellUpdatesEachLevel_[lev] += CountCells(lev);
@@ -686,18 +2137,53 @@ void AMRSimulation<problem_t>::timeStepWithSubcycling(int lev, amrex::Real time,
   }
 
   if (lev < finest_level) {
-    // recursive call for next-finer level
+    // recursive call for next-finer level.
+    // N.B.: the fine-level subcycles *are* the per-coarse-step critical path
+    // on deep hierarchies, but all levels are advanced by this one host
+    // thread, so every kernel is enqueued in program order and there is no
+    // concurrent coarse-level GPU work to prioritize against (the background
+    // activities -- AsyncOut (which also drains checkpoints) and the Ascent
+    // render -- are host-side). Assigning the fine-level kernel chains to high-priority
+    // device streams would therefore be a no-op here, and would in any case
+    // need priority support in the AMReX stream pool, which application code
+    // cannot reach. Revisit if coarse-level work is ever made speculative.
     for (int i = 1; i <= nsubsteps[lev + 1]; ++i) {
       timeStepWithSubcycling(lev + 1, time + (i - 1) * dt_[lev + 1], i);
     }
 
+    QUOKKA_PROFILE_RANGE("AMR::sync", lev, istep[lev]);
     if (do_reflux != 0) {
       // update lev based on coarse-fine flux mismatch
+      const amrex::Real reflux_start = startPhaseTimer();
       flux_reg_[lev + 1]->Reflux(state_new_[lev]);
+      stopPhaseTimer("Reflux", lev, reflux_start);
     }
 
-    AverageDownTo(lev); // average lev+1 down to lev
-    FixupState(lev); // fix any unphysical states created by reflux or averaging
+    const amrex::Real avgdown_start = startPhaseTimer();
+    if (boundaryAverageDown_ != 0) {
+      // only the coarse-fine boundary region is needed for the next steps;
+      // the interior covered cells are refreshed lazily (see
+      // FlushDeferredAverageDown)
+      BoundaryAverageDownTo(lev);
+      averageDownDeferred_ = true;
+    } else {
+      AverageDownTo(lev); // average lev+1 down to lev
+    }
+    stopPhaseTimer("AverageDown", lev, avgdown_start);
+    // fix any unphysical states created by reflux or averaging (neither
+    // touches the old state or ghost zones, so only the valid region of the
+    // new state is scanned). the reflux and the (boundary) average-down only
+    // modify coarse cells on and around the coarse-fine boundary; on the GPU
+    // their kernels are already enqueued asynchronously, and there is no
+    // later independent work in program order to overlap them with (see the
+    // single-host-thread note above), so the serial cost that *can* be cut
+    // here is the full-level fixup scan -- restrict it to the modified band
+    if (boundarySyncFixup_ != 0) {
+      const amrex::BoxArray syncRegion = SyncTouchedRegion(lev);
+      FixupState(lev, /*newStateOnly*/ true, &syncRegion);
+    } else {
+      FixupState(lev, /*newStateOnly*/ true, /*syncRegion*/ nullptr);
+    }
   }
 }
 
@@ -726,6 +2212,42 @@ void AMRSimulation<problem_t>::incrementFluxRegisters(
   }
 }
 
+template <typename problem_t>
+void AMRSimulation<problem_t>::accumulateFluxesForReflux(
+    amrex::MFIter &mfi, amrex::YAFluxRegister *fr_as_crse,
+    amrex::YAFluxRegister *fr_as_fine,
+    std::array<amrex::FArrayBox, AMREX_SPACEDIM> const &fluxArrays,
+    int const nstart, int const lev,
+    std::array<amrex::FArrayBox, AMREX_SPACEDIM> &accum,
+    amrex::Real const scale) {
+  BL_PROFILE("AMRSimulation::accumulateFluxesForReflux()");
+
+  // skip boxes that do not touch a coarse-fine boundary: CrseAdd/FineAdd
+  // would return without launching anything for them, but the caller would
+  // still pay for expanding and accumulating their fluxes
+  const bool hasWork =
+      ((fr_as_crse != nullptr) && fr_as_crse->CrseHasWork(mfi)) ||
+      ((fr_as_fine != nullptr) && fr_as_fine->FineHasWork(mfi));
+  if (!hasWork) {
+    return;
+  }
+
+  for (int dim = 0; dim < AMREX_SPACEDIM; ++dim) {
+    amrex::FArrayBox const &flux = fluxArrays[dim];
+    if (!accum[dim].isAllocated()) {
+      // reflux arrays must have the same number of components as the state.
+      // each substage deposits its fluxes in place at its component offset
+      // (nstart), so no flux data is ever copied just to widen the layout;
+      // hydro and radiation substages share the same accumulator FABs
+      accum[dim] = amrex::FArrayBox(flux.box(), state_new_[lev].nComp(),
+                                    amrex::The_Async_Arena());
+      accum[dim].template setVal<amrex::RunOn::Device>(0.);
+    }
+    accum[dim].template saxpy<amrex::RunOn::Device>(
+        scale, flux, flux.box(), flux.box(), 0, nstart, flux.nComp());
+  }
+}
+
 // Make a new level using provided BoxArray and DistributionMapping and fill
 // with interpolated coarse level data. Overrides the pure virtual function in
 // AmrCore
@@ -735,12 +2257,13 @@ void AMRSimulation<problem_t>::MakeNewLevelFromCoarse(
     const amrex::DistributionMapping &dm) {
   BL_PROFILE("AMRSimulation::MakeNewLevelFromCoarse()");
 
+  invalidateFillPatcher(level);
+
   const int ncomp = state_new_[level - 1].nComp();
   const int nghost = state_new_[level - 1].nGrow();
 
   state_new_[level].define(ba, dm, ncomp, nghost);
   state_old_[level].define(ba, dm, ncomp, nghost);
-  max_signal_speed_[level].define(ba, dm, 1, nghost);
 
   tNew_[level] = time;
   tOld_[level] = time - 1.e200;
@@ -751,8 +2274,13 @@ void AMRSimulation<problem_t>::MakeNewLevelFromCoarse(
         Geom(level - 1), refRatio(level - 1), level, ncomp);
   }
 
+  resetLevelCosts(level);
+
+  // both states hold the same interpolated data at 'time', so interpolate
+  // (and communicate) once and duplicate it with a local copy
   FillCoarsePatch(level, time, state_new_[level], 0, ncomp);
-  FillCoarsePatch(level, time, state_old_[level], 0, ncomp); // also necessary
+  amrex::MultiFab::Copy(state_old_[level], state_new_[level], 0, 0, ncomp,
+                        nghost);
 }
 
 // Remake an existing level using provided BoxArray and DistributionMapping and
@@ -764,28 +2292,94 @@ void AMRSimulation<problem_t>::RemakeLevel(
     const amrex::DistributionMapping &dm) {
   BL_PROFILE("AMRSimulation::RemakeLevel()");
 
+  invalidateFillPatcher(level);
+
   const int ncomp = state_new_[level].nComp();
   const int nghost = state_new_[level].nGrow();
 
   amrex::MultiFab new_state(ba, dm, ncomp, nghost);
   amrex::MultiFab old_state(ba, dm, ncomp, nghost);
-  amrex::MultiFab max_signal_speed(ba, dm, 1, nghost);
-
-  FillPatch(level, time, new_state, 0, ncomp);
-  FillPatch(level, time, old_state, 0, ncomp); // also necessary
 
-  std::swap(new_state, state_new_[level]);
-  std::swap(old_state, state_old_[level]);
-  std::swap(max_signal_speed, max_signal_speed_[level]);
+  // delta remake: a new box that exists identically in the old layout on
+  // the same rank keeps its data through a local copy, and only the
+  // remaining boxes pay the two-level fill communication (a slowly
+  // advancing front typically changes a few percent of the boxes; a pure
+  // relayout such as the Morton reorder changes none). every rank computes
+  // the same partition, since it depends only on the global box arrays and
+  // distribution maps. the local copy includes the ghost zones, which are
+  // then stale (from the last in-step fill) rather than patched at 'time';
+  // they are refilled at the start of the next advance before anything
+  // reads them, and the post-regrid fixup only floors them.
+  bool delta = (deltaRegrid_ != 0 && tNew_[level] == time);
+  amrex::Vector<int> keptOldIndex;
+  amrex::Vector<int> newToChanged;
+  amrex::BoxList changedBoxes;
+  amrex::Vector<int> changedProcs;
+  if (delta) {
+    amrex::BoxArray const &oldba = boxArray(level); // set after this call
+    amrex::DistributionMapping const &olddm = DistributionMap(level);
+    keptOldIndex.resize(ba.size(), -1);
+    newToChanged.resize(ba.size(), -1);
+    for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+      for (auto const &isect : oldba.intersections(ba[i])) {
+        if (oldba[isect.first] == ba[i] && olddm[isect.first] == dm[i]) {
+          keptOldIndex[i] = isect.first;
+          break;
+        }
+      }
+      if (keptOldIndex[i] < 0) {
+        newToChanged[i] = static_cast<int>(changedBoxes.size());
+        changedBoxes.push_back(ba[i]);
+        changedProcs.push_back(dm[i]);
+      }
+    }
+    if (static_cast<int>(changedBoxes.size()) ==
+        static_cast<int>(ba.size())) {
+      delta = false; // nothing survives; take the plain path
+    }
+  }
 
-  tNew_[level] = time;
-  tOld_[level] = time - 1.e200;
+  if (delta) {
+    // fill only the genuinely new regions (none at all for a pure
+    // relayout), then assemble the new level with local copies
+    amrex::MultiFab changed;
+    if (changedBoxes.isNotEmpty()) {
+      changed.define(amrex::BoxArray(std::move(changedBoxes)),
+                     amrex::DistributionMapping(std::move(changedProcs)),
+                     ncomp, nghost);
+      FillPatch(level, time, changed, 0, ncomp);
+    }
+    for (amrex::MFIter mfi(new_state); mfi.isValid(); ++mfi) {
+      const int i = mfi.index();
+      amrex::FArrayBox &dest = new_state[mfi];
+      if (keptOldIndex[i] >= 0) {
+        dest.copy<amrex::RunOn::Device>(state_new_[level][keptOldIndex[i]]);
+      } else {
+        dest.copy<amrex::RunOn::Device>(changed[newToChanged[i]]);
+      }
+    }
+    amrex::Gpu::streamSynchronize(); // the copies read FABs freed below
+  } else {
+    FillPatch(level, time, new_state, 0, ncomp);
+  }
+
+  // both states hold the same patched data at 'time', so communicate once
+  // and duplicate it with a local copy
+  amrex::MultiFab::Copy(old_state, new_state, 0, 0, ncomp, nghost);
+
+  std::swap(new_state, state_new_[level]);
+  std::swap(old_state, state_old_[level]);
+
+  tNew_[level] = time;
+  tOld_[level] = time - 1.e200;
 
   if (level > 0 && (do_reflux != 0)) {
     flux_reg_[level] = std::make_unique<amrex::YAFluxRegister>(
         ba, boxArray(level - 1), dm, DistributionMap(level - 1), Geom(level),
         Geom(level - 1), refRatio(level - 1), level, ncomp);
   }
+
+  resetLevelCosts(level);
 }
 
 // Delete level data. Overrides the pure virtual function in AmrCore
@@ -795,8 +2389,9 @@ void AMRSimulation<problem_t>::ClearLevel(int level) {
 
   state_new_[level].clear();
   state_old_[level].clear();
-  max_signal_speed_[level].clear();
   flux_reg_[level].reset(nullptr);
+  costs_[level].reset(nullptr);
+  invalidateFillPatcher(level);
 }
 
 // Make a new level from scratch using provided BoxArray and
@@ -808,12 +2403,13 @@ void AMRSimulation<problem_t>::MakeNewLevelFromScratch(
     const amrex::DistributionMapping &dm) {
   BL_PROFILE("AMRSimulation::MakeNewLevelFromScratch()");
 
+  invalidateFillPatcher(level);
+
   const int ncomp = ncomp_;
   const int nghost = nghost_;
 
   state_new_[level].define(ba, dm, ncomp, nghost);
   state_old_[level].define(ba, dm, ncomp, nghost);
-  max_signal_speed_[level].define(ba, dm, 1, nghost);
 
   tNew_[level] = time;
   tOld_[level] = time - 1.e200;
@@ -824,6 +2420,8 @@ void AMRSimulation<problem_t>::MakeNewLevelFromScratch(
         Geom(level - 1), refRatio(level - 1), level, ncomp);
   }
 
+  resetLevelCosts(level);
+
   // set state_new_[lev] to desired initial condition
   setInitialConditionsAtLevel(level);
 
@@ -862,12 +2460,91 @@ AMRSimulation<problem_t>::setCustomBoundaryConditions(
   // set boundary condition for cell 'iv'
 }
 
+template <typename problem_t>
+void AMRSimulation<problem_t>::setCustomBoundaryConditionsFaceBatch(
+    const amrex::Box & /*boundaryRange*/,
+    amrex::Array4<amrex::Real> const & /*dest*/, int /*dcomp*/,
+    int /*numcomp*/, amrex::GeometryData const & /*geom*/,
+    amrex::Real /*time*/, amrex::Orientation /*face*/) {
+  // user should implement if needed using template specialization (called on
+  // the host with the whole ghost-cell Box of one face of one grown box, so
+  // the problem launches a single kernel per face instead of paying the
+  // per-ghost-cell functor indirection of setCustomBoundaryConditions)
+}
+
+// invoke the per-face batched user boundary kernel on every face of every
+// grown box that lies outside an ext_dir domain boundary (no-op unless the
+// problem sets customFaceBoundaryBatch_ = 1)
+template <typename problem_t>
+void AMRSimulation<problem_t>::fillCustomBoundaryFaces(amrex::MultiFab &state,
+                                                       int const icomp,
+                                                       int const ncomp,
+                                                       int const lev,
+                                                       amrex::Real const time) {
+  BL_PROFILE("AMRSimulation::fillCustomBoundaryFaces()");
+
+  const amrex::Box &domain = geom[lev].Domain();
+  amrex::GeometryData const geomData = geom[lev].data();
+
+  // faces where at least one filled component is user-defined (ext_dir)
+  std::array<bool, 2 * AMREX_SPACEDIM> extDirFace{};
+  for (amrex::OrientationIter oit; oit.isValid(); ++oit) {
+    const amrex::Orientation face = oit();
+    for (int n = icomp; n < icomp + ncomp; ++n) {
+      const int bc = face.isLow()
+                         ? boundaryConditions_[n].lo(face.coordDir())
+                         : boundaryConditions_[n].hi(face.coordDir());
+      if (bc == amrex::BCType::ext_dir) {
+        extDirFace[face] = true;
+        break;
+      }
+    }
+  }
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+  for (amrex::MFIter mfi(state); mfi.isValid(); ++mfi) {
+    const amrex::Box &grown = mfi.fabbox();
+    auto const &dest = state.array(mfi);
+    for (amrex::OrientationIter oit; oit.isValid(); ++oit) {
+      const amrex::Orientation face = oit();
+      if (!extDirFace[face]) {
+        continue;
+      }
+      // ghost-cell region of this box outside the domain on 'face'
+      const int dim = face.coordDir();
+      amrex::Box bndryBox = grown;
+      if (face.isLow()) {
+        if (grown.smallEnd(dim) >= domain.smallEnd(dim)) {
+          continue;
+        }
+        bndryBox.setBig(dim, domain.smallEnd(dim) - 1);
+      } else {
+        if (grown.bigEnd(dim) <= domain.bigEnd(dim)) {
+          continue;
+        }
+        bndryBox.setSmall(dim, domain.bigEnd(dim) + 1);
+      }
+      setCustomBoundaryConditionsFaceBatch(bndryBox, dest, icomp, ncomp,
+                                           geomData, time, face);
+    }
+  }
+}
+
 template <typename problem_t>
 void AMRSimulation<problem_t>::fillBoundaryConditions(amrex::MultiFab &S_filled,
                                                       amrex::MultiFab &state,
                                                       int const lev,
-                                                      amrex::Real const time) {
+                                                      amrex::Real const time,
+                                                      int const icomp,
+                                                      int ncomp) {
   BL_PROFILE("AMRSimulation::fillBoundaryConditions()");
+  QUOKKA_PROFILE_RANGE("FillPatch", lev);
+
+  if (ncomp < 0) {
+    ncomp = S_filled.nComp(); // fill all components
+  }
 
   // On a single level, any periodic boundaries are filled first
   // 	then built-in boundary conditions are filled (with amrex::FilccCell()),
@@ -885,8 +2562,9 @@ void AMRSimulation<problem_t>::fillBoundaryConditions(amrex::MultiFab &S_filled,
     amrex::Vector<amrex::MultiFab *> coarseData;
     amrex::Vector<amrex::Real> coarseTime;
 
-    // returns old state, new state, or both depending on 'time'
-    GetData(lev - 1, time, coarseData, coarseTime);
+    // returns a single coarse state, either directly or time-interpolated
+    // into the per-level cache (see getCoarseDataForFill)
+    getCoarseDataForFill(lev, time, coarseData, coarseTime);
     AMREX_ASSERT(!state.contains_nan(0, state.nComp()));
 
     for (int i = 0; i < coarseData.size(); ++i) {
@@ -895,12 +2573,24 @@ void AMRSimulation<problem_t>::fillBoundaryConditions(amrex::MultiFab &S_filled,
     }
 
     FillPatchWithData(lev, time, S_filled, coarseData, coarseTime, fineData,
-                      fineTime, 0, S_filled.nComp());
+                      fineTime, icomp, ncomp);
+
+    if (customFaceBoundaryBatch_ != 0) {
+      fillCustomBoundaryFaces(S_filled, icomp, ncomp, lev, time);
+    }
   } else { // level 0
     // fill internal and periodic boundaries, ignoring corners (cross=true)
     // (there is no performance benefit for this in practice)
     // state.FillBoundary(geom[lev].periodicity(), true);
-    state.FillBoundary(geom[lev].periodicity());
+    if (floatGhostExchange_ != 0) {
+      // exchange the ghost data in single precision (see getFloatGhostBuffer)
+      floatFillBoundaryPack(state, lev, icomp, ncomp);
+      getFloatGhostBuffer(lev, state).FillBoundary(icomp, ncomp,
+                                                   geom[lev].periodicity());
+      floatFillBoundaryUnpack(state, lev, icomp, ncomp);
+    } else {
+      state.FillBoundary(icomp, ncomp, geom[lev].periodicity());
+    }
 
     if (!geom[lev].isAllPeriodic()) {
       amrex::GpuBndryFuncFab<setBoundaryFunctor<problem_t>> boundaryFunctor(
@@ -909,14 +2599,18 @@ void AMRSimulation<problem_t>::fillBoundaryConditions(amrex::MultiFab &S_filled,
           physicalBoundaryFunctor(geom[lev], boundaryConditions_,
                                   boundaryFunctor);
       // fill physical boundaries
-      physicalBoundaryFunctor(state, 0, state.nComp(), state.nGrowVect(), time,
-                              0);
+      physicalBoundaryFunctor(state, icomp, ncomp, state.nGrowVect(), time,
+                              icomp);
+
+      if (customFaceBoundaryBatch_ != 0) {
+        fillCustomBoundaryFaces(state, icomp, ncomp, lev, time);
+      }
     }
   }
 
   // ensure that there are no NaNs (can happen when domain boundary filling is
   // unimplemented or malfunctioning)
-  AMREX_ASSERT(!S_filled.contains_nan(0, S_filled.nComp()));
+  AMREX_ASSERT(!S_filled.contains_nan(icomp, ncomp));
   AMREX_ASSERT(
       !S_filled.contains_nan()); // check ghost zones (usually this is caused by
                                  // forgetting to fill some components when
@@ -924,6 +2618,237 @@ void AMRSimulation<problem_t>::fillBoundaryConditions(amrex::MultiFab &S_filled,
                                  // variables in a hydro-only problem)
 }
 
+template <typename problem_t>
+void AMRSimulation<problem_t>::fillBoundaryConditionsBegin(
+    amrex::MultiFab &S_filled, amrex::MultiFab &state, int const lev,
+    amrex::Real const time) {
+  BL_PROFILE("AMRSimulation::fillBoundaryConditionsBegin()");
+
+  if (lev > 0) { // refined level -- cannot split, do the full blocking fill
+    fillBoundaryConditions(S_filled, state, lev, time);
+    return;
+  }
+
+  // post the asynchronous exchange. on-rank copies are performed immediately;
+  // only the off-rank messages remain outstanding afterwards.
+  if (floatGhostExchange_ != 0) {
+    floatFillBoundaryPack(state, lev, 0, state.nComp());
+    getFloatGhostBuffer(lev, state)
+        .FillBoundary_nowait(geom[lev].periodicity());
+  } else {
+    state.FillBoundary_nowait(geom[lev].periodicity());
+  }
+
+  if (!geom[lev].isAllPeriodic()) {
+    amrex::GpuBndryFuncFab<setBoundaryFunctor<problem_t>> boundaryFunctor(
+        setBoundaryFunctor<problem_t>{});
+    amrex::PhysBCFunct<amrex::GpuBndryFuncFab<setBoundaryFunctor<problem_t>>>
+        physicalBoundaryFunctor(geom[lev], boundaryConditions_,
+                                boundaryFunctor);
+    // fill physical boundaries (local operation)
+    physicalBoundaryFunctor(state, 0, state.nComp(), state.nGrowVect(), time,
+                            0);
+
+    if (customFaceBoundaryBatch_ != 0) {
+      fillCustomBoundaryFaces(state, 0, state.nComp(), lev, time);
+    }
+  }
+}
+
+template <typename problem_t>
+void AMRSimulation<problem_t>::fillBoundaryConditionsEnd(
+    amrex::MultiFab &S_filled, amrex::MultiFab &state, int const lev) {
+  BL_PROFILE("AMRSimulation::fillBoundaryConditionsEnd()");
+
+  if (lev > 0) {
+    return; // Begin already performed the full blocking fill
+  }
+
+  if (floatGhostExchange_ != 0) {
+    getFloatGhostBuffer(lev, state).FillBoundary_finish();
+    floatFillBoundaryUnpack(state, lev, 0, state.nComp());
+  } else {
+    state.FillBoundary_finish();
+  }
+
+  // ensure that there are no NaNs (see fillBoundaryConditions)
+  AMREX_ASSERT(!S_filled.contains_nan(0, S_filled.nComp()));
+  AMREX_ASSERT(!S_filled.contains_nan()); // check ghost zones
+}
+
+template <typename problem_t>
+auto AMRSimulation<problem_t>::getFloatGhostBuffer(
+    int const lev, amrex::MultiFab const &state)
+    -> amrex::FabArray<amrex::BaseFab<float>> & {
+  if (static_cast<int>(floatGhostBuffer_.size()) <= lev) {
+    floatGhostBuffer_.resize(lev + 1);
+  }
+
+  // (re)allocate the shadow whenever the layout or shape changed, e.g. after
+  // a regrid, a load-balance relayout, or a Morton reorder
+  auto &buffer = floatGhostBuffer_[lev];
+  if (buffer == nullptr || buffer->boxArray() != state.boxArray() ||
+      buffer->DistributionMap() != state.DistributionMap() ||
+      buffer->nComp() != state.nComp() ||
+      buffer->nGrowVect() != state.nGrowVect()) {
+    buffer = std::make_unique<amrex::FabArray<amrex::BaseFab<float>>>(
+        state.boxArray(), state.DistributionMap(), state.nComp(),
+        state.nGrowVect());
+  }
+  return *buffer;
+}
+
+template <typename problem_t>
+void AMRSimulation<problem_t>::floatFillBoundaryPack(
+    amrex::MultiFab const &state, int const lev, int const icomp,
+    int const ncomp) {
+  BL_PROFILE("AMRSimulation::floatFillBoundaryPack()");
+
+  auto &shadow = getFloatGhostBuffer(lev, state);
+  const int ng = state.nGrowVect()[0];
+
+  // only the shell of valid cells within ng of a box face can be read as a
+  // send source, so only those cells need to be demoted
+  for (amrex::MFIter mfi(state); mfi.isValid(); ++mfi) {
+    amrex::Box const &vbx = mfi.validbox();
+    auto const &src = state.const_array(mfi);
+    auto const &dst = shadow.array(mfi);
+    for (amrex::Box const &bx :
+         amrex::boxDiff(vbx, amrex::grow(vbx, -ng))) {
+      amrex::ParallelFor(
+          bx, ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+            dst(i, j, k, icomp + n) =
+                static_cast<float>(src(i, j, k, icomp + n));
+          });
+    }
+  }
+}
+
+template <typename problem_t>
+void AMRSimulation<problem_t>::floatFillBoundaryUnpack(amrex::MultiFab &state,
+                                                       int const lev,
+                                                       int const icomp,
+                                                       int const ncomp) {
+  BL_PROFILE("AMRSimulation::floatFillBoundaryUnpack()");
+
+  auto &shadow = getFloatGhostBuffer(lev, state);
+  const int ng = state.nGrowVect()[0];
+
+  // FillBoundary only fills ghost cells covered by valid cells (or their
+  // periodic images), so restrict the copy-back to the domain grown along
+  // the periodic dimensions; ghost cells outside it belong to the physical
+  // boundary functor and must not be clobbered
+  amrex::Box coveredDomain = geom[lev].Domain();
+  for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+    if (geom[lev].isPeriodic(d)) {
+      coveredDomain.grow(d, ng);
+    }
+  }
+
+  for (amrex::MFIter mfi(state); mfi.isValid(); ++mfi) {
+    amrex::Box const &vbx = mfi.validbox();
+    auto const &src = shadow.const_array(mfi);
+    auto const &dst = state.array(mfi);
+    for (amrex::Box const &gbx : amrex::boxDiff(amrex::grow(vbx, ng), vbx)) {
+      amrex::Box const bx = gbx & coveredDomain;
+      if (bx.ok()) {
+        amrex::ParallelFor(
+            bx, ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+              dst(i, j, k, icomp + n) =
+                  static_cast<double>(src(i, j, k, icomp + n));
+            });
+      }
+    }
+  }
+}
+
+template <typename problem_t>
+auto AMRSimulation<problem_t>::computeCommFreeBoxes(int const lev) const
+    -> amrex::LayoutData<int> {
+  BL_PROFILE("AMRSimulation::computeCommFreeBoxes()");
+
+  amrex::LayoutData<int> commFree(boxArray(lev), DistributionMap(lev));
+
+  // gather the valid boxes owned by this rank
+  amrex::BoxList localBoxes;
+  for (amrex::MFIter mfi(commFree); mfi.isValid(); ++mfi) {
+    localBoxes.push_back(mfi.validbox());
+  }
+  amrex::BoxArray const localBA(std::move(localBoxes));
+  amrex::Box const &domain = geom[lev].Domain();
+
+  for (amrex::MFIter mfi(commFree); mfi.isValid(); ++mfi) {
+    amrex::Box const &gbx = amrex::grow(mfi.validbox(), nghost_);
+    // ghost cells across a periodic boundary may live on another rank, so
+    // conservatively require the grown box to be inside the domain in that
+    // case. ghost cells outside a non-periodic boundary are filled locally.
+    bool isCommFree = domain.contains(gbx) || !geom[lev].isAnyPeriodic();
+    if (isCommFree) {
+      isCommFree = localBA.contains(gbx & domain);
+    }
+    commFree[mfi] = static_cast<int>(isCommFree);
+  }
+  return commFree;
+}
+
+// runtime-selected interpolater for all coarse->fine fills. these are the
+// MultiFab-batched variants, which interpolate every component of a whole
+// MultiFab per kernel launch, instead of the legacy FAB-at-a-time Interpolater
+// with its per-FAB temporaries. ("quartic" has no MF-batched implementation
+// in AMReX and falls back to the FAB-at-a-time form.)
+template <typename problem_t>
+auto AMRSimulation<problem_t>::getFillPatchInterpolater() const
+    -> amrex::InterpBase * {
+  if (fillPatchInterp_ == "pc") {
+    return &amrex::mf_pc_interp; // piecewise constant (sharp fields)
+  }
+  if (fillPatchInterp_ == "quartic") {
+    return &amrex::quartic_interp; // 4th-order conservative
+  }
+  if (fillPatchInterp_ != "cell_cons") {
+    amrex::Abort("Unknown fill_patch_interp value: " + fillPatchInterp_);
+  }
+  return &amrex::mf_cell_cons_interp; // conservative linear (default)
+}
+
+// return the cached FillPatcher for filling mf on level lev, creating it if
+// necessary. returns nullptr if the fill cannot use the cache (level 0, a
+// component range outside the conserved state, or grids that do not match the
+// current level -- e.g. during RemakeLevel), in which case the caller should
+// fall back to a one-off FillPatchTwoLevels. the patcher is sized for the
+// full state; partial fills (e.g. the radiation-only fills during subcycles)
+// reuse it with a component sub-range.
+template <typename problem_t>
+auto AMRSimulation<problem_t>::getFillPatcher(amrex::MultiFab const &mf,
+                                              int lev, int icomp, int ncomp)
+    -> amrex::FillPatcher<amrex::MultiFab> * {
+  if (lev == 0 || icomp < 0 || icomp + ncomp > ncomp_ ||
+      mf.nGrowVect() != amrex::IntVect(nghost_) ||
+      mf.boxArray() != boxArray(lev) ||
+      mf.DistributionMap() != DistributionMap(lev)) {
+    return nullptr;
+  }
+  if (fillPatcher_[lev] == nullptr) {
+    fillPatcher_[lev] = std::make_unique<amrex::FillPatcher<amrex::MultiFab>>(
+        boxArray(lev), DistributionMap(lev), geom[lev], boxArray(lev - 1),
+        DistributionMap(lev - 1), geom[lev - 1], amrex::IntVect(nghost_),
+        ncomp_, getFillPatchInterpolater());
+  }
+  return fillPatcher_[lev].get();
+}
+
+// invalidate any cached fill-patch communication patterns that involve level
+// lev (as the fine or the coarse level)
+template <typename problem_t>
+void AMRSimulation<problem_t>::invalidateFillPatcher(int lev) {
+  if (lev < fillPatcher_.size()) {
+    fillPatcher_[lev].reset();
+  }
+  if (lev + 1 < fillPatcher_.size()) {
+    fillPatcher_[lev + 1].reset();
+  }
+}
+
 // Compute a new multifab 'mf' by copying in state from given data and filling
 // ghost cells
 template <typename problem_t>
@@ -945,25 +2870,37 @@ void AMRSimulation<problem_t>::FillPatchWithData(
 
   if (lev == 0) { // NOTE: used by RemakeLevel
     // copies interior zones, fills ghost zones
-    amrex::FillPatchSingleLevel(mf, time, fineData, fineTime, 0, icomp, ncomp,
-                                geom[lev], finePhysicalBoundaryFunctor, 0);
+    // (the source and destination component ranges coincide -- both refer to
+    //  the conserved-state component layout)
+    amrex::FillPatchSingleLevel(mf, time, fineData, fineTime, icomp, icomp,
+                                ncomp, geom[lev], finePhysicalBoundaryFunctor,
+                                icomp);
   } else {
     amrex::PhysBCFunct<amrex::GpuBndryFuncFab<setBoundaryFunctor<problem_t>>>
         coarsePhysicalBoundaryFunctor(geom[lev - 1], boundaryConditions_,
                                       boundaryFunctor);
 
-    // use CellConservativeLinear interpolation onto fine grid
-    amrex::Interpolater *mapper = &amrex::cell_cons_interp;
-    // amrex::MFInterpolater *mapper = &amrex::mf_cell_cons_interp;
-    // amrex::MFInterpolater *mapper = &amrex::mf_pc_interp;
+    // runtime-selected MF-batched interpolation onto the fine grid
+    amrex::InterpBase *mapper = getFillPatchInterpolater();
 
     // copies interior zones, fills ghost zones with space-time interpolated
-    // data
-    amrex::FillPatchTwoLevels(mf, time, coarseData, coarseTime, fineData,
-                              fineTime, 0, icomp, ncomp, geom[lev - 1],
-                              geom[lev], coarsePhysicalBoundaryFunctor, 0,
-                              finePhysicalBoundaryFunctor, 0, refRatio(lev - 1),
-                              mapper, boundaryConditions_, 0);
+    // data. repeated fills on the same grids (e.g. during radiation
+    // subcycling) reuse the communication pattern cached in the FillPatcher
+    // instead of recomputing it on every call.
+    if (auto *fillPatcher = getFillPatcher(mf, lev, icomp, ncomp);
+        fillPatcher != nullptr) {
+      fillPatcher->fill(mf, time, coarseData, coarseTime, fineData, fineTime,
+                        icomp, icomp, ncomp, coarsePhysicalBoundaryFunctor,
+                        icomp, finePhysicalBoundaryFunctor, icomp,
+                        boundaryConditions_, icomp);
+    } else {
+      amrex::FillPatchTwoLevels(mf, time, coarseData, coarseTime, fineData,
+                                fineTime, icomp, icomp, ncomp, geom[lev - 1],
+                                geom[lev], coarsePhysicalBoundaryFunctor,
+                                icomp, finePhysicalBoundaryFunctor, icomp,
+                                refRatio(lev - 1), mapper, boundaryConditions_,
+                                icomp);
+    }
   }
 }
 
@@ -974,6 +2911,7 @@ void AMRSimulation<problem_t>::FillPatch(int lev, amrex::Real time,
                                          amrex::MultiFab &mf, int icomp,
                                          int ncomp) {
   BL_PROFILE("AMRSimulation::FillPatch()");
+  const amrex::Real phase_start = startPhaseTimer();
 
   amrex::Vector<amrex::MultiFab *> cmf;
   amrex::Vector<amrex::MultiFab *> fmf;
@@ -986,11 +2924,17 @@ void AMRSimulation<problem_t>::FillPatch(int lev, amrex::Real time,
   } else {
     // in this case, should return either state_new_[lev] or state_old_[lev]
     GetData(lev, time, fmf, ftime);
-    // returns old state, new state, or both depending on 'time'
-    GetData(lev - 1, time, cmf, ctime);
+    // returns a single coarse state, either directly or time-interpolated
+    // into the per-level cache (see getCoarseDataForFill)
+    getCoarseDataForFill(lev, time, cmf, ctime);
   }
 
   FillPatchWithData(lev, time, mf, cmf, ctime, fmf, ftime, icomp, ncomp);
+
+  if (customFaceBoundaryBatch_ != 0) {
+    fillCustomBoundaryFaces(mf, icomp, ncomp, lev, time);
+  }
+  stopPhaseTimer("FillPatch", lev, phase_start);
 }
 
 // Fill an entire multifab by interpolating from the coarser level
@@ -1000,6 +2944,7 @@ void AMRSimulation<problem_t>::FillCoarsePatch(int lev, amrex::Real time,
                                                amrex::MultiFab &mf, int icomp,
                                                int ncomp) {
   BL_PROFILE("AMRSimulation::FillCoarsePatch()");
+  const amrex::Real phase_start = startPhaseTimer();
 
   AMREX_ASSERT(lev > 0);
 
@@ -1020,14 +2965,18 @@ void AMRSimulation<problem_t>::FillCoarsePatch(int lev, amrex::Real time,
       coarsePhysicalBoundaryFunctor(geom[lev - 1], boundaryConditions_,
                                     boundaryFunctor);
 
-  // use CellConservativeLinear interpolation onto fine grid
-  amrex::MFInterpolater *mapper = &amrex::mf_cell_cons_interp;
-  // amrex::MFInterpolater *mapper = &amrex::mf_pc_interp;
+  // runtime-selected MF-batched interpolation onto the fine grid
+  amrex::InterpBase *mapper = getFillPatchInterpolater();
 
   amrex::InterpFromCoarseLevel(
       mf, time, *cmf[0], 0, icomp, ncomp, geom[lev - 1], geom[lev],
       coarsePhysicalBoundaryFunctor, 0, finePhysicalBoundaryFunctor, 0,
       refRatio(lev - 1), mapper, boundaryConditions_, 0);
+
+  if (customFaceBoundaryBatch_ != 0) {
+    fillCustomBoundaryFaces(mf, icomp, ncomp, lev, time);
+  }
+  stopPhaseTimer("FillCoarsePatch", lev, phase_start);
 }
 
 // utility to copy in data from state_old_ and/or state_new_ into another
@@ -1061,6 +3010,57 @@ void AMRSimulation<problem_t>::GetData(int lev, amrex::Real time,
   }
 }
 
+// wrapper around GetData(lev - 1, ...) for coarse-fine fills: when 'time'
+// falls strictly between the coarse old and new states, the linear time
+// interpolation is done once into a persistent per-level MultiFab, and every
+// subsequent fill at the same time point reuses it. the downstream fill then
+// sees single-time coarse data and performs no time interpolation of its own.
+// (the cache is one coarse-level LinComb per unique fine time -- 2^-d of the
+// fine level's cells -- versus a patch time-interpolation inside every fill.)
+template <typename problem_t>
+void AMRSimulation<problem_t>::getCoarseDataForFill(
+    int lev, amrex::Real time, amrex::Vector<amrex::MultiFab *> &data,
+    amrex::Vector<amrex::Real> &datatime) {
+  GetData(lev - 1, time, data, datatime);
+
+  const int clev = lev - 1;
+  if (cacheCoarseTimeInterp_ == 0 || data.size() != 2) {
+    return; // no time interpolation needed (or caching disabled)
+  }
+
+  amrex::MultiFab const &coarseState = state_new_[clev];
+  amrex::MultiFab &cache = coarseInterpData_[clev];
+  const bool layoutMatches = !cache.empty() &&
+                             cache.boxArray() == coarseState.boxArray() &&
+                             cache.DistributionMap() ==
+                                 coarseState.DistributionMap();
+  const amrex::Real teps = (tNew_[clev] - tOld_[clev]) * 1.e-3;
+  const bool upToDate =
+      layoutMatches && std::abs(coarseInterpTime_[clev] - time) < teps &&
+      coarseInterpStateTimes_[clev] ==
+          std::make_pair(tOld_[clev], tNew_[clev]);
+
+  if (!upToDate) {
+    if (!layoutMatches) { // (re)allocate after a regrid or relayout
+      cache.define(coarseState.boxArray(), coarseState.DistributionMap(),
+                   coarseState.nComp(), coarseState.nGrowVect());
+    }
+    // linear interpolation in time, ghost zones included (the coarse ghost
+    // zones were filled during the coarse-level advance; the caller's asserts
+    // check them for NaNs)
+    const amrex::Real w = (time - tOld_[clev]) / (tNew_[clev] - tOld_[clev]);
+    amrex::MultiFab::LinComb(cache, 1. - w, *data[0], 0, w, *data[1], 0, 0,
+                             cache.nComp(), cache.nGrowVect());
+    coarseInterpTime_[clev] = time;
+    coarseInterpStateTimes_[clev] = std::make_pair(tOld_[clev], tNew_[clev]);
+  }
+
+  data.clear();
+  datatime.clear();
+  data.push_back(&cache);
+  datatime.push_back(time);
+}
+
 // average down on all levels
 template <typename problem_t> void AMRSimulation<problem_t>::AverageDown() {
   BL_PROFILE("AMRSimulation::AverageDown()");
@@ -1068,6 +3068,7 @@ template <typename problem_t> void AMRSimulation<problem_t>::AverageDown() {
   for (int lev = finest_level - 1; lev >= 0; --lev) {
     AverageDownTo(lev);
   }
+  averageDownDeferred_ = false;
 }
 
 // set covered coarse cells to be the average of overlying fine cells
@@ -1080,28 +3081,612 @@ void AMRSimulation<problem_t>::AverageDownTo(int crse_lev) {
                       state_new_[crse_lev].nComp(), refRatio(crse_lev));
 }
 
+// boundary shell width in coarse cells: wide enough to cover the
+// coarse cells reached by the fine-level ghost fill (nghost_ fine cells,
+// coarsened) plus the interpolation stencil
+template <typename problem_t>
+auto AMRSimulation<problem_t>::boundaryShellWidth(int crse_lev) const -> int {
+  const amrex::IntVect ratio = refRatio(crse_lev);
+  int rmin = ratio[0];
+  for (int d = 1; d < AMREX_SPACEDIM; ++d) {
+    rmin = amrex::min(rmin, ratio[d]);
+  }
+  return amrex::max(2, nghost_ / rmin + 1);
+}
+
+// the coarse cells the subcycle sync stage modifies: the reflux touches the
+// one-cell ring of coarse cells just outside each fine grid, and the
+// (boundary) average-down touches the covered cells (only the boundary shell
+// when boundaryAverageDown_ is active; the interior covered cells are then
+// refreshed lazily, see FlushDeferredAverageDown). used to restrict the
+// post-sync fixup scan to the cells that can actually have changed. the
+// returned boxes may overlap where fine grids touch; the fixup is
+// idempotent, so the duplicate scans are harmless
+template <typename problem_t>
+auto AMRSimulation<problem_t>::SyncTouchedRegion(int crse_lev) const
+    -> amrex::BoxArray {
+  const amrex::IntVect ratio = refRatio(crse_lev);
+  amrex::BoxArray const &fba = boxArray(crse_lev + 1);
+  const int width = boundaryShellWidth(crse_lev);
+  amrex::BoxList touched;
+  for (int i = 0; i < static_cast<int>(fba.size()); ++i) {
+    const amrex::Box grown = amrex::grow(amrex::coarsen(fba[i], ratio), 1);
+    if (boundaryAverageDown_ != 0) {
+      // shell written by BoundaryAverageDownTo plus the reflux ring
+      for (amrex::Box const &b :
+           amrex::boxDiff(grown, amrex::grow(grown, -(width + 1)))) {
+        touched.push_back(b);
+      }
+    } else {
+      touched.push_back(grown); // all covered cells plus the reflux ring
+    }
+  }
+  return amrex::BoxArray{std::move(touched)};
+}
+
+// average down only the covered coarse cells within a few cells of the
+// coarse-fine boundary. these are the cells the next steps actually read
+// (fine-level ghost fills and the post-reflux fixup); the interior covered
+// cells are overwritten by every full average-down and are only needed for
+// regrids and outputs, so refreshing them each subcycle sync is wasted work
+// on deep hierarchies
+template <typename problem_t>
+void AMRSimulation<problem_t>::BoundaryAverageDownTo(int crse_lev) {
+  BL_PROFILE("AMRSimulation::BoundaryAverageDownTo()");
+
+  const amrex::IntVect ratio = refRatio(crse_lev);
+  const int width = boundaryShellWidth(crse_lev);
+
+  // build the shell boxes of each coarsened fine box, keeping each shell on
+  // the rank that owns the fine data it averages
+  amrex::BoxArray const &fba = boxArray(crse_lev + 1);
+  amrex::DistributionMapping const &fdm = DistributionMap(crse_lev + 1);
+  amrex::BoxList shellBoxes;
+  amrex::Vector<int> shellProcs;
+  amrex::Vector<int> shellFineIndex; // originating fine box (global index)
+  for (int i = 0; i < static_cast<int>(fba.size()); ++i) {
+    amrex::Box const cbox = amrex::coarsen(fba[i], ratio);
+    for (amrex::Box const &b : amrex::boxDiff(cbox, amrex::grow(cbox, -width))) {
+      shellBoxes.push_back(b);
+      shellProcs.push_back(fdm[i]);
+      shellFineIndex.push_back(i);
+    }
+  }
+  if (shellBoxes.isEmpty()) {
+    return; // every fine box is thinner than 2*width coarse cells
+  }
+  amrex::BoxArray const shell_ba(std::move(shellBoxes));
+  amrex::DistributionMapping const shell_dm(std::move(shellProcs));
+
+  const int ncomp = state_new_[crse_lev].nComp();
+  amrex::MultiFab crse_fine(shell_ba, shell_dm, ncomp, 0);
+
+  // average the overlying fine cells into the shell (same kernel as
+  // amrex::average_down, restricted to the shell boxes)
+  const int ifac = ratio[0];
+  const int jfac = (AMREX_SPACEDIM >= 2) ? ratio[1] : 1;
+  const int kfac = (AMREX_SPACEDIM == 3) ? ratio[2] : 1;
+  const amrex::Real volinv =
+      amrex::Real(1.0) / static_cast<amrex::Real>(ifac * jfac * kfac);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+  for (amrex::MFIter mfi(crse_fine, amrex::TilingIfNotGPU()); mfi.isValid();
+       ++mfi) {
+    const amrex::Box &bx = mfi.tilebox();
+    auto const &crse = crse_fine.array(mfi);
+    auto const &fine =
+        state_new_[crse_lev + 1].const_array(shellFineIndex[mfi.index()]);
+    amrex::ParallelFor(
+        bx, ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+          amrex::Real sum = 0.;
+          for (int kk = 0; kk < kfac; ++kk) {
+            for (int jj = 0; jj < jfac; ++jj) {
+              for (int ii = 0; ii < ifac; ++ii) {
+                sum += fine(i * ifac + ii, j * jfac + jj, k * kfac + kk, n);
+              }
+            }
+          }
+          crse(i, j, k, n) = sum * volinv;
+        });
+  }
+
+  state_new_[crse_lev].ParallelCopy(crse_fine, 0, 0, ncomp);
+}
+
+// perform the full average-down that was skipped by the per-sync
+// boundary-restricted path (called before regrids and outputs)
+template <typename problem_t>
+void AMRSimulation<problem_t>::FlushDeferredAverageDown() {
+  if (averageDownDeferred_) {
+    const amrex::Real avgdown_start = startPhaseTimer();
+    AverageDown();
+    stopPhaseTimer("AverageDown", 0, avgdown_start);
+    // the interior covered cells were just written for the first time since
+    // their last fixup scan (the per-sync scan only covers the boundary
+    // band), so re-apply the floors before the regrid or output reads them
+    for (int lev = 0; lev < finest_level; ++lev) {
+      FixupState(lev, /*newStateOnly*/ true, /*syncRegion*/ nullptr);
+    }
+  }
+}
+
+// check a rotating subset of boxes for NaNs (runtime validation; works in
+// Release builds, where the AMREX_ASSERT contains_nan checks compile out).
+// with stride N, each box is checked once every N coarse steps, so the cost
+// is ~1/N of a full validation pass per step.
+template <typename problem_t>
+void AMRSimulation<problem_t>::checkStatesForNaNSampled(int const step) {
+  if (nanCheckStride_ <= 0) {
+    return;
+  }
+  BL_PROFILE("AMRSimulation::checkStatesForNaNSampled()");
+
+  int found = 0;
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    auto const &mf = state_new_[lev];
+    for (amrex::MFIter iter(mf); iter.isValid(); ++iter) {
+      // rotating subset: box k is checked on the steps where (k + step) is
+      // a multiple of the stride
+      if ((iter.index() + step) % nanCheckStride_ != 0) {
+        continue;
+      }
+      amrex::FArrayBox const &fab = mf[iter];
+      const amrex::Box &bx = iter.fabbox(); // include ghost zones
+      if (fab.template contains_nan<amrex::RunOn::Device>(bx, 0, mf.nComp())) {
+        // report the offending cells (device printf)
+        quokka::ReportNaN(fab, bx, mf.nComp());
+        amrex::AllPrint() << "NaN found on level " << lev << ", box "
+                          << iter.index() << " at step " << step + 1 << "\n";
+        found = 1;
+      }
+    }
+  }
+
+  // all ranks must agree before the (collective) checkpoint write
+  amrex::ParallelDescriptor::ReduceIntMax(found);
+  if (found != 0) {
+    amrex::Print() << "NaN detected by runtime validation; writing checkpoint "
+                   << "and aborting.\n";
+    WriteCheckpointFile();
+    amrex::Abort("NaN detected by runtime validation");
+  }
+}
+
 // get plotfile name
+// compute the sum of each component of mf over the entire domain, using a
+// single pass over the data and a single (vector) MPI reduction. this replaces
+// per-component MultiFab::sum() calls, which each launch their own kernel and
+// allreduce.
+template <typename problem_t>
+auto AMRSimulation<problem_t>::MultiComponentSum(amrex::MultiFab const &mf)
+    -> amrex::Vector<amrex::Real> {
+  BL_PROFILE("AMRSimulation::MultiComponentSum()");
+
+  const int ncomp = mf.nComp();
+  amrex::Vector<amrex::Real> sums(ncomp, 0.0);
+  amrex::Gpu::Buffer<amrex::Real> sums_buf(sums.data(), ncomp);
+  amrex::Real *const sums_ptr = sums_buf.data();
+
+  for (amrex::MFIter iter(mf); iter.isValid(); ++iter) {
+    auto const &state = mf.const_array(iter);
+    amrex::ParallelFor(
+        iter.validbox(), ncomp,
+        [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+          amrex::HostDevice::Atomic::Add(&sums_ptr[n], state(i, j, k, n));
+        });
+  }
+
+  amrex::Real const *const local_sums = sums_buf.copyToHost();
+  for (int n = 0; n < ncomp; ++n) {
+    sums[n] = local_sums[n];
+  }
+  amrex::ParallelDescriptor::ReduceRealSum(sums.data(), ncomp);
+  return sums;
+}
+
+namespace detail {
+// finalize the fused error-norm accumulator: one vector sum reduction over
+// the additive entries, one vector max reduction over the Linf entries, then
+// unpack (layout: [err L1 | err L2^2 | sol L1 | sol L2^2 | err Linf])
+inline auto reduceErrorNorms(amrex::Vector<amrex::Real> &accum, int ncomp)
+    -> quokka::ErrorNorms {
+  amrex::ParallelDescriptor::ReduceRealSum(accum.data(), 4 * ncomp);
+  amrex::ParallelDescriptor::ReduceRealMax(accum.data() + 4 * ncomp, ncomp);
+  quokka::ErrorNorms norms;
+  norms.L1.resize(ncomp);
+  norms.L2.resize(ncomp);
+  norms.Linf.resize(ncomp);
+  norms.sol_L1.resize(ncomp);
+  norms.sol_L2.resize(ncomp);
+  for (int n = 0; n < ncomp; ++n) {
+    norms.L1[n] = accum[n];
+    norms.L2[n] = std::sqrt(accum[ncomp + n]);
+    norms.sol_L1[n] = accum[2 * ncomp + n];
+    norms.sol_L2[n] = std::sqrt(accum[3 * ncomp + n]);
+    norms.Linf[n] = accum[4 * ncomp + n];
+  }
+  return norms;
+}
+} // namespace detail
+
+// fused device-side error norms against an analytic exact-solution functor
+// (see the declaration for the functor signature and norm conventions)
+template <typename problem_t>
+template <typename F>
+auto AMRSimulation<problem_t>::computeErrorNorms(F const &exact,
+                                                 const int ncomp)
+    -> quokka::ErrorNorms {
+  BL_PROFILE("AMRSimulation::computeErrorNorms()");
+
+  amrex::Vector<amrex::Real> accum(5 * ncomp, 0.0);
+  amrex::Gpu::Buffer<amrex::Real> accum_buf(accum.data(), 5 * ncomp);
+  amrex::Real *const p = accum_buf.data();
+  const int nc = ncomp;
+
+  for (amrex::MFIter iter(state_new_[0]); iter.isValid(); ++iter) {
+    auto const &state = state_new_[0].const_array(iter);
+    amrex::ParallelFor(
+        iter.validbox(), ncomp,
+        [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+          const amrex::Real sol = exact(i, j, k, n);
+          const amrex::Real err = state(i, j, k, n) - sol;
+          amrex::HostDevice::Atomic::Add(&p[n], std::abs(err));
+          amrex::HostDevice::Atomic::Add(&p[nc + n], err * err);
+          amrex::HostDevice::Atomic::Add(&p[2 * nc + n], std::abs(sol));
+          amrex::HostDevice::Atomic::Add(&p[3 * nc + n], sol * sol);
+          amrex::Gpu::Atomic::Max(&p[4 * nc + n], std::abs(err));
+        });
+  }
+
+  amrex::Real const *const local = accum_buf.copyToHost();
+  for (int m = 0; m < 5 * ncomp; ++m) {
+    accum[m] = local[m];
+  }
+  return detail::reduceErrorNorms(accum, ncomp);
+}
+
+// fused device-side error norms against a precomputed reference state
+// (replaces the residual-MultiFab copy and the 2*ncomp separate norm1
+// reductions of the old computeReferenceSolution_ path)
+template <typename problem_t>
+auto AMRSimulation<problem_t>::computeErrorNorms(amrex::MultiFab const &ref)
+    -> quokka::ErrorNorms {
+  BL_PROFILE("AMRSimulation::computeErrorNorms()");
+
+  const int ncomp = ref.nComp();
+  amrex::Vector<amrex::Real> accum(5 * ncomp, 0.0);
+  amrex::Gpu::Buffer<amrex::Real> accum_buf(accum.data(), 5 * ncomp);
+  amrex::Real *const p = accum_buf.data();
+  const int nc = ncomp;
+
+  for (amrex::MFIter iter(state_new_[0]); iter.isValid(); ++iter) {
+    auto const &state = state_new_[0].const_array(iter);
+    auto const &solArr = ref.const_array(iter);
+    amrex::ParallelFor(
+        iter.validbox(), ncomp,
+        [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+          const amrex::Real sol = solArr(i, j, k, n);
+          const amrex::Real err = state(i, j, k, n) - sol;
+          amrex::HostDevice::Atomic::Add(&p[n], std::abs(err));
+          amrex::HostDevice::Atomic::Add(&p[nc + n], err * err);
+          amrex::HostDevice::Atomic::Add(&p[2 * nc + n], std::abs(sol));
+          amrex::HostDevice::Atomic::Add(&p[3 * nc + n], sol * sol);
+          amrex::Gpu::Atomic::Max(&p[4 * nc + n], std::abs(err));
+        });
+  }
+
+  amrex::Real const *const local = accum_buf.copyToHost();
+  for (int m = 0; m < 5 * ncomp; ++m) {
+    accum[m] = local[m];
+  }
+  return detail::reduceErrorNorms(accum, ncomp);
+}
+
+// accumulate a weighted 2D histogram ("phase diagram") of (xvalue, yvalue)
+// over every cell not covered by a finer level. each box launches one kernel
+// that bins with device atomics into a per-rank histogram; the per-rank
+// histograms are then merged with a single vector reduction to the I/O rank.
+// weights are multiplied by the cell volume of their level, so weight ==
+// density yields a mass-weighted histogram and weight == 1 a volume-weighted
+// one. values outside the axis ranges are discarded (bin logarithmically by
+// returning log10 of the quantity from the functor). the returned histogram
+// is row-major in y (bin (ix, iy) is at index iy * nx + ix) and is only
+// complete on the I/O rank.
+template <typename problem_t>
+template <typename FX, typename FY, typename FW>
+auto AMRSimulation<problem_t>::computePhaseHistogram(
+    int nx, amrex::Real xmin, amrex::Real xmax, int ny, amrex::Real ymin,
+    amrex::Real ymax, FX const &xvalue, FY const &yvalue, FW const &weight)
+    -> amrex::Vector<amrex::Real> {
+  BL_PROFILE("AMRSimulation::computePhaseHistogram()");
+
+  const int nbins = nx * ny;
+  amrex::Vector<amrex::Real> hist(nbins, 0.0);
+  amrex::Gpu::Buffer<amrex::Real> hist_buf(hist.data(), nbins);
+  amrex::Real *const p_hist = hist_buf.data();
+
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    // mask out cells covered by a finer level, so each region of the domain
+    // is counted exactly once (at its finest available resolution)
+    const bool haveMask = (lev < finest_level);
+    amrex::iMultiFab mask;
+    if (haveMask) {
+      mask = amrex::makeFineMask(grids[lev], dmap[lev], grids[lev + 1],
+                                 refRatio(lev), 1, 0);
+    }
+    auto const dx = geom[lev].CellSizeArray();
+    const amrex::Real vol = AMREX_D_TERM(dx[0], *dx[1], *dx[2]);
+
+    for (amrex::MFIter iter(state_new_[lev]); iter.isValid(); ++iter) {
+      auto const &state = state_new_[lev].const_array(iter);
+      auto const &m =
+          haveMask ? mask.const_array(iter) : amrex::Array4<const int>{};
+      amrex::ParallelFor(
+          iter.validbox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            if (haveMask && (m(i, j, k) == 0)) {
+              return; // covered by a finer level
+            }
+            const amrex::Real x = xvalue(state, i, j, k);
+            const amrex::Real y = yvalue(state, i, j, k);
+            const int ix =
+                static_cast<int>(std::floor((x - xmin) / (xmax - xmin) *
+                                            static_cast<amrex::Real>(nx)));
+            const int iy =
+                static_cast<int>(std::floor((y - ymin) / (ymax - ymin) *
+                                            static_cast<amrex::Real>(ny)));
+            if ((ix < 0) || (ix >= nx) || (iy < 0) || (iy >= ny)) {
+              return; // out of range
+            }
+            amrex::HostDevice::Atomic::Add(&p_hist[iy * nx + ix],
+                                           weight(state, i, j, k) * vol);
+          });
+    }
+  }
+
+  amrex::Real const *const local_hist = hist_buf.copyToHost();
+  for (int n = 0; n < nbins; ++n) {
+    hist[n] = local_hist[n];
+  }
+  amrex::ParallelDescriptor::ReduceRealSum(
+      hist.data(), nbins, amrex::ParallelDescriptor::IOProcessorNumber());
+  return hist;
+}
+
+// 1D convenience wrapper: a single-axis histogram is a phase diagram with
+// one trivial y bin
+template <typename problem_t>
+template <typename FX, typename FW>
+auto AMRSimulation<problem_t>::computeVolumeHistogram(int nx, amrex::Real xmin,
+                                                      amrex::Real xmax,
+                                                      FX const &xvalue,
+                                                      FW const &weight)
+    -> amrex::Vector<amrex::Real> {
+  return computePhaseHistogram(
+      nx, xmin, xmax, 1, 0., 1., xvalue,
+      [] AMREX_GPU_DEVICE(amrex::Array4<const amrex::Real> const & /*state*/,
+                          int /*i*/, int /*j*/, int /*k*/) { return 0.5; },
+      weight);
+}
+
+// append one row of the time series '<t_new>,<values...>' to 'filename'
+// (only the I/O rank writes; pass the merged histogram returned by
+// computePhaseHistogram or computeVolumeHistogram)
+template <typename problem_t>
+void AMRSimulation<problem_t>::appendDiagnosticSeries(
+    std::string const &filename,
+    amrex::Vector<amrex::Real> const &values) const {
+  if (!amrex::ParallelDescriptor::IOProcessor()) {
+    return;
+  }
+  std::ofstream file(filename, std::ofstream::app);
+  file << fmt::format("{:.8e}", tNew_[0]);
+  for (amrex::Real const v : values) {
+    file << fmt::format(",{:.8e}", v);
+  }
+  file << "\n";
+}
+
+// begin timing an instrumented phase. the stream synchronization makes the
+// measurement meaningful on GPUs, so this is a no-op unless phase timing is
+// enabled.
+template <typename problem_t>
+auto AMRSimulation<problem_t>::startPhaseTimer() const -> amrex::Real {
+  if (!phaseTimingEnabled()) {
+    return 0.;
+  }
+  amrex::Gpu::streamSynchronize();
+  return amrex::second();
+}
+
+// accumulate the elapsed time since t_start into the (phase, lev) entry
+template <typename problem_t>
+void AMRSimulation<problem_t>::stopPhaseTimer(std::string const &phase,
+                                              int lev,
+                                              amrex::Real t_start) const {
+  if (!phaseTimingEnabled()) {
+    return;
+  }
+  amrex::Gpu::streamSynchronize();
+  auto &entry = phaseTimings_[{phase, lev}];
+  entry.first += 1;
+  entry.second += amrex::second() - t_start;
+}
+
+// write the accumulated phase timings to phaseTimingFile_ as JSON or CSV.
+// the instrumented phases are collective, so every rank has the same set of
+// keys; times are reduced to the rank-wide maximum so that load imbalance
+// shows up as time.
+template <typename problem_t>
+void AMRSimulation<problem_t>::WritePhaseTimings() const {
+  if (!phaseTimingEnabled()) {
+    return;
+  }
+
+  amrex::Vector<amrex::Real> times;
+  for (auto const &kv : phaseTimings_) {
+    times.push_back(kv.second.second);
+  }
+  amrex::ParallelDescriptor::ReduceRealMax(
+      times.data(), static_cast<int>(times.size()),
+      amrex::ParallelDescriptor::IOProcessorNumber());
+
+  if (!amrex::ParallelDescriptor::IOProcessor()) {
+    return;
+  }
+
+  const bool writeJSON =
+      (phaseTimingFile_.size() > 5) &&
+      (phaseTimingFile_.compare(phaseTimingFile_.size() - 5, 5, ".json") == 0);
+  std::ofstream file(phaseTimingFile_);
+
+  int i = 0;
+  if (writeJSON) {
+    file << "[\n";
+    for (auto const &kv : phaseTimings_) {
+      file << fmt::format(
+          "  {{\"phase\": \"{}\", \"level\": {}, \"calls\": {}, "
+          "\"seconds\": {:.6e}}}{}\n",
+          kv.first.first, kv.first.second, kv.second.first, times[i],
+          (i + 1 < static_cast<int>(times.size())) ? "," : "");
+      ++i;
+    }
+    file << "]\n";
+  } else {
+    file << "phase,level,calls,seconds\n";
+    for (auto const &kv : phaseTimings_) {
+      file << fmt::format("{},{},{},{:.6e}\n", kv.first.first,
+                          kv.first.second, kv.second.first, times[i]);
+      ++i;
+    }
+  }
+}
+
+// accumulate a host<->device staging copy into the transfer audit. 'bytes'
+// is the global (all-rank) volume of the copy, so no reduction is needed
+// when writing the report.
+template <typename problem_t>
+void AMRSimulation<problem_t>::recordTransfer(std::string const &phase,
+                                              amrex::Long bytes) const {
+  if (!transferAuditEnabled()) {
+    return;
+  }
+  auto &entry = transferBytes_[phase];
+  entry.first += 1;
+  entry.second += bytes;
+}
+
+// write the accumulated host<->device transfer audit to transferAuditFile_
+// as JSON or CSV. phases whose per-step volume is a significant fraction of
+// the state footprint are flagged: their transfer cost grows with the
+// problem size, so they dominate at scale even if each copy looks cheap in
+// a small test.
+template <typename problem_t>
+void AMRSimulation<problem_t>::WriteTransferAudit() const {
+  if (!transferAuditEnabled()) {
+    return;
+  }
+  if (!amrex::ParallelDescriptor::IOProcessor()) {
+    return;
+  }
+
+  amrex::Long stateBytes = 0;
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    stateBytes += getLevelStateBytes(lev);
+  }
+  const int nsteps = std::max(istep[0], 1);
+
+  const bool writeJSON =
+      (transferAuditFile_.size() > 5) &&
+      (transferAuditFile_.compare(transferAuditFile_.size() - 5, 5, ".json") ==
+       0);
+  std::ofstream file(transferAuditFile_);
+
+  int i = 0;
+  if (writeJSON) {
+    file << "[\n";
+    for (auto const &kv : transferBytes_) {
+      const amrex::Long perStep = kv.second.second / nsteps;
+      const bool scales = (perStep * 10 >= stateBytes); // >= 10% of the state
+      file << fmt::format(
+          "  {{\"phase\": \"{}\", \"copies\": {}, \"bytes\": {}, "
+          "\"bytes_per_step\": {}, \"scales_with_problem_size\": {}}}{}\n",
+          kv.first, kv.second.first, kv.second.second, perStep,
+          scales ? "true" : "false",
+          (i + 1 < static_cast<int>(transferBytes_.size())) ? "," : "");
+      ++i;
+    }
+    file << "]\n";
+  } else {
+    file << "phase,copies,bytes,bytes_per_step,scales_with_problem_size\n";
+    for (auto const &kv : transferBytes_) {
+      const amrex::Long perStep = kv.second.second / nsteps;
+      const bool scales = (perStep * 10 >= stateBytes);
+      file << fmt::format("{},{},{},{},{}\n", kv.first, kv.second.first,
+                          kv.second.second, perStep, scales ? 1 : 0);
+    }
+  }
+}
+
 template <typename problem_t>
 auto AMRSimulation<problem_t>::PlotFileName(int lev) const -> std::string {
   return amrex::Concatenate(plot_file, lev, 5);
 }
 
+// compute the state component indices to write to plotfiles
+// (all components unless a subset is requested via plotfile_vars)
+template <typename problem_t>
+auto AMRSimulation<problem_t>::PlotFileComponents() const
+    -> amrex::Vector<int> {
+  amrex::Vector<int> comps;
+  if (plotfileVars_.empty()) {
+    for (int i = 0; i < static_cast<int>(componentNames_.size()); ++i) {
+      comps.push_back(i);
+    }
+  } else {
+    for (auto const &name : plotfileVars_) {
+      auto it = std::find(componentNames_.begin(), componentNames_.end(), name);
+      if (it == componentNames_.end()) {
+        amrex::Abort("Unknown state component in plotfile_vars: " + name);
+      }
+      comps.push_back(static_cast<int>(it - componentNames_.begin()));
+    }
+  }
+  return comps;
+}
+
 template <typename problem_t>
 auto AMRSimulation<problem_t>::PlotFileMFAtLevel(int lev) const
     -> amrex::MultiFab {
-  // Combine state_new_[lev] and derived variables in a new MF
+  // Combine the requested state components and derived variables in a new MF
   int comp = 0;
   const int nGrow = 0;
-  const int nCompState = state_new_[lev].nComp();
+  const amrex::Vector<int> stateComps = PlotFileComponents();
+  const int nCompState = stateComps.size();
   const int nCompDeriv = derivedNames_.size();
   const int nCompPlotMF = nCompState + nCompDeriv;
   amrex::MultiFab plotMF(grids[lev], dmap[lev], nCompPlotMF, nGrow);
 
-  // Copy data from state variables
-  for (int i = 0; i < nCompState; i++) {
-    amrex::MultiFab::Copy(plotMF, state_new_[lev], i, comp, 1, nGrow);
-    comp++;
+  // gather all requested state components in a single fused kernel per box
+  // (one MultiFab::Copy per component traverses the level nCompState times)
+  amrex::Gpu::DeviceVector<int> stateCompsDev(nCompState);
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, stateComps.begin(),
+                        stateComps.end(), stateCompsDev.begin());
+  recordTransfer("PlotFileMF(h2d)",
+                 static_cast<amrex::Long>(amrex::ParallelDescriptor::NProcs()) *
+                     nCompState * static_cast<amrex::Long>(sizeof(int)));
+  const int *const comps = stateCompsDev.data();
+  for (amrex::MFIter iter(plotMF); iter.isValid(); ++iter) {
+    const amrex::Box &indexRange = iter.validbox();
+    auto const &dest = plotMF.array(iter);
+    auto const &src = state_new_[lev].const_array(iter);
+    amrex::ParallelFor(indexRange, nCompState,
+                       [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+                         dest(i, j, k, n) = src(i, j, k, comps[n]);
+                       });
   }
+  amrex::Gpu::streamSynchronize(); // 'stateCompsDev' must outlive the kernels
+  comp += nCompState;
 
   // Compute derived vars
   for (auto const &dname : derivedNames_) {
@@ -1109,22 +3694,138 @@ auto AMRSimulation<problem_t>::PlotFileMFAtLevel(int lev) const
     comp++;
   }
 
+  if (plotfileFloat32_ != 0) {
+    // round to the nearest float32 in place. the plotfile container stores
+    // native Reals, so this does not shrink the raw file by itself, but the
+    // zeroed mantissa bits compress away under plotfile_compression.
+    for (amrex::MFIter iter(plotMF); iter.isValid(); ++iter) {
+      const amrex::Box &indexRange = iter.validbox();
+      auto const &data = plotMF.array(iter);
+      amrex::ParallelFor(indexRange, nCompPlotMF,
+                         [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+                           data(i, j, k, n) = static_cast<amrex::Real>(
+                               static_cast<float>(data(i, j, k, n)));
+                         });
+    }
+  }
+
   return plotMF;
 }
 
-// put together an array of multifabs for writing
+// box-staged variant of PlotFileMFAtLevel: the plot MultiFab is allocated in
+// pinned host memory and filled one box at a time through a device scratch
+// FAB, so the device-side transient is a single box (plus one component for
+// the derived fields) instead of a full duplicate of the level. the pinned
+// result is also directly consumable by the AsyncOut background thread,
+// which otherwise needs its own staging copy.
 template <typename problem_t>
-auto AMRSimulation<problem_t>::PlotFileMF() const
+auto AMRSimulation<problem_t>::PlotFileMFAtLevelBoxStaged(int lev) const
+    -> amrex::MultiFab {
+  const int nGrow = 0;
+  const amrex::Vector<int> stateComps = PlotFileComponents();
+  const int nCompState = stateComps.size();
+  const int nCompDeriv = derivedNames_.size();
+  const int nCompPlotMF = nCompState + nCompDeriv;
+  amrex::MultiFab plotMF(grids[lev], dmap[lev], nCompPlotMF, nGrow,
+                         amrex::MFInfo().SetArena(amrex::The_Pinned_Arena()));
+
+  // gather the requested state components one box at a time: fused gather
+  // kernel into the scratch FAB, then a d2h copy of that box into the
+  // pinned plot MultiFab. the per-box synchronize is what bounds the
+  // device-side footprint (the scratch cannot be reused before the copy
+  // from it completes).
+  amrex::Gpu::DeviceVector<int> stateCompsDev(nCompState);
+  amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, stateComps.begin(),
+                        stateComps.end(), stateCompsDev.begin());
+  const int *const comps = stateCompsDev.data();
+  const int float32 = plotfileFloat32_;
+  amrex::FArrayBox scratch; // device memory in GPU builds
+  for (amrex::MFIter iter(plotMF); iter.isValid(); ++iter) {
+    const amrex::Box &indexRange = iter.validbox();
+    scratch.resize(indexRange, nCompState);
+    auto const &dest = scratch.array();
+    auto const &src = state_new_[lev].const_array(iter);
+    amrex::ParallelFor(indexRange, nCompState,
+                       [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+                         amrex::Real val = src(i, j, k, comps[n]);
+                         if (float32 != 0) {
+                           val = static_cast<amrex::Real>(
+                               static_cast<float>(val));
+                         }
+                         dest(i, j, k, n) = val;
+                       });
+    // the state components occupy the first nCompState components of the
+    // (component-major) FAB, so one contiguous copy moves the whole box
+    amrex::Gpu::copyAsync(amrex::Gpu::deviceToHost, scratch.dataPtr(),
+                          scratch.dataPtr() + scratch.size(),
+                          plotMF[iter].dataPtr());
+    amrex::Gpu::streamSynchronize();
+  }
+  recordTransfer("PlotFileMF(d2h)", globalBytes(plotMF));
+
+  // derived fields: ComputeDerivedVar is a whole-level virtual, so stage
+  // these through a one-component device MultiFab (a 1/nComp-sized
+  // transient) and copy each into its pinned destination component
+  if (nCompDeriv > 0) {
+    amrex::MultiFab derivMF(grids[lev], dmap[lev], 1, nGrow);
+    int comp = nCompState;
+    for (auto const &dname : derivedNames_) {
+      ComputeDerivedVar(lev, dname, derivMF, 0);
+      if (float32 != 0) {
+        for (amrex::MFIter iter(derivMF); iter.isValid(); ++iter) {
+          const amrex::Box &indexRange = iter.validbox();
+          auto const &data = derivMF.array(iter);
+          amrex::ParallelFor(indexRange,
+                             [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                               data(i, j, k) = static_cast<amrex::Real>(
+                                   static_cast<float>(data(i, j, k)));
+                             });
+        }
+      }
+      amrex::dtoh_memcpy(plotMF, derivMF, 0, comp, 1);
+      ++comp;
+    }
+    amrex::Gpu::streamSynchronize();
+  }
+
+  return plotMF;
+}
+
+// put together an array of multifabs for writing (levels 0..maxLevel)
+template <typename problem_t>
+auto AMRSimulation<problem_t>::PlotFileMF(const int maxLevel) const
     -> amrex::Vector<amrex::MultiFab> {
   amrex::Vector<amrex::MultiFab> r;
-  for (int i = 0; i <= finest_level; ++i) {
-    r.push_back(PlotFileMFAtLevel(i));
+  for (int i = 0; i <= maxLevel; ++i) {
+    r.push_back((plotfileBoxStaging_ != 0) ? PlotFileMFAtLevelBoxStaged(i)
+                                           : PlotFileMFAtLevel(i));
   }
   return r;
 }
 
 // do in-situ rendering with Ascent
 #ifdef AMREX_USE_ASCENT
+// open Ascent on first use, so runs that never render (e.g. short debugging
+// runs with plotfiles disabled) do not pay its startup cost.
+// N.B.: must be called from the main thread -- Ascent initializes MPI
+// resources, which cannot happen on the async render helper thread.
+template <typename problem_t> void AMRSimulation<problem_t>::EnsureAscentOpen() {
+  if (!ascentOpened_) {
+    BL_PROFILE("AMRSimulation::EnsureAscentOpen()");
+    conduit::Node ascent_options;
+#ifdef AMREX_USE_MPI
+    // hand Ascent its own duplicated communicator: the async render thread
+    // runs MPI collectives inside Ascent while the main thread keeps
+    // exchanging ghost cells, and message tags are only ordered per
+    // communicator
+    MPI_Comm_dup(amrex::ParallelContext::CommunicatorSub(), &ascentComm_);
+    ascent_options["mpi_comm"] = MPI_Comm_c2f(ascentComm_);
+#endif
+    ascent_.open(ascent_options);
+    ascentOpened_ = true;
+  }
+}
+
 template <typename problem_t>
 void AMRSimulation<problem_t>::AscentCustomRender(
     conduit::Node const &blueprintMesh, std::string const &plotfilename) {
@@ -1154,33 +3855,106 @@ void AMRSimulation<problem_t>::AscentCustomRender(
   ascent_.publish(blueprintMesh);
   ascent_.execute(actions); // will be replaced by ascent_actions.yml if present
 }
+
+// wait for an in-flight asynchronous Ascent render to complete. this is the
+// completion fence called before publishing the next mesh (so the staging
+// copies can be safely replaced) and before closing Ascent.
+template <typename problem_t>
+void AMRSimulation<problem_t>::FinishAscentRender() {
+  if (ascentThread_.joinable()) {
+    BL_PROFILE("AMRSimulation::FinishAscentRender()");
+    ascentThread_.join();
+  }
+}
 #endif
 
 // write plotfile to disk
 template <typename problem_t> void AMRSimulation<problem_t>::WritePlotFile() {
   BL_PROFILE("AMRSimulation::WritePlotFile()");
+  QUOKKA_PROFILE_RANGE("IO::plotfile");
 
-#ifndef AMREX_USE_HDF5
-  if (amrex::AsyncOut::UseAsyncOut()) {
-    // ensure that we flush any plotfiles that are currently being written
-    amrex::AsyncOut::Finish();
+  // refresh the interior covered coarse cells if the per-sync average-down
+  // was restricted to the coarse-fine boundary region
+  FlushDeferredAverageDown();
+
+  // the streaming engine replaces the plotfile directory tree entirely
+  // (including in-situ rendering) when selected
+  if (!streamingOutputFile_.empty()) {
+    WriteStreamingOutput();
+    return;
   }
-#endif
+
+  const amrex::Real phase_start = startPhaseTimer();
+  const amrex::Real stall_start = amrex::second();
+
+  // ensure that we flush any plotfiles that are currently being written
+  // (and only then release the staging data they reference)
+  FinishAsyncPlotfile();
 
   // now construct output and submit to async write queue
   const std::string &plotfilename = PlotFileName(istep[0]);
-  amrex::Vector<amrex::MultiFab> mf = PlotFileMF();
+  int nlevels = finest_level + 1;
+  if (plotfileMaxLevel_ >= 0) { // cap the finest level written
+    nlevels = std::min(nlevels, plotfileMaxLevel_ + 1);
+  }
+  amrex::Vector<amrex::MultiFab> mf = PlotFileMF(nlevels - 1);
+  amrex::Vector<amrex::Geometry> outGeom(Geom().begin(),
+                                         Geom().begin() + nlevels);
+
+  if (plotfileCoarsen_ > 1) {
+    // single uniformly-coarsened preview: level 0 already holds the
+    // averaged-down fine data (FlushDeferredAverageDown above), so one more
+    // average_down by the preview factor gives a coarsen^d-cheaper dump
+    const int r = plotfileCoarsen_;
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
+        geom[0].Domain().coarsenable(r),
+        "plotfile_coarsen must evenly divide the level-0 domain");
+    amrex::MFInfo previewInfo;
+    if (plotfileBoxStaging_ != 0) {
+      // keep the preview in pinned host memory too, since the box-staged
+      // path skips the AsyncOut staging copy below
+      previewInfo.SetArena(amrex::The_Pinned_Arena());
+    }
+    amrex::MultiFab preview(amrex::coarsen(grids[0], r), dmap[0],
+                            mf[0].nComp(), 0, previewInfo);
+    amrex::average_down(mf[0], preview, 0, mf[0].nComp(), r);
+    mf.clear();
+    mf.push_back(std::move(preview));
+    nlevels = 1;
+    amrex::Geometry previewGeom = geom[0];
+    previewGeom.Domain(amrex::coarsen(geom[0].Domain(), r));
+    outGeom = {previewGeom};
+  }
+
+#ifdef AMREX_USE_GPU
+  if (amrex::AsyncOut::UseAsyncOut() && plotfileBoxStaging_ == 0) {
+    // the AsyncOut background thread cannot read device memory, so stage the
+    // plotfile data in pinned host memory before submitting the write (the
+    // box-staged assembly path already produced pinned host data)
+    for (int i = 0; i < mf.size(); ++i) {
+      amrex::MultiFab hostmf(mf[i].boxArray(), mf[i].DistributionMap(),
+                             mf[i].nComp(), 0,
+                             amrex::MFInfo().SetArena(amrex::The_Pinned_Arena()));
+      amrex::dtoh_memcpy(hostmf, mf[i]);
+      recordTransfer("WritePlotFile(d2h)", globalBytes(hostmf));
+      mf[i] = std::move(hostmf);
+    }
+    amrex::Gpu::streamSynchronize();
+  }
+#endif
+
   amrex::Vector<const amrex::MultiFab *> mf_ptr = amrex::GetVecOfConstPtrs(mf);
 
   amrex::Vector<std::string> varnames;
-  varnames.insert(varnames.end(), componentNames_.begin(),
-                  componentNames_.end());
+  for (int i : PlotFileComponents()) {
+    varnames.push_back(componentNames_[i]);
+  }
   varnames.insert(varnames.end(), derivedNames_.begin(), derivedNames_.end());
 
 #ifdef AMREX_USE_ASCENT
   // rescale geometry
   // (Ascent fails to render if you use parsec-size boxes in units of cm...)
-  amrex::Vector<amrex::Geometry> rescaledGeom = Geom();
+  amrex::Vector<amrex::Geometry> rescaledGeom = outGeom;
   const amrex::Real length = geom[0].ProbLength(0);
   for (int i = 0; i < rescaledGeom.size(); ++i) {
     auto const &dlo = rescaledGeom[i].ProbLoArray();
@@ -1195,25 +3969,166 @@ template <typename problem_t> void AMRSimulation<problem_t>::WritePlotFile() {
     rescaledGeom[i].ProbDomain(rescaledRealBox);
   }
 
-  // wrap MultiFabs into a Blueprint mesh
-  conduit::Node blueprintMesh;
-  amrex::MultiLevelToBlueprint(finest_level + 1, mf_ptr, varnames, rescaledGeom,
-                               tNew_[0], istep, refRatio(), blueprintMesh);
-  // pass Blueprint mesh to Ascent
-  AscentCustomRender(blueprintMesh, plotfilename);
+  EnsureAscentOpen();
+
+  if (asyncAscent_ == 0) {
+    // wrap MultiFabs into a Blueprint mesh
+    conduit::Node blueprintMesh;
+    amrex::MultiLevelToBlueprint(nlevels, mf_ptr, varnames, rescaledGeom,
+                                 tNew_[0], istep, refRatio(), blueprintMesh);
+    // pass Blueprint mesh to Ascent
+    AscentCustomRender(blueprintMesh, plotfilename);
+  } else {
+    // double-buffered, off-thread render: wait for the previous render to
+    // finish, snapshot the plot MultiFabs into host staging copies, wrap
+    // those (the Blueprint mesh references the FAB data zero-copy), and run
+    // publish+execute from a helper thread so the raytrace overlaps the
+    // next simulation steps.
+    // N.B.: every rank participates in the render, which communicates on
+    // Ascent's duplicated communicator (see EnsureAscentOpen); the required
+    // MPI_THREAD_MULTIPLE support is asserted in readParameters.
+    FinishAscentRender();
+    ascentStaging_.clear();
+    ascentStaging_.resize(mf.size());
+    for (int i = 0; i < mf.size(); ++i) {
+      ascentStaging_[i].define(
+          mf[i].boxArray(), mf[i].DistributionMap(), mf[i].nComp(), 0,
+          amrex::MFInfo().SetArena(amrex::The_Pinned_Arena()));
+      amrex::dtoh_memcpy(ascentStaging_[i], mf[i]);
+      recordTransfer("AscentRender(d2h)", globalBytes(ascentStaging_[i]));
+    }
+    amrex::Gpu::streamSynchronize();
+
+    amrex::Vector<const amrex::MultiFab *> staged_ptr =
+        amrex::GetVecOfConstPtrs(ascentStaging_);
+    ascentMesh_.reset();
+    amrex::MultiLevelToBlueprint(nlevels, staged_ptr, varnames, rescaledGeom,
+                                 tNew_[0], istep, refRatio(), ascentMesh_);
+    ascentThread_ = std::thread([this, plotfilename]() {
+      AscentCustomRender(ascentMesh_, plotfilename);
+    });
+  }
 #endif
 
   // write plotfile
   amrex::Print() << "Writing plotfile " << plotfilename << "\n";
 
 #ifdef AMREX_USE_HDF5
-  amrex::WriteMultiLevelPlotfileHDF5(plotfilename, finest_level + 1, mf_ptr,
-                                     varnames, Geom(), tNew_[0], istep,
-                                     refRatio());
+  amrex::WriteMultiLevelPlotfileHDF5(plotfilename, nlevels, mf_ptr, varnames,
+                                     outGeom, tNew_[0], istep, refRatio(),
+                                     plotfileCompression_);
 #else
-  amrex::WriteMultiLevelPlotfile(plotfilename, finest_level + 1, mf_ptr,
-                                 varnames, Geom(), tNew_[0], istep, refRatio());
+  amrex::WriteMultiLevelPlotfile(plotfilename, nlevels, mf_ptr, varnames,
+                                 outGeom, tNew_[0], istep, refRatio());
+
+  if (amrex::AsyncOut::UseAsyncOut()) {
+    // AsyncOut queues the FAB writes on a background thread but does not
+    // snapshot the data, so the plotfile MultiFabs must remain alive until
+    // the next AsyncOut::Finish(). (letting them go out of scope here was
+    // what made AsyncOut corrupt plotfiles previously.) moving them does not
+    // relocate the FAB data, so the queued writes remain valid.
+    plotMFStaging_ = std::move(mf);
+  }
 #endif
+
+  outputStallSeconds_ += amrex::second() - stall_start;
+  stopPhaseTimer("WritePlotFile", -1, phase_start);
+}
+
+// streaming output engine: append one snapshot of the plot data to a single
+// append-only file per rank ('<prefix>.<rank>'), with a text index
+// ('<prefix>.<rank>.idx') recording one '<step> <time> <offset> <length>'
+// line per snapshot so post-processing tools can seek to any step without
+// scanning. each snapshot is a binary record of this rank's FABs:
+//   int32 step, float64 time, int32 nlevels, then per level
+//   int32 nfabs, and per FAB int32 lo[3], int32 hi[3], int32 ncomp,
+//   int64 npts, float64 data[npts * ncomp] (component-major).
+// the component names are written once to '<prefix>.components'. unlike the
+// plotfile path, this creates no per-dump directories, headers, or small
+// files, so high-cadence dumps become sequential appends on each rank.
+template <typename problem_t>
+void AMRSimulation<problem_t>::WriteStreamingOutput() {
+  BL_PROFILE("AMRSimulation::WriteStreamingOutput()");
+  const amrex::Real phase_start = startPhaseTimer();
+  const amrex::Real stall_start = amrex::second();
+
+  amrex::Vector<amrex::MultiFab> mf = PlotFileMF(finest_level);
+
+#ifdef AMREX_USE_GPU
+  // the record is written with host file I/O, so stage the plot data in
+  // pinned host memory first
+  for (int i = 0; i < mf.size(); ++i) {
+    amrex::MultiFab hostmf(mf[i].boxArray(), mf[i].DistributionMap(),
+                           mf[i].nComp(), 0,
+                           amrex::MFInfo().SetArena(amrex::The_Pinned_Arena()));
+    amrex::dtoh_memcpy(hostmf, mf[i]);
+    recordTransfer("WriteStreamingOutput(d2h)", globalBytes(hostmf));
+    mf[i] = std::move(hostmf);
+  }
+  amrex::Gpu::streamSynchronize();
+#endif
+
+  // write the component names once per run
+  if (amrex::ParallelDescriptor::IOProcessor() && istep[0] == 0) {
+    std::ofstream components(streamingOutputFile_ + ".components");
+    for (int i : PlotFileComponents()) {
+      components << componentNames_[i] << "\n";
+    }
+    for (auto const &dname : derivedNames_) {
+      components << dname << "\n";
+    }
+  }
+
+  const std::string datafilename = fmt::format(
+      "{}.{:05d}", streamingOutputFile_, amrex::ParallelDescriptor::MyProc());
+  std::ofstream data(datafilename, std::ofstream::app |
+                                       std::ofstream::binary);
+  if (!data.good()) {
+    amrex::FileOpenFailed(datafilename);
+  }
+  const auto offset = static_cast<amrex::Long>(data.tellp());
+
+  auto writeBin = [&data](auto const &v) {
+    data.write(reinterpret_cast<char const *>(&v), sizeof(v)); // NOLINT
+  };
+
+  const int step = istep[0];
+  const double time = tNew_[0];
+  const int nlevels = finest_level + 1;
+  writeBin(step);
+  writeBin(time);
+  writeBin(nlevels);
+
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    const int nfabs = static_cast<int>(mf[lev].local_size());
+    writeBin(nfabs);
+    for (amrex::MFIter iter(mf[lev]); iter.isValid(); ++iter) {
+      const amrex::Box &bx = iter.validbox();
+      const auto lo = amrex::lbound(bx);
+      const auto hi = amrex::ubound(bx);
+      const int ncomp = mf[lev].nComp();
+      const auto npts = static_cast<amrex::Long>(bx.numPts());
+      writeBin(lo.x);
+      writeBin(lo.y);
+      writeBin(lo.z);
+      writeBin(hi.x);
+      writeBin(hi.y);
+      writeBin(hi.z);
+      writeBin(ncomp);
+      writeBin(npts);
+      amrex::FArrayBox const &fab = mf[lev][iter];
+      data.write(reinterpret_cast<char const *>(fab.dataPtr()), // NOLINT
+                 static_cast<std::streamsize>(npts * ncomp * sizeof(double)));
+    }
+  }
+  const auto length = static_cast<amrex::Long>(data.tellp()) - offset;
+  data.close();
+
+  std::ofstream index(datafilename + ".idx", std::ofstream::app);
+  index << fmt::format("{} {:.17e} {} {}\n", step, time, offset, length);
+
+  outputStallSeconds_ += amrex::second() - stall_start;
+  stopPhaseTimer("WriteStreamingOutput", -1, phase_start);
 }
 
 template <typename problem_t>
@@ -1233,9 +4148,76 @@ void AMRSimulation<problem_t>::SetLastCheckpointSymlink(
   }
 }
 
+// apply the configured Lustre striping to a freshly-created checkpoint
+// directory tree. striping is inherited by files at creation time, so this
+// must run after the directories exist but before any rank creates files in
+// them. a failed 'lfs' invocation (e.g. not a Lustre filesystem) only costs
+// a warning -- the checkpoint itself is unaffected.
+template <typename problem_t>
+void AMRSimulation<problem_t>::ApplyCheckpointStriping(
+    std::string const &checkpointname, const int nlevels) const {
+  if (!amrex::ParallelDescriptor::IOProcessor()) {
+    return;
+  }
+
+  std::string stripeArgs = fmt::format("-c {}", checkpointStripeCount_);
+  if (checkpointStripeSizeMB_ > 0) {
+    stripeArgs += fmt::format(" -S {}m", checkpointStripeSizeMB_);
+  }
+
+  // the Level_* subdirectories already exist, so the (non-inheriting)
+  // striping must be set on each of them as well as on the root
+  amrex::Vector<std::string> dirs = {checkpointname};
+  for (int lev = 0; lev < nlevels; ++lev) {
+    dirs.push_back(fmt::format("{}/Level_{}", checkpointname, lev));
+  }
+  for (std::string const &dir : dirs) {
+    const std::string cmd =
+        fmt::format("lfs setstripe {} {}", stripeArgs, dir);
+    if (std::system(cmd.c_str()) != 0) { // NOLINT
+      amrex::Print() << "WARNING: '" << cmd
+                     << "' failed; writing with default striping.\n";
+      break; // the remaining directories will fail in the same way
+    }
+  }
+}
+
+// re-tune the checkpoint step interval from the measured write cost and the
+// smoothed per-step compute time: the smallest interval whose I/O overhead
+// stays below checkpointOverheadPct_ percent also bounds the work at risk
+// between checkpoints at (100 / pct) times the write cost. called after
+// every write, so the cadence follows AMR growth (which raises both the
+// write cost and the step time). with asyncCheckpoint_, the measured cost is
+// the blocking staging portion only, which is what the step loop actually
+// pays. both inputs are max-reduced so every rank picks the same interval.
+template <typename problem_t>
+void AMRSimulation<problem_t>::retuneCheckpointInterval(
+    const amrex::Real chkSeconds) {
+  amrex::Real costs[2] = {chkSeconds, stepWalltimeEwma_};
+  if (std::isnan(costs[1])) {
+    return; // no step has completed yet (e.g. the init-time checkpoint)
+  }
+  amrex::ParallelDescriptor::ReduceRealMax(costs, 2);
+  if (costs[0] <= 0. || costs[1] <= 0.) {
+    return;
+  }
+  const amrex::Real target = checkpointOverheadPct_ / 100.;
+  const int interval = std::max(
+      1, static_cast<int>(std::ceil(costs[0] / (target * costs[1]))));
+  if (interval != checkpointInterval_) {
+    amrex::Print() << "Auto-tuned checkpoint interval: " << checkpointInterval_
+                   << " -> " << interval << " steps (write cost " << costs[0]
+                   << " s, step cost " << costs[1] << " s)\n";
+    checkpointInterval_ = interval;
+  }
+}
+
 template <typename problem_t>
 void AMRSimulation<problem_t>::WriteCheckpointFile() const {
   BL_PROFILE("AMRSimulation::WriteCheckpointFile()");
+  QUOKKA_PROFILE_RANGE("IO::checkpoint");
+  const amrex::Real phase_start = startPhaseTimer();
+  const amrex::Real stall_start = amrex::second();
 
   // chk00010            write a checkpoint file with this root directory
   // chk00010/Header     this contains information you need to save (e.g.,
@@ -1246,6 +4228,9 @@ void AMRSimulation<problem_t>::WriteCheckpointFile() const {
   // etc.                these subdirectories will hold the MultiFab data at
   // each level of refinement
 
+  // wait for the previous asynchronous checkpoint (if any) to finish
+  FinishCheckpoint();
+
   // checkpoint file name, e.g., chk00010
   const std::string &checkpointname = amrex::Concatenate(chk_file, istep[0]);
 
@@ -1253,6 +4238,36 @@ void AMRSimulation<problem_t>::WriteCheckpointFile() const {
 
   const int nlevels = finest_level + 1;
 
+  // decide which levels get fresh data in this checkpoint. in incremental
+  // mode (checkpoint_coarse_interval > 1), coarse levels are rewritten only
+  // in every chkCoarseInterval_-th checkpoint, or when their BoxArray has
+  // changed since they were last written; in between, the Header references
+  // the previous dump that holds their data (which must therefore be kept
+  // on disk for as long as a later checkpoint points at it). the finest
+  // level is always written. N.B.: on restart, the skipped coarse levels
+  // resume from their last-written (slightly older) state, which is an
+  // acceptable approximation only because refluxing and averaging-down keep
+  // them slaved to the fine levels wherever refinement exists.
+  chkLevelLocation_.resize(nlevels);
+  chkLevelBoxArray_.resize(nlevels);
+  amrex::Vector<int> writeLevel(nlevels, 1);
+  if (chkCoarseInterval_ > 1 &&
+      (checkpointCount_ % chkCoarseInterval_ != 0)) {
+    for (int lev = 0; lev < finest_level; ++lev) {
+      if (!chkLevelLocation_[lev].empty() &&
+          boxArray(lev) == chkLevelBoxArray_[lev]) {
+        writeLevel[lev] = 0;
+      }
+    }
+  }
+  ++checkpointCount_;
+  for (int lev = 0; lev < nlevels; ++lev) {
+    if (writeLevel[lev] != 0) {
+      chkLevelLocation_[lev] = checkpointname;
+      chkLevelBoxArray_[lev] = boxArray(lev);
+    }
+  }
+
   // ---- prebuild a hierarchy of directories
   // ---- dirName is built first.  if dirName exists, it is renamed.  then build
   // ---- dirName/subDirPrefix_0 .. dirName/subDirPrefix_nlevels-1
@@ -1261,6 +4276,13 @@ void AMRSimulation<problem_t>::WriteCheckpointFile() const {
   // ---- ParallelDescriptor::IOProcessor() creates the directories
   amrex::PreBuildDirectorHierarchy(checkpointname, "Level_", nlevels, true);
 
+  // set the Lustre striping of the new directories before any rank creates
+  // files in them (the barrier orders the 'lfs' calls before the writes)
+  if (checkpointStripeCount_ > 0) {
+    ApplyCheckpointStriping(checkpointname, nlevels);
+    amrex::ParallelDescriptor::Barrier();
+  }
+
   // write Header file
   if (amrex::ParallelDescriptor::IOProcessor()) {
 
@@ -1301,22 +4323,105 @@ void AMRSimulation<problem_t>::WriteCheckpointFile() const {
     }
     HeaderFile << "\n";
 
-    // write the BoxArray at each level
+    // write the BoxArray and DistributionMapping at each level. the
+    // processor map lets a restart on the same number of ranks reuse the
+    // original distribution, so VisMF::Read reads each FAB on the rank
+    // that owns it instead of shuffling data between ranks.
     for (int lev = 0; lev <= finest_level; ++lev) {
       boxArray(lev).writeOn(HeaderFile);
       HeaderFile << '\n';
+      HeaderFile << "DM: " << amrex::ParallelDescriptor::NProcs();
+      for (int const rank : DistributionMap(lev).ProcessorMap()) {
+        HeaderFile << ' ' << rank;
+      }
+      HeaderFile << '\n';
+      // the checkpoint directory holding this level's data (an earlier
+      // dump, for coarse levels skipped by incremental checkpointing)
+      HeaderFile << "LevelDir: " << chkLevelLocation_[lev] << '\n';
     }
   }
 
-  // write the MultiFab data to, e.g., chk00010/Level_0/
-  for (int lev = 0; lev <= finest_level; ++lev) {
-    amrex::VisMF::Write(
-        state_new_[lev],
-        amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "Cell"));
+  if (asyncCheckpoint_ == 0) {
+    // write the MultiFab data to, e.g., chk00010/Level_0/
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      if (writeLevel[lev] == 0) {
+        continue; // the Header references the previous dump for this level
+      }
+      amrex::VisMF::Write(
+          state_new_[lev],
+          amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "Cell"));
+    }
+
+    // create symlink and point it at this checkpoint dir
+    SetLastCheckpointSymlink(checkpointname);
+  } else {
+    // asynchronous, double-buffered write: snapshot state_new_ into a
+    // host-side staging copy and hand each level to VisMF::AsyncWrite,
+    // which performs all MPI aggregation on this thread and queues only the
+    // file I/O (with the staging FABs moved into the queue) on the AsyncOut
+    // background thread. no MPI is ever issued concurrently with the time
+    // loop, so this is safe at any MPI thread level; actual overlap
+    // requires amrex.async_out=1, without which the queued work runs
+    // synchronously here. FinishCheckpoint() (called above) ensures at most
+    // one checkpoint is in flight at a time.
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      if (writeLevel[lev] == 0) {
+        continue; // the Header references the previous dump for this level
+      }
+      amrex::MultiFab staging(
+          boxArray(lev), DistributionMap(lev), state_new_[lev].nComp(), 0,
+          amrex::MFInfo().SetArena(amrex::The_Pinned_Arena()));
+      amrex::dtoh_memcpy(staging, state_new_[lev], 0, 0,
+                         state_new_[lev].nComp());
+      recordTransfer("WriteCheckpointFile(d2h)", globalBytes(staging));
+      amrex::Gpu::streamSynchronize();
+      amrex::VisMF::AsyncWrite(
+          std::move(staging),
+          amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_",
+                                        "Cell"));
+    }
+    // queue the symlink update behind this rank's file writes, so it only
+    // appears once the I/O rank's checkpoint data is on disk (the same
+    // ordering the dedicated writer thread provided)
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+      amrex::AsyncOut::Submit([this, checkpointname]() {
+        SetLastCheckpointSymlink(checkpointname);
+      });
+    }
+    asyncCheckpointInFlight_ = true;
   }
 
-  // create symlink and point it at this checkpoint dir
-  SetLastCheckpointSymlink(checkpointname);
+  outputStallSeconds_ += amrex::second() - stall_start;
+  stopPhaseTimer("WriteCheckpointFile", -1, phase_start);
+}
+
+// wait for any in-flight AsyncOut plotfile writes to complete, then release
+// the staged MultiFabs they were reading. this is the completion fence
+// called before submitting a new plotfile, at the end of evolve(), and from
+// the destructor -- without the latter two, the final plotfile of a run
+// could still be draining from the background thread while plotMFStaging_
+// is freed.
+template <typename problem_t>
+void AMRSimulation<problem_t>::FinishAsyncPlotfile() {
+#ifndef AMREX_USE_HDF5
+  if (amrex::AsyncOut::UseAsyncOut() && !plotMFStaging_.empty()) {
+    BL_PROFILE("AMRSimulation::FinishAsyncPlotfile()");
+    amrex::AsyncOut::Finish();
+    plotMFStaging_.clear();
+  }
+#endif
+}
+
+// wait for an in-flight asynchronous checkpoint to complete. this is the
+// completion fence called before starting a new checkpoint and at the end of
+// evolve().
+template <typename problem_t>
+void AMRSimulation<problem_t>::FinishCheckpoint() const {
+  if (asyncCheckpointInFlight_) {
+    BL_PROFILE("AMRSimulation::FinishCheckpoint()");
+    amrex::AsyncOut::Finish();
+    asyncCheckpointInFlight_ = false;
+  }
 }
 
 // utility to skip to next line in Header
@@ -1381,6 +4486,10 @@ void AMRSimulation<problem_t>::ReadCheckpointFile() {
     }
   }
 
+  // directory holding each level's data (incremental checkpoints reference
+  // an earlier dump for coarse levels that were not rewritten)
+  amrex::Vector<std::string> levelDirs(finest_level + 1, restart_chkfile);
+
   for (int lev = 0; lev <= finest_level; ++lev) {
 
     // read in level 'lev' BoxArray from Header
@@ -1388,8 +4497,39 @@ void AMRSimulation<problem_t>::ReadCheckpointFile() {
     ba.readFrom(is);
     GotoNextLine(is);
 
-    // create a distribution mapping
-    amrex::DistributionMapping dm{ba, amrex::ParallelDescriptor::NProcs()};
+    // reuse the saved DistributionMapping when restarting on the same
+    // number of ranks, so that VisMF::Read below is rank-local; when the
+    // rank count differs (or the checkpoint predates saved processor
+    // maps), fall back to building a fresh distribution over the current
+    // ranks.
+    amrex::DistributionMapping dm;
+    bool haveSavedDM = false;
+    is >> std::ws;
+    if (is.peek() == 'D') {
+      std::string tag;
+      int chk_nprocs = 0;
+      is >> tag >> chk_nprocs;
+      amrex::Vector<int> pmap(static_cast<int>(ba.size()));
+      for (int &rank : pmap) {
+        is >> rank;
+      }
+      GotoNextLine(is);
+      if (chk_nprocs == amrex::ParallelDescriptor::NProcs()) {
+        dm = amrex::DistributionMapping(std::move(pmap));
+        haveSavedDM = true;
+      }
+    }
+    if (!haveSavedDM) {
+      dm = amrex::DistributionMapping{ba, amrex::ParallelDescriptor::NProcs()};
+    }
+
+    // read the directory holding this level's data, if recorded
+    is >> std::ws;
+    if (is.peek() == 'L') {
+      std::string tag;
+      is >> tag >> levelDirs[lev];
+      GotoNextLine(is);
+    }
 
     // set BoxArray grids and DistributionMapping dmap in AMReX_AmrMesh.H class
     SetBoxArray(lev, ba);
@@ -1400,20 +4540,21 @@ void AMRSimulation<problem_t>::ReadCheckpointFile() {
     int nghost = nghost_;
     state_old_[lev].define(grids[lev], dmap[lev], ncomp, nghost);
     state_new_[lev].define(grids[lev], dmap[lev], ncomp, nghost);
-    max_signal_speed_[lev].define(ba, dm, 1, nghost);
 
     if (lev > 0 && (do_reflux != 0)) {
       flux_reg_[lev] = std::make_unique<amrex::YAFluxRegister>(
           ba, boxArray(lev - 1), dm, DistributionMap(lev - 1), Geom(lev),
           Geom(lev - 1), refRatio(lev - 1), lev, ncomp);
     }
+
+    resetLevelCosts(lev);
   }
 
   // read in the MultiFab data
   for (int lev = 0; lev <= finest_level; ++lev) {
     amrex::VisMF::Read(
         state_new_[lev],
-        amrex::MultiFabFileFullPrefix(lev, restart_chkfile, "Level_", "Cell"));
+        amrex::MultiFabFileFullPrefix(lev, levelDirs[lev], "Level_", "Cell"));
   }
   areInitialConditionsDefined_ = true;
 }